@@ -0,0 +1,480 @@
+
+// The batch hull benchmark measures the throughput of the convex hull batch (see "ConvexHullBatch.h") in convex hulls
+// per second, i.e., how many small point sequences it processes per second:
+//   BatchHullBenchmark [--sizes SIZES] [--sequences NUMBER] [--threads COUNTS] [--distribution NAME]
+//                      [--min-time SECONDS] [--seed SEED] [--small-threshold SIZE] [--latency] [--verify]
+//                      [--output FILE]
+// For each size, a batch of point sequences is generated whose numbers of points are drawn uniformly from half the
+// size up to one and a half times the size, so that the threads of the batch get point sequences of different sizes.
+// Each point sequence is generated from its own seed. The batch is timed with each number of threads and compared
+// with calling the quickhull once per point sequence ("separate"), which allocates the copy of each point sequence
+// and each convex hull. The repetitions go on until they took the minimal time and there are at least five of them;
+// the program prints the median time per batch and the convex hulls and points per second.
+//
+// With the option "--latency", the program measures the latency distribution of single convex hulls instead: each
+// algorithm of the registry (see "ConvexHullRegistry.h") computes the convex hulls of the point sequences of the batch
+// one by one, once with the small convex hull kernels (see "SmallConvexHull.h") and once without them. Each call is
+// timed with a low-overhead timer (see "LowOverheadTimer.h"); the copy of the point sequence is not timed. The
+// program prints the median, the 90th and 99th percentile, and the maximum of the latencies.
+
+// Orientation policy of the timed batches (see "OrientationPredicates.h" and "InplaceQuickhullTest.cpp").
+#define ORIENTATION_POLICY FastOrientationPolicy
+
+#include <algorithm>
+#include <cstdint>
+#include <cstdlib>      // std::strtod, std::strtoull
+#include <fstream>
+#include <functional>
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <sstream>
+#include <string>
+#include <vector>
+#include "BenchmarkConfiguration.h"
+#include "ConvexHullBatch.h"
+#include "ConvexHullQuickHull.h"
+#include "ConvexHullRegistry.h"
+#include "FixedPoint.h"
+#include "HullVerification.h"
+#include "LowOverheadTimer.h"
+#include "OrientationPredicates.h"
+#include "ParallelExecution.h"
+#include "PointHandler.h"
+#include "SmallConvexHull.h"
+#include "TimeMeasurement.h"
+
+//***************************************
+// Constants and constant data structures
+//***************************************
+
+using TestedPointSequence = PointSequenceOf<ORIENTATION_POLICY>;
+using TestedPointSequenceBatch = PointSequenceBatchOf<ORIENTATION_POLICY>;
+
+// Minimal number of repetitions of a batch.
+constexpr size_t MINIMAL_NUMBER_OF_REPETITIONS = 5;
+
+// Type that keeps the latency distribution of the convex hulls of a batch in nanoseconds.
+struct LatencyDistribution
+{
+  double median = 0;
+  double percentile90 = 0;
+  double percentile99 = 0;
+  double maximum = 0;
+};
+
+//*****************
+// Preparing points
+//*****************
+const PointSequence* getTestedPointSequence(const PointSequence& pointSeq, PointSequence& convertedPointSeq);
+template <typename Integer>
+const std::vector<BasicFixedPoint<Integer>>* getTestedPointSequence(
+  const PointSequence& pointSeq, std::vector<BasicFixedPoint<Integer>>& convertedPointSeq);
+bool prepareBatch(size_t size, size_t numberOfSequences, PointDistribution distribution, std::uint64_t seed,
+                  TestedPointSequenceBatch& batch);
+
+//****************
+// Timing batches
+//****************
+TimeDuration timeRepetitions(const std::function<void()>& run, double minimalTimeInSeconds,
+                             size_t& numberOfRepetitions);
+bool verifyConvexHulls(const TestedPointSequenceBatch& batch, const TestedPointSequenceBatch& convexHulls);
+
+//*****************
+// Timing latencies
+//*****************
+LatencyDistribution measureLatencies(const ConvexHullAlgorithm<ORIENTATION_POLICY>& algorithm,
+                                     const TestedPointSequenceBatch& batch);
+int measureLatencies(const std::vector<size_t>& sizes, size_t numberOfSequences, PointDistribution distribution,
+                     std::uint64_t seed, size_t smallConvexHullThreshold, const std::string& outputFileName);
+
+//*************
+// Command line
+//*************
+bool parseNumbers(const std::string& list, double minimalNumber, std::vector<size_t>& numbers);
+void printUsage(const std::string& programName);
+
+//*************
+// Main program
+//*************
+
+int main(int argc, char* argv[])
+{
+  std::vector<size_t> sizes {16, 64, 256, 1024};
+  std::vector<size_t> threadCounts;
+  size_t numberOfSequences = 10000;
+  PointDistribution distribution = PointDistribution::UNIFORM;
+  double minimalTimeInSeconds = 0.5;
+  std::uint64_t seed = 1;
+  size_t smallConvexHullThreshold = getSmallConvexHullThreshold();
+  bool convexHullsAreVerified = false, latenciesAreMeasured = false;
+  std::string outputFileName;
+
+  for (int i = 1; i < argc; ++i)
+  {
+    std::string argument(argv[i]);
+    if (argument == "--help")
+    {
+      printUsage(argv[0]);
+      return 0;
+    }
+    if (argument == "--verify")
+    {
+      convexHullsAreVerified = true;
+      continue;
+    }
+    if (argument == "--latency")
+    {
+      latenciesAreMeasured = true;
+      continue;
+    }
+    if (i + 1 == argc)
+    {
+      std::cout << "ERROR: Option '" << argument << "' is unknown or lacks a value!" << std::endl;
+      printUsage(argv[0]);
+      return 1;
+    }
+    std::string value(argv[++i]);
+    char* end = nullptr;
+    bool valueIsValid = true;
+    std::vector<size_t> numbers;
+    if (argument == "--sizes")
+      valueIsValid = parseNumbers(value, 1, sizes);
+    else if (argument == "--sequences")
+    {
+      valueIsValid = parseNumbers(value, 1, numbers) && numbers.size() == 1;
+      if (valueIsValid)
+        numberOfSequences = numbers[0];
+    }
+    else if (argument == "--threads")
+      valueIsValid = parseNumbers(value, 1, threadCounts);
+    else if (argument == "--distribution")
+      valueIsValid = convertToPointDistribution(value, distribution);
+    else if (argument == "--min-time")
+    {
+      minimalTimeInSeconds = std::strtod(value.c_str(), &end);
+      valueIsValid = (*end == '\0' && minimalTimeInSeconds >= 0 && minimalTimeInSeconds < 1e6);
+    }
+    else if (argument == "--seed")
+    {
+      seed = std::strtoull(value.c_str(), &end, 10);
+      valueIsValid = (! value.empty() && *end == '\0');
+    }
+    else if (argument == "--small-threshold")
+    {
+      smallConvexHullThreshold = std::strtoull(value.c_str(), &end, 10);
+      valueIsValid = (! value.empty() && *end == '\0' &&
+                      smallConvexHullThreshold <= MAXIMAL_SIZE_OF_SMALL_CONVEX_HULL);
+    }
+    else if (argument == "--output")
+      outputFileName = value;
+    else
+      valueIsValid = false;
+    if (! valueIsValid)
+    {
+      std::cout << "ERROR: Option '" << argument << "' is unknown or has an invalid value!" << std::endl;
+      printUsage(argv[0]);
+      return 1;
+    }
+  }
+  if (latenciesAreMeasured)
+    return measureLatencies(sizes, numberOfSequences, distribution, seed, smallConvexHullThreshold, outputFileName);
+  setSmallConvexHullThreshold(smallConvexHullThreshold);
+  if (threadCounts.empty())
+  {
+    threadCounts.push_back(1);
+    if (getDefaultNumberOfThreads() > 1)
+      threadCounts.push_back(getDefaultNumberOfThreads());
+  }
+
+  std::ostringstream csv;
+  csv << "Method,Mean number of points,Number of sequences,Threads,Repetitions,Median (ns),Hulls/s,Points/s\n";
+  std::cout << std::left << std::setw(10) << "Method" << std::right << std::setw(8) << "Points" << std::setw(11)
+            << "Sequences" << std::setw(9) << "Threads" << std::setw(7) << "Reps" << std::setw(13) << "ms/batch"
+            << std::setw(13) << "Mhulls/s" << std::setw(14) << "Mpoints/s" << std::endl;
+  std::cout << std::fixed;
+
+  for (size_t size : sizes)
+  {
+    TestedPointSequenceBatch batch, convexHulls;
+    if (! prepareBatch(size, numberOfSequences, distribution, seed, batch))
+      return 1;
+    ConvexHullBatch<ORIENTATION_POLICY> convexHullBatch;
+    if (! convexHullBatch.computeConvexHulls(batch, convexHulls))
+      return 1;
+    if (convexHullsAreVerified && ! verifyConvexHulls(batch, convexHulls))
+      return 1;
+
+    // The separate convex hulls are kept until the next repetition, like the results of a batch.
+    std::vector<TestedPointSequence> separateConvexHulls;
+    std::vector<std::pair<std::string, size_t>> methods {{"separate", 1}};
+    for (size_t numberOfThreads : threadCounts)
+      methods.emplace_back("batch", numberOfThreads);
+
+    for (const std::pair<std::string, size_t>& method : methods)
+    {
+      size_t numberOfRepetitions = 0;
+      std::function<void()> run = [&]()
+      {
+        separateConvexHulls.clear();
+        for (size_t i = 0; i < numberOfSequences; ++i)
+          separateConvexHulls.push_back(ConvexHullQuickHull<ORIENTATION_POLICY>(TestedPointSequence(
+            batch.points.begin() + batch.offsets[i], batch.points.begin() + batch.offsets[i + 1])));
+      };
+      if (method.first == "batch")
+        run = [&]() { convexHullBatch.computeConvexHulls(batch, convexHulls, method.second); };
+      TimeDuration median = timeRepetitions(run, minimalTimeInSeconds, numberOfRepetitions);
+      double nanoseconds = double(median.getNanoseconds().count());
+      double hullsPerSecond = (nanoseconds > 0) ? double(numberOfSequences) * 1e9 / nanoseconds : 0;
+      double pointsPerSecond = (nanoseconds > 0) ? double(batch.points.size()) * 1e9 / nanoseconds : 0;
+
+      std::cout << std::left << std::setw(10) << method.first << std::right << std::setw(8) << size << std::setw(11)
+                << numberOfSequences << std::setw(9) << method.second << std::setw(7) << numberOfRepetitions
+                << std::setprecision(3) << std::setw(13) << nanoseconds / 1e6 << std::setw(13) << hullsPerSecond / 1e6
+                << std::setprecision(1) << std::setw(14) << pointsPerSecond / 1e6 << std::endl;
+      csv << method.first << "," << size << "," << numberOfSequences << "," << method.second << ","
+          << numberOfRepetitions << "," << nanoseconds << "," << hullsPerSecond << "," << pointsPerSecond << "\n";
+    }
+  }
+
+  if (! outputFileName.empty())
+  {
+    std::ofstream outputFile(outputFileName);
+    if (! (outputFile << csv.str()))
+    {
+      std::cout << "ERROR: The file '" << outputFileName << "' cannot be written!" << std::endl;
+      return 1;
+    }
+  }
+
+  return 0;
+}
+
+//*****************
+// Preparing points
+//*****************
+
+// Method that returns the generated point sequence "pointSeq" as the point sequence of the orientation policy.
+const PointSequence* getTestedPointSequence(const PointSequence& pointSeq, PointSequence&)
+{
+  return &pointSeq;
+}
+
+// Method that converts the generated point sequence "pointSeq" into the fixed-point sequence "convertedPointSeq" and
+// returns it. If the conversion fails, the method returns nullptr.
+template <typename Integer>
+const std::vector<BasicFixedPoint<Integer>>* getTestedPointSequence(
+  const PointSequence& pointSeq, std::vector<BasicFixedPoint<Integer>>& convertedPointSeq)
+{
+  if (! convertToFixedPointSequence(pointSeq, convertedPointSeq))
+    return nullptr;
+
+  return &convertedPointSeq;
+}
+
+// Method that generates the batch "batch" of "numberOfSequences" point sequences with the distribution "distribution"
+// and about "size" points each (see above) from the seed "seed". It returns "false" if the batch cannot be prepared.
+bool prepareBatch(size_t size, size_t numberOfSequences, PointDistribution distribution, std::uint64_t seed,
+                  TestedPointSequenceBatch& batch)
+{
+  std::mt19937_64 generator(seed);
+  std::uniform_int_distribution<size_t> sizeDistribution(std::max<size_t>(size / 2, 1), size + size / 2);
+  PointSequence points, pointSeq;
+
+  batch.offsets.assign(1, 0);
+  for (size_t i = 0; i < numberOfSequences; ++i)
+  {
+    generatePointSequence(pointSeq, sizeDistribution(generator), distribution, seed + i + 1);
+    points.insert(points.end(), pointSeq.begin(), pointSeq.end());
+    batch.offsets.push_back(points.size());
+  }
+
+  TestedPointSequence convertedPoints;
+  const TestedPointSequence* testedPoints = getTestedPointSequence(points, convertedPoints);
+  if (testedPoints == nullptr)
+    return false;
+  batch.points.assign(testedPoints->begin(), testedPoints->end());
+
+  return true;
+}
+
+//****************
+// Timing batches
+//****************
+
+// Method that runs "run" repeatedly and returns the median time of its repetitions. The timer reads the time stamp
+// counter if it is available.
+TimeDuration timeRepetitions(const std::function<void()>& run, double minimalTimeInSeconds,
+                             size_t& numberOfRepetitions)
+{
+  Timer timer(getClockCalibration().timeStampCounterIsAvailable ? ClockSource::TIME_STAMP_COUNTER
+                                                                 : ClockSource::STEADY_CLOCK);
+  TimeDurationSeries durations;
+  double totalTimeInSeconds = 0;
+
+  numberOfRepetitions = 0;
+  while (numberOfRepetitions < MINIMAL_NUMBER_OF_REPETITIONS || totalTimeInSeconds < minimalTimeInSeconds)
+  {
+    timer.setStartTime();
+    run();
+    timer.setStopTime();
+    TimeDuration duration = timer.getElapsedTime();
+    durations.addDuration(duration);
+    totalTimeInSeconds += double(duration.getNanoseconds().count()) / 1e9;
+    ++numberOfRepetitions;
+  }
+
+  return durations.calculateMedian();
+}
+
+// Method that verifies the convex hulls "convexHulls" of the point sequences of the batch "batch" (see
+// "HullVerification.h"). If a convex hull is wrong, the method prints an error message and returns "false".
+bool verifyConvexHulls(const TestedPointSequenceBatch& batch, const TestedPointSequenceBatch& convexHulls)
+{
+  TestedPointSequence pointSeq;
+
+  for (size_t i = 0; i < getNumberOfPointSequences(batch); ++i)
+  {
+    pointSeq.assign(batch.points.begin() + batch.offsets[i], batch.points.begin() + batch.offsets[i + 1]);
+    HullVerification verification = verifyConvexHull(pointSeq, convexHulls.points.data() + convexHulls.offsets[i],
+                                                     convexHulls.offsets[i + 1] - convexHulls.offsets[i], 1);
+    if (! verification.isValid)
+    {
+      std::cout << "ERROR: The convex hull of point sequence " << i << " is wrong: " << verification.violation
+                << std::endl;
+      return false;
+    }
+  }
+
+  return true;
+}
+
+//*****************
+// Timing latencies
+//*****************
+
+// Method that computes the convex hulls of the point sequences of the batch "batch" one by one with the algorithm
+// "algorithm" and returns the distribution of their latencies.
+LatencyDistribution measureLatencies(const ConvexHullAlgorithm<ORIENTATION_POLICY>& algorithm,
+                                     const TestedPointSequenceBatch& batch)
+{
+  LowOverheadTimer timer(getClockCalibration().timeStampCounterIsAvailable ? ClockSource::TIME_STAMP_COUNTER
+                                                                            : ClockSource::STEADY_CLOCK);
+  size_t numberOfSequences = getNumberOfPointSequences(batch);
+  ConvexHullAlgorithm<ORIENTATION_POLICY>::PointSequenceType pointSeq;
+  ConvexHullAlgorithm<ORIENTATION_POLICY>::ConvexHullType convexHull;
+  std::vector<double> latencies;
+  LatencyDistribution distribution;
+
+  if (numberOfSequences == 0)
+    return distribution;
+  latencies.reserve(numberOfSequences);
+  for (size_t i = 0; i < numberOfSequences; ++i)
+  {
+    pointSeq.assign(batch.points.begin() + batch.offsets[i], batch.points.begin() + batch.offsets[i + 1]);
+    timer.start();
+    algorithm.computeConvexHull(pointSeq, convexHull);
+    timer.stop();
+    latencies.push_back(double(timer.getElapsedTime().count()));
+  }
+
+  std::sort(latencies.begin(), latencies.end());
+  distribution.median = latencies[(numberOfSequences - 1) / 2];
+  distribution.percentile90 = latencies[(numberOfSequences - 1) * 90 / 100];
+  distribution.percentile99 = latencies[(numberOfSequences - 1) * 99 / 100];
+  distribution.maximum = latencies.back();
+
+  return distribution;
+}
+
+// Method that measures the latency distributions of all algorithms with and without the small convex hull kernels
+// for batches of point sequences of the sizes "sizes" (see above). It returns the exit code of the program.
+int measureLatencies(const std::vector<size_t>& sizes, size_t numberOfSequences, PointDistribution distribution,
+                     std::uint64_t seed, size_t smallConvexHullThreshold, const std::string& outputFileName)
+{
+  std::ostringstream csv;
+  csv << "Algorithm,Small kernels,Mean number of points,Number of sequences,Median (ns),P90 (ns),P99 (ns),Max (ns)\n";
+  std::cout << std::left << std::setw(22) << "Algorithm" << std::setw(8) << "Kernels" << std::right << std::setw(8)
+            << "Points" << std::setw(11) << "Sequences" << std::setw(12) << "Median (ns)" << std::setw(10) << "P90 (ns)"
+            << std::setw(10) << "P99 (ns)" << std::setw(10) << "Max (ns)" << std::endl;
+  std::cout << std::fixed << std::setprecision(0);
+
+  for (size_t size : sizes)
+  {
+    TestedPointSequenceBatch batch;
+    if (! prepareBatch(size, numberOfSequences, distribution, seed, batch))
+      return 1;
+
+    for (const ConvexHullAlgorithm<ORIENTATION_POLICY>& algorithm : getConvexHullAlgorithms<ORIENTATION_POLICY>())
+      for (bool kernelsAreUsed : {true, false})
+      {
+        setSmallConvexHullThreshold(kernelsAreUsed ? smallConvexHullThreshold : 0);
+        LatencyDistribution latencies = measureLatencies(algorithm, batch);
+        std::cout << std::left << std::setw(22) << algorithm.name << std::setw(8) << (kernelsAreUsed ? "on" : "off")
+                  << std::right << std::setw(8) << size << std::setw(11) << numberOfSequences << std::setw(12)
+                  << latencies.median << std::setw(10) << latencies.percentile90 << std::setw(10)
+                  << latencies.percentile99 << std::setw(10) << latencies.maximum << std::endl;
+        csv << algorithm.name << "," << (kernelsAreUsed ? "on" : "off") << "," << size << "," << numberOfSequences
+            << "," << latencies.median << "," << latencies.percentile90 << "," << latencies.percentile99 << ","
+            << latencies.maximum << "\n";
+      }
+  }
+  setSmallConvexHullThreshold(smallConvexHullThreshold);
+
+  if (! outputFileName.empty())
+  {
+    std::ofstream outputFile(outputFileName);
+    if (! (outputFile << csv.str()))
+    {
+      std::cout << "ERROR: The file '" << outputFileName << "' cannot be written!" << std::endl;
+      return 1;
+    }
+  }
+
+  return 0;
+}
+
+//*************
+// Command line
+//*************
+
+// Method that parses the comma-separated list "list" of numbers that are at least "minimalNumber". It returns "false"
+// if the list is invalid.
+bool parseNumbers(const std::string& list, double minimalNumber, std::vector<size_t>& numbers)
+{
+  std::istringstream values(list);
+  std::string value;
+
+  numbers.clear();
+  while (std::getline(values, value, ','))
+  {
+    char* end = nullptr;
+    double number = std::strtod(value.c_str(), &end);
+    if (value.empty() || *end != '\0' || !(number >= minimalNumber && number <= 1e10))
+      return false;
+    numbers.push_back(size_t(number));
+  }
+
+  return ! numbers.empty();
+}
+
+// Method that prints the command line options of the program "programName".
+void printUsage(const std::string& programName)
+{
+  std::cout << "Usage: " << programName << " [options]\n"
+            << "  --sizes SIZES        Comma-separated mean numbers of points of the point sequences of a batch\n"
+            << "                       (default: 16,64,256,1024)\n"
+            << "  --sequences NUMBER   Number of point sequences of a batch (default: 10000)\n"
+            << "  --threads COUNTS     Comma-separated numbers of threads of the batch (default: 1 and the number of\n"
+            << "                       hardware threads)\n"
+            << "  --distribution NAME  Distribution of the points: uniform, circle, or degenerate (default: uniform)\n"
+            << "  --min-time SECONDS   Minimal total time of the repetitions of a method (default: 0.5)\n"
+            << "  --seed SEED          Seed of the generated points (default: 1)\n"
+            << "  --small-threshold N  Number of points up to which the algorithms call the small kernels; 0\n"
+            << "                       disables them (default: " << DEFAULT_SMALL_CONVEX_HULL_THRESHOLD << ")\n"
+            << "  --latency            Measure the latency distribution of single convex hulls of each algorithm with\n"
+            << "                       and without the small convex hull kernels instead of the throughput of batches\n"
+            << "  --verify             Verify the convex hulls of each batch before it is timed\n"
+            << "  --output FILE        Write the results as a CSV table to the file FILE\n"
+            << "  --help               Print this text" << std::endl;
+}
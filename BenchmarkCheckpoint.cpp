@@ -0,0 +1,327 @@
+
+#include <cstdio>
+#include <iomanip>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <vector>
+#include "BenchmarkCheckpoint.h"
+
+//+++++++++++++++++++++++
+// Local data and methods
+//+++++++++++++++++++++++
+
+// First field of the first line of a checkpoint file.
+static const std::string CHECKPOINT_FILE_TAG = "ConvexHullCheckpoint";
+
+// Method that splits the string "str" at its tabs.
+static std::vector<std::string> splitAtTabs(const std::string& str)
+{
+  std::vector<std::string> fields;
+  std::istringstream stream(str);
+  std::string field;
+
+  while (std::getline(stream, field, '\t'))
+    fields.push_back(field);
+  if (!str.empty() && str.back() == '\t')
+    fields.push_back(std::string());
+
+  return fields;
+}
+
+// Method that converts the string "str" completely into an unsigned integer "integer" in the base "base". It returns
+// "false" if the string is no such integer.
+static bool parseUnsignedInteger(const std::string& str, std::uint64_t& integer, int base = 10)
+{
+  size_t length = 0;
+
+  if (str.empty() || str[0] == '-' || str[0] == '+')
+    return false;
+  try
+  {
+    integer = std::stoull(str, &length, base);
+  }
+  catch (...)
+  {
+    return false;
+  }
+  return length == str.size();
+}
+
+// Method that converts the line "line" of a checkpoint file into the run "record". It returns "false" if the line is
+// no run.
+static bool parseCheckpointRecord(const std::string& line, CheckpointRecord& record)
+{
+  std::vector<std::string> fields = splitAtTabs(line);
+  std::uint64_t integers[5];
+  size_t length = 0;
+
+  // The fixed fields are followed by pairs of metric names and values.
+  if (fields.size() < 6 || fields.size() % 2 != 0)
+    return false;
+  for (size_t i = 0; i < 4; ++i)
+    if (!parseUnsignedInteger(fields[i + 1], integers[i]))
+      return false;
+  if (!parseUnsignedInteger(fields[5], integers[4]) || integers[4] > std::uint64_t(INT64_MAX))
+    return false;
+
+  record.pointSource = fields[0];
+  record.numberOfThreads = size_t(integers[0]);
+  record.numberOfPoints = size_t(integers[1]);
+  record.runNumber = size_t(integers[2]);
+  record.algorithmNumber = size_t(integers[3]);
+  record.durationInNanoseconds = std::int64_t(integers[4]);
+  record.metrics.clear();
+  for (size_t i = 6; i < fields.size(); i += 2)
+  {
+    double value;
+    try
+    {
+      value = std::stod(fields[i + 1], &length);
+    }
+    catch (...)
+    {
+      return false;
+    }
+    if (length != fields[i + 1].size())
+      return false;
+    record.metrics.emplace_back(fields[i], value);
+  }
+
+  return true;
+}
+
+// Method that writes the run "record" as a line of a checkpoint file into the stream "stream".
+static void writeCheckpointRecord(std::ostream& stream, const CheckpointRecord& record)
+{
+  stream << record.pointSource << '\t' << record.numberOfThreads << '\t' << record.numberOfPoints << '\t'
+         << record.runNumber << '\t' << record.algorithmNumber << '\t' << record.durationInNanoseconds;
+  stream << std::setprecision(17);
+  for (const std::pair<std::string, double>& metric : record.metrics)
+    stream << '\t' << metric.first << '\t' << metric.second;
+  stream << '\n';
+}
+
+//+++++++++++++++++++++
+// Benchmark checkpoint
+//+++++++++++++++++++++
+
+// Method that creates the checkpoint file "fileName".
+bool BenchmarkCheckpoint::create(const std::string& fileName, std::uint64_t configurationHash, std::uint64_t seed)
+{
+  if (std::ifstream(fileName).good())
+  {
+    std::cout << "ERROR: Checkpoint file '" << fileName << "' exists already; resume it with the option '--resume' "
+              << "or remove it!" << std::endl;
+    return false;
+  }
+
+  this->fileName = fileName;
+  this->configurationHash = configurationHash;
+  this->seed = seed;
+  records.clear();
+  file.open(fileName);
+  writeHeader();
+  if (!file)
+  {
+    std::cout << "ERROR: Checkpoint file '" << fileName << "' cannot be written!" << std::endl;
+    file.close();
+    return false;
+  }
+
+  return true;
+}
+
+// Method that reads the checkpoint file "fileName" without changing it.
+bool BenchmarkCheckpoint::read(const std::string& fileName)
+{
+  std::ifstream input(fileName);
+  std::string line;
+  std::vector<std::string> fields;
+  CheckpointRecord record;
+
+  if (!std::getline(input, line) || (fields = splitAtTabs(line)).size() != 3 || fields[0] != CHECKPOINT_FILE_TAG ||
+      !parseUnsignedInteger(fields[1], configurationHash, 16) || !parseUnsignedInteger(fields[2], seed))
+  {
+    std::cout << "ERROR: File '" << fileName << "' cannot be read or is no checkpoint file!" << std::endl;
+    return false;
+  }
+  records.clear();
+  // A line without a line feed at the end of the file was not completely written.
+  while (std::getline(input, line) && !input.eof())
+  {
+    if (!parseCheckpointRecord(line, record))
+    {
+      std::cout << "ERROR: Line " << records.size() + 2 << " of checkpoint file '" << fileName << "' is no run!"
+                << std::endl;
+      return false;
+    }
+    records.push_back(record);
+  }
+  this->fileName = fileName;
+
+  return true;
+}
+
+// Method that continues the checkpoint file read by "read". The file is rewritten without a run that was not
+// completely written. If the file cannot be written, the method prints an error message and returns "false".
+bool BenchmarkCheckpoint::resume()
+{
+  // The file is rewritten with the complete runs, so that the appended runs start on a new line. The runs are
+  // written into a temporary file first, so that they are not lost if the process dies meanwhile.
+  std::string temporaryFileName = fileName + ".tmp";
+  file.open(temporaryFileName);
+  writeHeader();
+  for (const CheckpointRecord& completeRecord : records)
+    writeCheckpointRecord(file, completeRecord);
+  file.close();
+  if (!file || std::rename(temporaryFileName.c_str(), fileName.c_str()) != 0)
+  {
+    std::cout << "ERROR: Checkpoint file '" << fileName << "' cannot be written!" << std::endl;
+    std::remove(temporaryFileName.c_str());
+    return false;
+  }
+
+  file.clear();
+  file.open(fileName, std::ios::app);
+  if (!file)
+  {
+    std::cout << "ERROR: Checkpoint file '" << fileName << "' cannot be written!" << std::endl;
+    return false;
+  }
+
+  return true;
+}
+
+// Method that checks whether runs are written into a checkpoint file.
+bool BenchmarkCheckpoint::isActive() const
+{
+  return file.is_open();
+}
+
+// Method that returns the configuration hash of the checkpoint file.
+std::uint64_t BenchmarkCheckpoint::getConfigurationHash() const
+{
+  return configurationHash;
+}
+
+// Method that returns the seed of the checkpoint file.
+std::uint64_t BenchmarkCheckpoint::getSeed() const
+{
+  return seed;
+}
+
+// Method that returns the runs that were read from the checkpoint file.
+const std::vector<CheckpointRecord>& BenchmarkCheckpoint::getRecords() const
+{
+  return records;
+}
+
+// Method that appends the run "record" to the checkpoint file and flushes it.
+bool BenchmarkCheckpoint::addRecord(const CheckpointRecord& record)
+{
+  if (!isActive())
+    return false;
+
+  writeCheckpointRecord(file, record);
+  file.flush();
+  if (!file)
+  {
+    std::cout << "ERROR: Checkpoint file '" << fileName << "' cannot be written!" << std::endl;
+    return false;
+  }
+
+  return true;
+}
+
+// Method that writes the first line of the checkpoint file.
+void BenchmarkCheckpoint::writeHeader()
+{
+  file << CHECKPOINT_FILE_TAG << '\t' << std::hex << std::setw(16) << std::setfill('0') << configurationHash
+       << std::dec << std::setfill(' ') << '\t' << seed << '\n';
+  file.flush();
+}
+
+// Method that returns a hash of the settings of the configuration "configuration" and of the environment
+// "environment" that affect the measured runs.
+std::uint64_t hashBenchmarkConfiguration(const BenchmarkConfiguration& configuration,
+                                         const BenchmarkEnvironment& environment)
+{
+  const SamplingParameters& samplingParameters = configuration.samplingParameters;
+  std::ostringstream description;
+  std::string str;
+  std::uint64_t hash = 14695981039346656037ULL;
+
+  // The settings are written one per line, so that no two different configurations have the same description.
+  description << "algorithms:";
+  for (const std::string& name : configuration.algorithmNames)
+    description << " " << name;
+  description << "\nsizes:";
+  for (size_t numberOfPoints : configuration.numbersOfPoints)
+    description << " " << numberOfPoints;
+  description << "\ndistributions:";
+  for (PointDistribution distribution : configuration.distributions)
+    description << " " << convertToString(distribution);
+  description << "\ninput: " << configuration.inputFileName
+              << "\nseed: " << configuration.seed
+              << "\nthreads: " << configuration.numberOfThreads
+              << "\nscaling: " << convertToString(configuration.scalingMode) << "\nthread counts:";
+  for (size_t numberOfThreads : configuration.threadCounts)
+    description << " " << numberOfThreads;
+  description << "\nsampling: " << convertToString(samplingParameters.samplingMode) << " "
+              << samplingParameters.numberOfWarmupRuns << " " << samplingParameters.numberOfRuns << " "
+              << samplingParameters.minimalNumberOfRuns << " " << samplingParameters.maximalNumberOfRuns << " "
+              << std::setprecision(17) << samplingParameters.targetRelativeConfidenceIntervalWidth << " "
+              << samplingParameters.timeBudget.count()
+              << "\nclock: " << int(configuration.clockSource)
+              << "\ncache: " << convertToString(configuration.cacheMode)
+              << "\nhuge pages: " << convertToString(configuration.pointBufferParameters.hugePageMode)
+              << "\npage placement: " << convertToString(configuration.pointBufferParameters.pagePlacement)
+              << "\ncounters: " << configuration.performanceCountersAreCollected
+              << "\npipeline: " << configuration.generationIsPipelined
+              << "\ntrace: " << !configuration.traceFileName.empty();
+  // The spans are recorded within the timed region; their thresholds only matter if the runs are traced.
+  if (!configuration.traceFileName.empty())
+    description << " " << configuration.traceParameters.minimalSpanSize << " "
+                << configuration.traceParameters.minimalSpanDuration.count();
+  description << "\nprocessor: " << environment.processor
+              << "\nhost: " << environment.hostName
+              << "\ncompiler: " << environment.compiler << " " << environment.compilerFlags
+              << "\norientation policy: " << environment.orientationPolicy
+              << "\nrevision: " << environment.gitRevision << "\n";
+
+  str = description.str();
+  for (unsigned char c : str)
+  {
+    hash ^= c;
+    hash *= 1099511628211ULL;
+  }
+
+  return hash;
+}
+
+// Method that opens the checkpoint file of the configuration "configuration" in "checkpoint" if it has one.
+bool openBenchmarkCheckpoint(BenchmarkConfiguration& configuration, const BenchmarkEnvironment& environment,
+                             BenchmarkCheckpoint& checkpoint)
+{
+  if (configuration.checkpointFileName.empty())
+    return true;
+  if (!configuration.checkpointIsResumed)
+    return checkpoint.create(configuration.checkpointFileName, hashBenchmarkConfiguration(configuration, environment),
+                             configuration.seed);
+
+  // The file is only rewritten after its configuration hash is checked, so that a file that is not resumed stays
+  // unchanged.
+  if (!checkpoint.read(configuration.checkpointFileName))
+    return false;
+  if (!configuration.seedIsGiven)
+    configuration.seed = checkpoint.getSeed();
+  if (checkpoint.getConfigurationHash() != hashBenchmarkConfiguration(configuration, environment))
+  {
+    std::cout << "ERROR: Checkpoint file '" << configuration.checkpointFileName << "' was written with other "
+              << "settings, by another build, or on another machine and cannot be resumed!" << std::endl;
+    return false;
+  }
+
+  return checkpoint.resume();
+}
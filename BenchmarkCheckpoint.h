@@ -0,0 +1,97 @@
+#ifndef BENCHMARKCHECKPOINT_H
+#define BENCHMARKCHECKPOINT_H
+
+
+#include <cstdint>
+#include <fstream>
+#include <string>
+#include <utility>
+#include <vector>
+#include "BenchmarkConfiguration.h"
+#include "BenchmarkResults.h"
+
+// A benchmark checkpoint keeps the measured runs of a performance test in a file, so that a test that is killed (e.g.,
+// because the memory is exhausted for the largest number of points) can be resumed instead of being repeated. Each
+// run is appended to the file and flushed as soon as it is measured; a run that was not completely written when the
+// process died is dropped on resumption. When the test is resumed, the runs are added to the runtime managers again
+// in the order in which they were measured, so that the sampling continues where it stopped and the completed
+// algorithms and numbers of points are skipped.
+//
+// The file starts with a line that contains a hash of the configuration and the environment of the test (see
+// "hashBenchmarkConfiguration") and the seed of the generated points. A test is only resumed if its hash matches,
+// so that the runs of different settings, builds, or machines are not mixed. The other lines contain one run each as
+// tab-separated fields: the point source, the number of threads, the number of points, the run number, the number of
+// the algorithm, the runtime in nanoseconds, and the names and values of the metrics of the run.
+
+// Type that keeps a measured run of an algorithm.
+struct CheckpointRecord
+{
+  // Point distribution or input file (see "pointSource" in "BenchmarkResults.h").
+  std::string pointSource;
+  // Number of threads of the run as configured (0 for the default number of threads).
+  size_t numberOfThreads = 0;
+  size_t numberOfPoints = 0;
+  size_t runNumber = 0;
+  size_t algorithmNumber = 0;
+  std::int64_t durationInNanoseconds = 0;
+  std::vector<std::pair<std::string, double>> metrics;
+};
+
+class BenchmarkCheckpoint
+{
+  public:
+    // Method that creates the checkpoint file "fileName" for a test with the configuration hash "configurationHash"
+    // and the seed "seed". An existing file is not overwritten, since it may keep the runs of hours. If the file exists
+    // or cannot be written, the method prints an error message and returns "false".
+    bool create(const std::string& fileName, std::uint64_t configurationHash, std::uint64_t seed);
+
+    // Method that reads the configuration hash, the seed, and the completely written runs of the checkpoint file
+    // "fileName" without changing it. If the file cannot be read, the method prints an error message and returns
+    // "false".
+    bool read(const std::string& fileName);
+
+    // Method that continues the checkpoint file read by "read". The file is rewritten without a run that was not
+    // completely written. If the file cannot be written, the method prints an error message and returns "false".
+    bool resume();
+
+    // Method that checks whether runs are written into a checkpoint file.
+    bool isActive() const;
+
+    // Methods that return the configuration hash and the seed of the checkpoint file.
+    std::uint64_t getConfigurationHash() const;
+    std::uint64_t getSeed() const;
+
+    // Method that returns the runs that were read from the checkpoint file by "read".
+    const std::vector<CheckpointRecord>& getRecords() const;
+
+    // Method that appends the run "record" to the checkpoint file and flushes it. If the run cannot be written, the
+    // method prints an error message and returns "false".
+    bool addRecord(const CheckpointRecord& record);
+
+  private:
+    // Method that writes the first line of the checkpoint file.
+    void writeHeader();
+
+    std::string fileName;
+    std::ofstream file;
+    std::uint64_t configurationHash = 0;
+    std::uint64_t seed = 0;
+    std::vector<CheckpointRecord> records;
+};
+
+// Method that opens the checkpoint file of the configuration "configuration" in "checkpoint" if it has one (see
+// "--checkpoint" and "--resume" in "BenchmarkConfiguration.h"). A resumed checkpoint file provides the seed unless it
+// is given; its configuration hash must match the one of "configuration" and "environment", otherwise the file is
+// left unchanged. If the checkpoint file cannot be opened, the method prints an error message and returns "false".
+bool openBenchmarkCheckpoint(BenchmarkConfiguration& configuration, const BenchmarkEnvironment& environment,
+                             BenchmarkCheckpoint& checkpoint);
+
+// Method that returns a hash (FNV-1a) of the settings of the configuration "configuration" and of the environment
+// "environment" that affect the measured runs. The pipelining of the point generation and the tracing are part of it,
+// since the background thread shares the memory bandwidth and the last level cache with the measured threads and the
+// spans are recorded within the timed region; the output files (including the name of the trace file) and the start
+// time are not.
+std::uint64_t hashBenchmarkConfiguration(const BenchmarkConfiguration& configuration,
+                                         const BenchmarkEnvironment& environment);
+
+#endif // BENCHMARKCHECKPOINT_H
@@ -0,0 +1,220 @@
+
+// The program compares result sets of the performance test (see "BenchmarkResults.h"), e.g., of two versions of the
+// library, so that an upgrade can be gated on its performance:
+//   BenchmarkCompare [--threshold X] [--alpha X] BASELINE.jsonl CANDIDATE.jsonl ...
+// Each candidate result set is compared with the baseline result set. For each point source, algorithm, number of
+// points, and number of threads, the program prints the medians of the runtimes, their relative change, and the
+// p-value of the Mann-Whitney U test. A change is a regression (or an improvement) if the median grew (or shrank) by
+// more than the threshold (default: 0.05, i.e., 5%) and the p-value is below alpha (default: 0.05). Differences of the
+// environments (processor, compiler flags, and so on) are printed as warnings, since they make the comparison
+// questionable.
+//
+// The program returns 0 if no regression is found, 1 if the arguments or the files are invalid, and 2 if a regression
+// is found.
+
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>      // std::strtod
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <vector>
+#include "BenchmarkResults.h"
+
+//***********
+// Comparison
+//***********
+
+// Type that indicates the outcome of the comparison of the runtimes of a candidate with those of the baseline.
+enum class ComparisonVerdict {UNCHANGED, IMPROVEMENT, REGRESSION, MISSING_IN_BASELINE, MISSING_IN_CANDIDATE};
+
+std::string convertToString(ComparisonVerdict verdict);
+double calculateMedian(std::vector<double> values);
+void printEnvironmentDifferences(const BenchmarkEnvironment& baseline, const BenchmarkEnvironment& candidate);
+bool compareResultSets(const BenchmarkResultSet& baseline, const BenchmarkResultSet& candidate, double threshold,
+                       double alpha);
+void printUsage(const std::string& programName);
+
+//*************
+// Main program
+//*************
+
+int main(int argc, char* argv[])
+{
+  double threshold = 0.05, alpha = 0.05;
+  std::vector<std::string> fileNames;
+
+  for (int i = 1; i < argc; ++i)
+  {
+    std::string argument(argv[i]);
+    if (argument == "--help")
+    {
+      printUsage(argv[0]);
+      return 0;
+    }
+    if (argument == "--threshold" || argument == "--alpha")
+    {
+      char* end = nullptr;
+      double value = (i + 1 < argc) ? std::strtod(argv[i + 1], &end) : -1;
+      if (i + 1 == argc || *end != '\0' || !(value >= 0 && value < 1e9))
+      {
+        std::cout << "ERROR: Option '" << argument << "' lacks a valid value!" << std::endl;
+        printUsage(argv[0]);
+        return 1;
+      }
+      (argument == "--threshold" ? threshold : alpha) = value;
+      ++i;
+    }
+    else
+      fileNames.push_back(argument);
+  }
+  if (fileNames.size() < 2)
+  {
+    std::cout << "ERROR: At least two result sets are needed!" << std::endl;
+    printUsage(argv[0]);
+    return 1;
+  }
+
+  BenchmarkResultSet baseline, candidate;
+  bool regressionIsFound = false;
+  if (!readBenchmarkResultSet(fileNames[0], baseline))
+    return 1;
+  for (size_t i = 1; i < fileNames.size(); ++i)
+  {
+    if (!readBenchmarkResultSet(fileNames[i], candidate))
+      return 1;
+    std::cout << "Comparison of '" << candidate.fileName << "' (" << candidate.environment.gitRevision
+              << ") with the baseline '" << baseline.fileName << "' (" << baseline.environment.gitRevision << ")"
+              << std::endl;
+    printEnvironmentDifferences(baseline.environment, candidate.environment);
+    regressionIsFound |= compareResultSets(baseline, candidate, threshold, alpha);
+    std::cout << std::endl;
+  }
+
+  return regressionIsFound ? 2 : 0;
+}
+
+// Method that converts a comparison verdict into a string
+std::string convertToString(ComparisonVerdict verdict)
+{
+  switch (verdict)
+  {
+    case ComparisonVerdict::UNCHANGED            : return "unchanged";
+    case ComparisonVerdict::IMPROVEMENT          : return "IMPROVEMENT";
+    case ComparisonVerdict::REGRESSION           : return "REGRESSION";
+    case ComparisonVerdict::MISSING_IN_BASELINE  : return "missing in baseline";
+    case ComparisonVerdict::MISSING_IN_CANDIDATE : return "missing in candidate";
+  }
+
+  return std::string();
+}
+
+// Method that calculates the median of the values "values" (0 if there are none).
+double calculateMedian(std::vector<double> values)
+{
+  if (values.empty())
+    return 0;
+
+  std::sort(values.begin(), values.end());
+  return (values[(values.size() - 1) / 2] + values[values.size() / 2]) / 2;
+}
+
+// Method that prints a warning for each property in which the environments "baseline" and "candidate" differ.
+void printEnvironmentDifferences(const BenchmarkEnvironment& baseline, const BenchmarkEnvironment& candidate)
+{
+  const std::vector<std::vector<std::string>> properties {
+    {"processor", baseline.processor, candidate.processor},
+    {"host name", baseline.hostName, candidate.hostName},
+    {"compiler", baseline.compiler, candidate.compiler},
+    {"compiler flags", baseline.compilerFlags, candidate.compilerFlags},
+    {"orientation policy", baseline.orientationPolicy, candidate.orientationPolicy},
+    {"threads", std::to_string(baseline.numberOfThreads), std::to_string(candidate.numberOfThreads)}};
+
+  for (const std::vector<std::string>& property : properties)
+    if (property[1] != property[2])
+      std::cout << "WARNING: The " << property[0] << " differs: '" << property[1] << "' (baseline) vs. '"
+                << property[2] << "' (candidate)." << std::endl;
+}
+
+// Method that compares the runtimes of the result set "candidate" with those of the result set "baseline" and prints
+// a line for each point source, algorithm, number of points, and number of threads. It returns "true" if a regression
+// is found.
+bool compareResultSets(const BenchmarkResultSet& baseline, const BenchmarkResultSet& candidate, double threshold,
+                       double alpha)
+{
+  bool regressionIsFound = false;
+  std::vector<const BenchmarkResult*> comparedCandidateResults;
+
+  std::cout << std::left << std::setw(14) << "Points from" << std::setw(22) << "Algorithm" << std::right
+            << std::setw(11) << "Points" << std::setw(8) << "Threads" << std::setw(16) << "Baseline (ms)"
+            << std::setw(16) << "Candidate (ms)" << std::setw(10) << "Change" << std::setw(10) << "p-value"
+            << "  Verdict" << std::endl;
+  std::cout << std::fixed;
+
+  // Method that prints the comparison of the results "baselineResult" and "candidateResult"; one of them may be
+  // nullptr.
+  auto printComparison = [&](const BenchmarkResult* baselineResult, const BenchmarkResult* candidateResult)
+  {
+    const BenchmarkResult& result = (baselineResult != nullptr) ? *baselineResult : *candidateResult;
+    ComparisonVerdict verdict = ComparisonVerdict::UNCHANGED;
+    double baselineMedian = 0, candidateMedian = 0, change = 0;
+    MannWhitneyTestResult testResult;
+
+    if (baselineResult == nullptr)
+      verdict = ComparisonVerdict::MISSING_IN_BASELINE;
+    else if (candidateResult == nullptr)
+      verdict = ComparisonVerdict::MISSING_IN_CANDIDATE;
+    else
+    {
+      baselineMedian = calculateMedian(baselineResult->durationsInNanoseconds);
+      candidateMedian = calculateMedian(candidateResult->durationsInNanoseconds);
+      change = (baselineMedian > 0) ? candidateMedian / baselineMedian - 1 : 0;
+      testResult = performMannWhitneyTest(candidateResult->durationsInNanoseconds,
+                                          baselineResult->durationsInNanoseconds);
+      if (testResult.pValue < alpha && change > threshold)
+        verdict = ComparisonVerdict::REGRESSION;
+      else if (testResult.pValue < alpha && change < -threshold)
+        verdict = ComparisonVerdict::IMPROVEMENT;
+    }
+    regressionIsFound |= (verdict == ComparisonVerdict::REGRESSION);
+
+    std::cout << std::left << std::setw(14) << result.pointSource << std::setw(22) << result.algorithm << std::right
+              << std::setw(11) << result.numberOfPoints << std::setw(8) << result.numberOfThreads;
+    if (baselineResult != nullptr && candidateResult != nullptr)
+      std::cout << std::setprecision(3) << std::setw(16) << baselineMedian / 1e6 << std::setw(16)
+                << candidateMedian / 1e6 << std::setprecision(1) << std::setw(9) << std::showpos << change * 100
+                << std::noshowpos << "%" << std::setprecision(4) << std::setw(10) << testResult.pValue;
+    else
+      std::cout << std::setw(52) << "";
+    std::cout << "  " << convertToString(verdict) << std::endl;
+  };
+
+  for (const BenchmarkResult& baselineResult : baseline.results)
+  {
+    const BenchmarkResult* candidateResult = nullptr;
+    for (const BenchmarkResult& result : candidate.results)
+      if (result.pointSource == baselineResult.pointSource && result.algorithm == baselineResult.algorithm &&
+          result.numberOfPoints == baselineResult.numberOfPoints &&
+          result.numberOfThreads == baselineResult.numberOfThreads)
+        candidateResult = &result;
+    if (candidateResult != nullptr)
+      comparedCandidateResults.push_back(candidateResult);
+    printComparison(&baselineResult, candidateResult);
+  }
+  for (const BenchmarkResult& candidateResult : candidate.results)
+    if (std::find(comparedCandidateResults.begin(), comparedCandidateResults.end(), &candidateResult) ==
+        comparedCandidateResults.end())
+      printComparison(nullptr, &candidateResult);
+
+  return regressionIsFound;
+}
+
+// Method that prints the command line options of the program "programName".
+void printUsage(const std::string& programName)
+{
+  std::cout << "Usage: " << programName << " [options] BASELINE.jsonl CANDIDATE.jsonl ...\n"
+            << "  --threshold X   Minimal relative change of the median runtime of a regression or an improvement\n"
+            << "                  (default: 0.05)\n"
+            << "  --alpha X       Significance level of the Mann-Whitney U test (default: 0.05)\n"
+            << "  --help          Print this text" << std::endl;
+}
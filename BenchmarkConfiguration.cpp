@@ -0,0 +1,401 @@
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <cstdlib>      // std::strtod
+#include <iostream>
+#include <random>
+#include <sstream>
+#include <string>
+#include <vector>
+#include "BenchmarkConfiguration.h"
+#include "CacheControl.h"
+#include "LowOverheadTimer.h"
+#include "ParallelExecution.h"
+#include "PointBuffer.h"
+#include "PointHandler.h"
+#include "TimeMeasurement.h"
+
+//++++++++++++++
+// Local methods
+//++++++++++++++
+
+// Method that splits the string "str" at the commas into the strings "parts". Empty parts are dropped.
+static std::vector<std::string> splitAtCommas(const std::string& str)
+{
+  std::vector<std::string> parts;
+  std::istringstream stream(str);
+  std::string part;
+
+  while (std::getline(stream, part, ','))
+    if (!part.empty())
+      parts.push_back(part);
+
+  return parts;
+}
+
+// Method that converts the string "str" into the number "number". The method returns "false" if the string is not a
+// finite number.
+static bool parseNumber(const std::string& str, double& number)
+{
+  char* end = nullptr;
+
+  number = std::strtod(str.c_str(), &end);
+  return !str.empty() && *end == '\0' && std::isfinite(number);
+}
+
+// Method that converts the string "str" into the nonnegative integer "integer". Besides digits, the scientific
+// notation (e.g., "1e6") is accepted as long as the value is an integer. The method returns "false" otherwise.
+static bool parseInteger(const std::string& str, std::uint64_t& integer)
+{
+  double number;
+
+  if (str.find_first_not_of("0123456789") == std::string::npos && !str.empty() && str.size() < 20)
+  {
+    integer = std::stoull(str);
+    return true;
+  }
+  if (!parseNumber(str, number) || number < 0 || number >= 1e19 || number != std::floor(number))
+    return false;
+
+  integer = std::uint64_t(number);
+  return true;
+}
+
+//++++++++++++++++++++++++
+// Benchmark configuration
+//++++++++++++++++++++++++
+
+// Method that reads the benchmark configuration "configuration" from the command line arguments "argv".
+bool parseBenchmarkConfiguration(int argc, const char* const argv[], const std::vector<std::string>& algorithmNames,
+                                 BenchmarkConfiguration& configuration)
+{
+  // The adaptive sampling has a warmup run by default, unless the number of warmup runs is given. The number of runs
+  // of "--runs" is applied after all options are read, so that the result does not depend on the order of the
+  // options; 0 means that it is not given.
+  bool numberOfWarmupRunsIsGiven = false;
+  size_t numberOfFixedRuns = 0;
+
+  for (int i = 1; i < argc; ++i)
+  {
+    std::string option(argv[i]), value;
+    std::uint64_t integer;
+    double number;
+    CacheMode cacheMode;
+    ScalingMode scalingMode;
+    SamplingMode samplingMode;
+    HugePageMode hugePageMode;
+    PagePlacement pagePlacement;
+
+    if (option == "--help")
+    {
+      configuration.helpIsRequested = true;
+      continue;
+    }
+    if (option == "--counters")
+    {
+      configuration.performanceCountersAreCollected = true;
+      continue;
+    }
+    if (option == "--verify")
+    {
+      configuration.hullsAreVerified = true;
+      continue;
+    }
+    if (option == "--resume")
+    {
+      configuration.checkpointIsResumed = true;
+      continue;
+    }
+
+    // All other options have a value.
+    if (i + 1 == argc)
+    {
+      std::cout << "ERROR: Option '" << option << "' is unknown or lacks a value!" << std::endl;
+      return false;
+    }
+    value = argv[++i];
+
+    if (option == "--algorithms")
+    {
+      configuration.algorithmNames = splitAtCommas(value);
+      for (const std::string& name : configuration.algorithmNames)
+        if (std::find(algorithmNames.begin(), algorithmNames.end(), name) == algorithmNames.end())
+        {
+          std::cout << "ERROR: Convex hull algorithm '" << name << "' is unknown!" << std::endl;
+          return false;
+        }
+    }
+    else if (option == "--sizes")
+    {
+      configuration.numbersOfPoints.clear();
+      for (const std::string& size : splitAtCommas(value))
+      {
+        if (!parseInteger(size, integer) || integer == 0)
+        {
+          std::cout << "ERROR: Number of points '" << size << "' is not a positive integer!" << std::endl;
+          return false;
+        }
+        configuration.numbersOfPoints.push_back(size_t(integer));
+      }
+      // The runtime manager expects the numbers of points in increasing order.
+      std::sort(configuration.numbersOfPoints.begin(), configuration.numbersOfPoints.end());
+      configuration.numbersOfPoints.erase(std::unique(configuration.numbersOfPoints.begin(),
+                                                      configuration.numbersOfPoints.end()),
+                                          configuration.numbersOfPoints.end());
+    }
+    else if (option == "--distributions")
+    {
+      configuration.distributions.clear();
+      for (const std::string& name : splitAtCommas(value))
+      {
+        PointDistribution distribution;
+        if (!convertToPointDistribution(name, distribution))
+        {
+          std::cout << "ERROR: Point distribution '" << name << "' is unknown!" << std::endl;
+          return false;
+        }
+        configuration.distributions.push_back(distribution);
+      }
+    }
+    else if (option == "--input")
+      configuration.inputFileName = value;
+    else if (option == "--seed" && parseInteger(value, integer))
+    {
+      configuration.seed = integer;
+      configuration.seedIsGiven = true;
+    }
+    else if (option == "--threads" && parseInteger(value, integer))
+      configuration.numberOfThreads = size_t(integer);
+    else if (option == "--scaling" && convertToScalingMode(value, scalingMode) && scalingMode != ScalingMode::NONE)
+      configuration.scalingMode = scalingMode;
+    else if (option == "--thread-counts")
+    {
+      configuration.threadCounts.clear();
+      for (const std::string& count : splitAtCommas(value))
+      {
+        if (!parseInteger(count, integer) || integer == 0 || integer > 4096)
+        {
+          std::cout << "ERROR: Number of threads '" << count << "' is not a positive integer up to 4096!"
+                    << std::endl;
+          return false;
+        }
+        configuration.threadCounts.push_back(size_t(integer));
+      }
+    }
+    else if (option == "--sampling" && convertToSamplingMode(value, samplingMode))
+      configuration.samplingParameters.samplingMode = samplingMode;
+    else if (option == "--runs" && parseInteger(value, integer) && integer > 0)
+      numberOfFixedRuns = size_t(integer);
+    else if (option == "--warmup" && parseInteger(value, integer))
+    {
+      configuration.samplingParameters.numberOfWarmupRuns = size_t(integer);
+      numberOfWarmupRunsIsGiven = true;
+    }
+    else if (option == "--min-runs" && parseInteger(value, integer) && integer > 0)
+      configuration.samplingParameters.minimalNumberOfRuns = size_t(integer);
+    else if (option == "--max-runs" && parseInteger(value, integer) && integer > 0)
+      configuration.samplingParameters.maximalNumberOfRuns = size_t(integer);
+    else if (option == "--ci-width" && parseNumber(value, number) && number >= 0)
+      configuration.samplingParameters.targetRelativeConfidenceIntervalWidth = number;
+    else if (option == "--budget" && parseNumber(value, number) && number > 0 && number < 1e9)
+      configuration.samplingParameters.timeBudget = std::chrono::nanoseconds(std::int64_t(number * 1e9));
+    else if (option == "--clock" && (value == "steady" || value == "tsc"))
+      configuration.clockSource = (value == "tsc") ? ClockSource::TIME_STAMP_COUNTER : ClockSource::STEADY_CLOCK;
+    else if (option == "--cache" && convertToCacheMode(value, cacheMode))
+      configuration.cacheMode = cacheMode;
+    else if (option == "--huge-pages" && convertToHugePageMode(value, hugePageMode))
+      configuration.pointBufferParameters.hugePageMode = hugePageMode;
+    else if (option == "--page-placement" && convertToPagePlacement(value, pagePlacement))
+      configuration.pointBufferParameters.pagePlacement = pagePlacement;
+    else if (option == "--pipeline" && (value == "on" || value == "off"))
+      configuration.generationIsPipelined = (value == "on");
+    else if (option == "--output" && !value.empty())
+      configuration.outputFileName = value;
+    else if (option == "--results" && !value.empty())
+      configuration.resultsFileName = value;
+    else if (option == "--checkpoint" && !value.empty())
+      configuration.checkpointFileName = value;
+    else if (option == "--trace" && !value.empty())
+      configuration.traceFileName = value;
+    else if (option == "--trace-min-size" && parseInteger(value, integer))
+      configuration.traceParameters.minimalSpanSize = size_t(integer);
+    else if (option == "--trace-min-duration" && parseNumber(value, number) && number >= 0 && number < 1e12)
+      configuration.traceParameters.minimalSpanDuration = std::chrono::nanoseconds(std::int64_t(number * 1e3));
+    else
+    {
+      std::cout << "ERROR: Option '" << option << "' is unknown or has the invalid value '" << value << "'!"
+                << std::endl;
+      return false;
+    }
+  }
+
+  if (configuration.algorithmNames.empty())
+    configuration.algorithmNames = algorithmNames;
+  if (configuration.numbersOfPoints.empty() || configuration.distributions.empty())
+  {
+    std::cout << "ERROR: No numbers of points or no point distributions are given!" << std::endl;
+    return false;
+  }
+  if (numberOfFixedRuns > 0)
+  {
+    if (configuration.samplingParameters.samplingMode == SamplingMode::ADAPTIVE)
+    {
+      std::cout << "ERROR: The option '--runs' sets the number of runs of the fixed sampling and cannot be combined "
+                << "with adaptive sampling!" << std::endl;
+      return false;
+    }
+    configuration.samplingParameters.numberOfRuns = numberOfFixedRuns;
+  }
+  if (configuration.samplingParameters.samplingMode == SamplingMode::ADAPTIVE && !numberOfWarmupRunsIsGiven)
+    configuration.samplingParameters.numberOfWarmupRuns = 1;
+  if (configuration.samplingParameters.samplingMode == SamplingMode::ADAPTIVE &&
+      configuration.samplingParameters.minimalNumberOfRuns > configuration.samplingParameters.maximalNumberOfRuns)
+  {
+    std::cout << "ERROR: The minimal number of runs exceeds the maximal number of runs!" << std::endl;
+    return false;
+  }
+  if (configuration.scalingMode == ScalingMode::NONE)
+    configuration.threadCounts.clear();
+  else
+  {
+    if (configuration.scalingMode == ScalingMode::WEAK && !configuration.inputFileName.empty())
+    {
+      std::cout << "ERROR: Weak scaling needs generated points, since the number of points grows with the number "
+                << "of threads!" << std::endl;
+      return false;
+    }
+    if (configuration.threadCounts.empty())
+    {
+      size_t maximalNumberOfThreads = resolveNumberOfThreads(configuration.numberOfThreads);
+      for (size_t numberOfThreads = 1; numberOfThreads < maximalNumberOfThreads; numberOfThreads *= 2)
+        configuration.threadCounts.push_back(numberOfThreads);
+      configuration.threadCounts.push_back(maximalNumberOfThreads);
+    }
+    std::sort(configuration.threadCounts.begin(), configuration.threadCounts.end());
+    configuration.threadCounts.erase(std::unique(configuration.threadCounts.begin(),
+                                                 configuration.threadCounts.end()),
+                                     configuration.threadCounts.end());
+  }
+  if (configuration.checkpointIsResumed && configuration.checkpointFileName.empty())
+  {
+    std::cout << "ERROR: The option '--resume' needs a checkpoint file (option '--checkpoint')!" << std::endl;
+    return false;
+  }
+  if (!configuration.seedIsGiven)
+    configuration.seed = (std::uint64_t(std::random_device{}()) << 32) | std::random_device{}();
+
+  return true;
+}
+
+// Method that prints the command line options of the program "programName" into the stream "os".
+void printBenchmarkUsage(std::ostream& os, const std::string& programName,
+                         const std::vector<std::string>& algorithmNames)
+{
+  os << "Usage: " << programName << " [options]\n"
+     << "  --algorithms NAME,...     Tested algorithms (default: all):";
+  for (const std::string& name : algorithmNames)
+    os << " " << name;
+  os << "\n"
+     << "  --sizes N,...             Numbers of points (default: 1e4,1e5,1e6,1e7,1e8)\n"
+     << "  --distributions NAME,...  Point distributions: uniform (default), circle, degenerate\n"
+     << "  --input FILE              CSV file with the points to test instead of generated points\n"
+     << "  --seed N                  Seed of the generated points (default: random)\n"
+     << "  --threads N               Number of threads of the parallel helpers (default: all cores)\n"
+     << "  --scaling strong|weak     Run each algorithm with each number of threads of --thread-counts for the given\n"
+     << "                            numbers of points (strong) or numbers of points per thread (weak)\n"
+     << "  --thread-counts N,...     Numbers of threads of the scaling mode (default: 1,2,4,... up to --threads)\n"
+     << "  --sampling fixed|adaptive Run each algorithm a fixed number of times (default) or until the options\n"
+     << "                            below stop the adaptive sampling\n"
+     << "  --runs N                  Number of runs of the fixed sampling (default: 20)\n"
+     << "  --warmup N                Number of warmup runs (default: 0; adaptive: 1)\n"
+     << "  --min-runs N              Adaptive: minimal number of runs (default: 5)\n"
+     << "  --max-runs N              Adaptive: maximal number of runs (default: 200)\n"
+     << "  --ci-width X              Adaptive: target width of the confidence interval of the median relative to\n"
+     << "                            the median (default: 0.02)\n"
+     << "  --budget SECONDS          Adaptive: time budget per algorithm and number of points (default: 60)\n"
+     << "  --clock steady|tsc        Clock of the timer (default: steady)\n"
+     << "  --cache cold|warm         Evict the caches or read the input points before each run (default: warm)\n"
+     << "  --huge-pages MODE         Huge pages of the large point sequences: none (default), transparent, explicit\n"
+     << "  --page-placement MODE     Placement of their pages: first-touch (default), parallel, interleaved\n"
+     << "  --pipeline on|off         Generate the points of the next run in the background on a spare processor\n"
+     << "                            between the measured runs (default: off)\n"
+     << "  --output FILE             CSV file with the runtimes (default: ConvexHullAlgorithmsTest.csv)\n"
+     << "  --results FILE            JSON lines file with the runtimes and the environment for BenchmarkCompare\n"
+     << "  --checkpoint FILE         Append each measured run to the checkpoint file FILE\n"
+     << "  --resume                  Continue the performance test of the checkpoint file after its runs\n"
+     << "  --verify                  Verify the convex hull of each run (outside of the time measurement)\n"
+     << "  --counters                Collect performance counters (cycles, instructions, misses) for each run\n"
+     << "  --trace FILE              Chrome trace file with the spans of the first measured run of each algorithm\n"
+     << "                            and number of points\n"
+     << "  --trace-min-size N        Minimal number of points of a recorded span (default: 1000)\n"
+     << "  --trace-min-duration US   Minimal duration of a recorded span in microseconds (default: 0)\n"
+     << "  --help                    Print this text" << std::endl;
+}
+
+// Method that converts a point distribution into its name.
+std::string convertToString(PointDistribution distribution)
+{
+  switch (distribution)
+  {
+    case PointDistribution::UNIFORM    : return "uniform";
+    case PointDistribution::CIRCLE     : return "circle";
+    case PointDistribution::DEGENERATE : return "degenerate";
+  }
+
+  return std::string();
+}
+
+// Method that converts a name into a point distribution.
+bool convertToPointDistribution(const std::string& name, PointDistribution& distribution)
+{
+  for (PointDistribution candidate : {PointDistribution::UNIFORM, PointDistribution::CIRCLE,
+                                      PointDistribution::DEGENERATE})
+    if (convertToString(candidate) == name)
+    {
+      distribution = candidate;
+      return true;
+    }
+
+  return false;
+}
+
+// Method that converts a scaling mode into its name.
+std::string convertToString(ScalingMode scalingMode)
+{
+  switch (scalingMode)
+  {
+    case ScalingMode::NONE   : return "none";
+    case ScalingMode::STRONG : return "strong";
+    case ScalingMode::WEAK   : return "weak";
+  }
+
+  return std::string();
+}
+
+// Method that converts a name into a scaling mode.
+bool convertToScalingMode(const std::string& name, ScalingMode& scalingMode)
+{
+  for (ScalingMode candidate : {ScalingMode::NONE, ScalingMode::STRONG, ScalingMode::WEAK})
+    if (convertToString(candidate) == name)
+    {
+      scalingMode = candidate;
+      return true;
+    }
+
+  return false;
+}
+
+// Method that converts a name into a sampling mode.
+bool convertToSamplingMode(const std::string& name, SamplingMode& samplingMode)
+{
+  for (SamplingMode candidate : {SamplingMode::FIXED, SamplingMode::ADAPTIVE})
+    if (convertToString(candidate) == name)
+    {
+      samplingMode = candidate;
+      return true;
+    }
+
+  return false;
+}
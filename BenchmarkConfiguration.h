@@ -0,0 +1,123 @@
+#ifndef BENCHMARKCONFIGURATION_H
+#define BENCHMARKCONFIGURATION_H
+
+
+#include <cstdint>
+#include <ostream>
+#include <string>
+#include <vector>
+#include "CacheControl.h"
+#include "LowOverheadTimer.h"
+#include "PointBuffer.h"
+#include "PointHandler.h"
+#include "TimeMeasurement.h"
+#include "TraceRecorder.h"
+
+// A benchmark configuration keeps the settings of a performance test of the convex hull algorithms. It is read from
+// the command line, so that the tested algorithms, numbers of points, point distributions, and so on can be changed
+// without recompiling. The options are:
+//   --algorithms NAME,...      Tested algorithms (see "ConvexHullRegistry.h"); all algorithms by default.
+//   --sizes N,...              Numbers of points, e.g., "10000,1e6"; 1e4, 1e5, 1e6, 1e7, and 1e8 by default.
+//   --distributions NAME,...   Point distributions: "uniform" (default), "circle", and "degenerate".
+//   --input FILE               CSV file with the points to test (see "PointIO.h") instead of generated points.
+//   --seed N                   Seed of the generated points; the run number is added for each run. Random by default.
+//   --threads N                Number of threads of the parallel helpers (see "ParallelExecution.h").
+//   --scaling strong|weak      Thread scaling mode: each algorithm runs with each number of threads of
+//                              "--thread-counts" on pinned threads, either for the given numbers of points (strong
+//                              scaling) or for the given numbers of points per thread (weak scaling).
+//   --thread-counts N,...      Numbers of threads of the scaling mode; 1, 2, 4, ..., and the number of threads of
+//                              "--threads" by default.
+//   --sampling fixed|adaptive  Run each algorithm a fixed number of times (default) or sample its runs adaptively
+//                              (see "SamplingParameters" in "TimeMeasurement.h").
+//   --runs N                   Number of runs of the fixed sampling; 20 by default.
+//   --warmup N                 Number of warmup runs; 0 by default, 1 with adaptive sampling.
+//   --min-runs N, --max-runs N, --ci-width X, --budget SECONDS
+//                              Parameters of the adaptive sampling.
+//   --clock steady|tsc         Clock of the timer (see "LowOverheadTimer.h").
+//   --cache cold|warm          State of the caches before each run (see "CacheControl.h").
+//   --huge-pages none|transparent|explicit, --page-placement first-touch|parallel|interleaved
+//                              Allocation of the large point sequences (see "PointBuffer.h").
+//   --pipeline on|off          Generate the points of the next run in a background thread between the measured runs
+//                              (see "PointGenerationPipeline.h"); off by default.
+//   --output FILE              Name of the CSV file with the runtimes.
+//   --results FILE             Name of a JSON lines file with the runtimes and the environment for comparisons (see
+//                              "BenchmarkResults.h").
+//   --checkpoint FILE          Append each measured run to a checkpoint file (see "BenchmarkCheckpoint.h").
+//   --resume                   Reload the runs of the checkpoint file and continue the performance test after them.
+//   --verify                   Verify the convex hull of each run (see "HullVerification.h").
+//   --counters                 Collect performance counters for each run (see "PerformanceCounters.h").
+//   --trace FILE               Write the spans of the first measured run of each algorithm and number of points into
+//                              a Chrome trace file (see "TraceRecorder.h").
+//   --trace-min-size N, --trace-min-duration MICROSECONDS
+//                              Minimal size and duration of the recorded spans.
+//   --help                     Print the options.
+
+// Type that indicates whether and how the scaling of the algorithms with the number of threads is measured.
+enum class ScalingMode {NONE, STRONG, WEAK};
+
+struct BenchmarkConfiguration
+{
+  // Names of the tested convex hull algorithms; empty if all algorithms are tested.
+  std::vector<std::string> algorithmNames;
+  // Numbers of points for which the algorithms are tested in increasing order.
+  std::vector<size_t> numbersOfPoints {10000, 100000, 1000000, 10000000, 100000000};
+  std::vector<PointDistribution> distributions {PointDistribution::UNIFORM};
+  // Name of the CSV file with the points to test; empty if the points are generated.
+  std::string inputFileName;
+  std::uint64_t seed = 0;
+  // Flag that indicates whether the seed was given; otherwise, it is random or taken from the resumed checkpoint.
+  bool seedIsGiven = false;
+  // Number of threads of the parallel helpers; 0 means the default number of threads.
+  size_t numberOfThreads = 0;
+  ScalingMode scalingMode = ScalingMode::NONE;
+  // Numbers of threads of the scaling mode in increasing order; empty if the scaling is not measured.
+  std::vector<size_t> threadCounts;
+  SamplingParameters samplingParameters;
+  ClockSource clockSource = ClockSource::STEADY_CLOCK;
+  CacheMode cacheMode = CacheMode::WARM;
+  PointBufferParameters pointBufferParameters;
+  // Flag that indicates whether the points are generated in a background thread if there is a spare processor.
+  bool generationIsPipelined = false;
+  std::string outputFileName = "ConvexHullAlgorithmsTest.csv";
+  // Name of the JSON lines file with the results; empty if no such file is written.
+  std::string resultsFileName;
+  // Name of the checkpoint file; empty if no checkpoint is written.
+  std::string checkpointFileName;
+  // Flag that indicates whether the performance test is resumed from the checkpoint file.
+  bool checkpointIsResumed = false;
+  // Flag that indicates whether the convex hull of each run is verified.
+  bool hullsAreVerified = false;
+  // Flag that indicates whether performance counters are collected for each run.
+  bool performanceCountersAreCollected = false;
+  // Name of the Chrome trace file; empty if no spans are recorded.
+  std::string traceFileName;
+  TraceParameters traceParameters;
+  // Flag that indicates whether the option "--help" was given.
+  bool helpIsRequested = false;
+};
+
+// Method that reads the benchmark configuration "configuration" from the command line arguments "argv" (the first one
+// is the program name). "algorithmNames" are the names of the known convex hull algorithms. If no seed is given, a
+// random seed is chosen. If an argument is invalid, the method prints an error message and returns "false".
+bool parseBenchmarkConfiguration(int argc, const char* const argv[], const std::vector<std::string>& algorithmNames,
+                                 BenchmarkConfiguration& configuration);
+
+// Method that prints the command line options of the program "programName" into the stream "os".
+void printBenchmarkUsage(std::ostream& os, const std::string& programName,
+                         const std::vector<std::string>& algorithmNames);
+
+// Methods that convert a point distribution into its name and a name into a point distribution. The latter method
+// returns "false" if the name is unknown.
+std::string convertToString(PointDistribution distribution);
+bool convertToPointDistribution(const std::string& name, PointDistribution& distribution);
+
+// Methods that convert a scaling mode into its name and a name into a scaling mode. The latter method returns "false"
+// if the name is unknown.
+std::string convertToString(ScalingMode scalingMode);
+bool convertToScalingMode(const std::string& name, ScalingMode& scalingMode);
+
+// Method that converts a name into a sampling mode (see "convertToString" in "TimeMeasurement.h"). It returns "false"
+// if the name is unknown.
+bool convertToSamplingMode(const std::string& name, SamplingMode& samplingMode);
+
+#endif // BENCHMARKCONFIGURATION_H
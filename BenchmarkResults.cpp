@@ -0,0 +1,427 @@
+
+#include <algorithm>
+#include <cmath>
+#include <cstdio>       // popen
+#include <cstdlib>      // std::strtod
+#include <ctime>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <utility>
+#include <vector>
+#include <unistd.h>     // gethostname
+#if defined(__APPLE__)
+#include <sys/sysctl.h>
+#endif
+#include "BenchmarkResults.h"
+
+// Compiler command with its flags; the makefile defines it for this file.
+#ifndef BENCHMARK_COMPILER_FLAGS
+#define BENCHMARK_COMPILER_FLAGS "unknown"
+#endif
+
+//++++++++++++++++++++++++
+// Local types and methods
+//++++++++++++++++++++++++
+
+// Type that keeps a JSON value. Only the members of the type of the value are used.
+struct JSONValue
+{
+  enum class Type {NULL_VALUE, BOOLEAN, NUMBER, STRING, ARRAY, OBJECT};
+
+  Type type = Type::NULL_VALUE;
+  bool boolean = false;
+  double number = 0;
+  std::string str;
+  std::vector<JSONValue> elements;
+  std::vector<std::pair<std::string, JSONValue>> members;
+
+  // Method that returns the member with the name "name" of an object or nullptr if there is none.
+  const JSONValue* findMember(const std::string& name) const
+  {
+    for (const std::pair<std::string, JSONValue>& member : members)
+      if (member.first == name)
+        return &member.second;
+    return nullptr;
+  }
+};
+
+// Type that parses a JSON text by recursive descent. Escaped characters beyond ASCII are replaced by '?'.
+class JSONParser
+{
+  public:
+    explicit JSONParser(const std::string& text) : text(text), position(0) {}
+
+    // Method that parses the whole text into the value "value". It returns "false" if the text is not valid JSON.
+    bool parse(JSONValue& value)
+    {
+      if (!parseValue(value))
+        return false;
+      skipWhitespace();
+      return position == text.size();
+    }
+
+  private:
+    const std::string& text;
+    size_t position;
+
+    void skipWhitespace()
+    {
+      while (position < text.size() && std::string(" \t\r\n").find(text[position]) != std::string::npos)
+        ++position;
+    }
+
+    bool consume(char c)
+    {
+      skipWhitespace();
+      if (position < text.size() && text[position] == c)
+      {
+        ++position;
+        return true;
+      }
+      return false;
+    }
+
+    bool consumeWord(const std::string& word)
+    {
+      if (text.compare(position, word.size(), word) != 0)
+        return false;
+      position += word.size();
+      return true;
+    }
+
+    bool parseString(std::string& str)
+    {
+      if (!consume('"'))
+        return false;
+      str.clear();
+      while (position < text.size() && text[position] != '"')
+      {
+        char c = text[position++];
+        if (c == '\\')
+        {
+          if (position == text.size())
+            return false;
+          c = text[position++];
+          switch (c)
+          {
+            case 'b' : c = '\b'; break;
+            case 'f' : c = '\f'; break;
+            case 'n' : c = '\n'; break;
+            case 'r' : c = '\r'; break;
+            case 't' : c = '\t'; break;
+            case 'u' :
+            {
+              if (position + 4 > text.size())
+                return false;
+              long code = std::strtol(text.substr(position, 4).c_str(), nullptr, 16);
+              c = (code < 0x80) ? char(code) : '?';
+              position += 4;
+              break;
+            }
+            default : break;
+          }
+        }
+        str += c;
+      }
+      return consume('"');
+    }
+
+    bool parseValue(JSONValue& value)
+    {
+      skipWhitespace();
+      if (position == text.size())
+        return false;
+
+      char c = text[position];
+      if (c == '{')
+      {
+        value.type = JSONValue::Type::OBJECT;
+        ++position;
+        if (consume('}'))
+          return true;
+        do
+        {
+          value.members.emplace_back();
+          if (!parseString(value.members.back().first) || !consume(':') || !parseValue(value.members.back().second))
+            return false;
+        } while (consume(','));
+        return consume('}');
+      }
+      if (c == '[')
+      {
+        value.type = JSONValue::Type::ARRAY;
+        ++position;
+        if (consume(']'))
+          return true;
+        do
+        {
+          value.elements.emplace_back();
+          if (!parseValue(value.elements.back()))
+            return false;
+        } while (consume(','));
+        return consume(']');
+      }
+      if (c == '"')
+      {
+        value.type = JSONValue::Type::STRING;
+        return parseString(value.str);
+      }
+      if (consumeWord("null"))
+        return true;
+      if (consumeWord("true") || consumeWord("false"))
+      {
+        value.type = JSONValue::Type::BOOLEAN;
+        // "true" is the only word whose second last letter is 'u'.
+        value.boolean = (text[position - 2] == 'u');
+        return true;
+      }
+
+      const char* begin = text.c_str() + position;
+      char* end = nullptr;
+      value.type = JSONValue::Type::NUMBER;
+      value.number = std::strtod(begin, &end);
+      position += size_t(end - begin);
+      return end != begin;
+    }
+};
+
+// Method that returns the string member "name" of the JSON object "object" (empty if there is none).
+static std::string getStringMember(const JSONValue& object, const std::string& name)
+{
+  const JSONValue* member = object.findMember(name);
+
+  return (member != nullptr && member->type == JSONValue::Type::STRING) ? member->str : std::string();
+}
+
+// Method that returns the number member "name" of the JSON object "object" (0 if there is none).
+static double getNumberMember(const JSONValue& object, const std::string& name)
+{
+  const JSONValue* member = object.findMember(name);
+
+  return (member != nullptr && member->type == JSONValue::Type::NUMBER) ? member->number : 0;
+}
+
+// Method that returns the first line of the output of the shell command "command" (empty if it fails).
+static std::string readCommandOutput(const std::string& command)
+{
+  std::string output;
+  char buffer[256];
+  FILE* pipe = popen(command.c_str(), "r");
+
+  if (pipe == nullptr)
+    return output;
+  while (fgets(buffer, sizeof(buffer), pipe) != nullptr)
+    output += buffer;
+  pclose(pipe);
+
+  return output.substr(0, output.find('\n'));
+}
+
+// Method that returns the model name of the processor.
+static std::string getProcessorName()
+{
+#if defined(__APPLE__)
+  char name[256];
+  size_t size = sizeof(name);
+  if (sysctlbyname("machdep.cpu.brand_string", name, &size, nullptr, 0) == 0)
+    return std::string(name);
+#else
+  std::ifstream cpuInfo("/proc/cpuinfo");
+  std::string line;
+  while (std::getline(cpuInfo, line))
+    if (line.compare(0, 10, "model name") == 0 && line.find(':') != std::string::npos)
+      return line.substr(line.find_first_not_of(" \t", line.find(':') + 1));
+#endif
+
+  return "unknown";
+}
+
+//++++++++++++++++++
+// Benchmark results
+//++++++++++++++++++
+
+// Method that returns the environment of the running program.
+BenchmarkEnvironment getBenchmarkEnvironment()
+{
+  BenchmarkEnvironment environment;
+  char hostName[256] = "";
+  char startTime[32] = "";
+  std::time_t now = std::time(nullptr);
+  std::tm utcTime;
+
+  environment.processor = getProcessorName();
+  if (gethostname(hostName, sizeof(hostName) - 1) == 0)
+    environment.hostName = hostName;
+#if defined(__clang__)
+  environment.compiler = "clang " __clang_version__;
+#elif defined(__GNUC__)
+  environment.compiler = "gcc " __VERSION__;
+#else
+  environment.compiler = "unknown";
+#endif
+  environment.compilerFlags = BENCHMARK_COMPILER_FLAGS;
+  environment.gitRevision = readCommandOutput("git rev-parse --short HEAD 2>/dev/null");
+  if (environment.gitRevision.empty())
+    environment.gitRevision = "unknown";
+  else if (!readCommandOutput("git status --porcelain --untracked-files=no 2>/dev/null").empty())
+    environment.gitRevision += "-dirty";
+  if (gmtime_r(&now, &utcTime) != nullptr)
+    std::strftime(startTime, sizeof(startTime), "%Y-%m-%dT%H:%M:%SZ", &utcTime);
+  environment.startTime = startTime;
+
+  return environment;
+}
+
+// Method that converts the environment "environment" into a JSON object.
+std::string convertToJSONObject(const BenchmarkEnvironment& environment)
+{
+  return "{\"processor\":" + convertToJSONString(environment.processor) +
+         ",\"hostName\":" + convertToJSONString(environment.hostName) +
+         ",\"compiler\":" + convertToJSONString(environment.compiler) +
+         ",\"compilerFlags\":" + convertToJSONString(environment.compilerFlags) +
+         ",\"orientationPolicy\":" + convertToJSONString(environment.orientationPolicy) +
+         ",\"threads\":" + std::to_string(environment.numberOfThreads) +
+         ",\"gitRevision\":" + convertToJSONString(environment.gitRevision) +
+         ",\"startTime\":" + convertToJSONString(environment.startTime) + "}";
+}
+
+// Method that converts the string "str" into a JSON string. Control characters are replaced by blanks.
+std::string convertToJSONString(const std::string& str)
+{
+  std::string jsonStr("\"");
+
+  for (char c : str)
+    if (c == '"' || c == '\\')
+      jsonStr += std::string("\\") + c;
+    else if (static_cast<unsigned char>(c) < 0x20)
+      jsonStr += ' ';
+    else
+      jsonStr += c;
+
+  return jsonStr + "\"";
+}
+
+// Method that reads the result set "resultSet" from the JSON lines file "fileName".
+bool readBenchmarkResultSet(const std::string& fileName, BenchmarkResultSet& resultSet)
+{
+  std::ifstream inputFile(fileName);
+  std::string line;
+  size_t lineNumber = 0;
+
+  if (!inputFile)
+  {
+    std::cout << "ERROR: File '" << fileName << "' cannot be read!" << std::endl;
+    return false;
+  }
+
+  resultSet = BenchmarkResultSet();
+  resultSet.fileName = fileName;
+  while (std::getline(inputFile, line))
+  {
+    ++lineNumber;
+    if (line.find_first_not_of(" \t\r") == std::string::npos)
+      continue;
+
+    JSONValue object;
+    const JSONValue* durations;
+    if (!JSONParser(line).parse(object) || object.type != JSONValue::Type::OBJECT ||
+        (durations = object.findMember("durationsNs")) == nullptr || durations->type != JSONValue::Type::ARRAY)
+    {
+      std::cout << "ERROR: Line " << lineNumber << " of file '" << fileName << "' is no benchmark result!"
+                << std::endl;
+      return false;
+    }
+
+    const JSONValue* environment = object.findMember("environment");
+    if (resultSet.results.empty())
+    {
+      if (environment != nullptr)
+      {
+        resultSet.environment.processor = getStringMember(*environment, "processor");
+        resultSet.environment.hostName = getStringMember(*environment, "hostName");
+        resultSet.environment.compiler = getStringMember(*environment, "compiler");
+        resultSet.environment.compilerFlags = getStringMember(*environment, "compilerFlags");
+        resultSet.environment.orientationPolicy = getStringMember(*environment, "orientationPolicy");
+        resultSet.environment.numberOfThreads = size_t(getNumberMember(*environment, "threads"));
+        resultSet.environment.gitRevision = getStringMember(*environment, "gitRevision");
+        resultSet.environment.startTime = getStringMember(*environment, "startTime");
+      }
+    }
+
+    BenchmarkResult result;
+    result.pointSource = getStringMember(object, "pointSource");
+    result.algorithm = getStringMember(object, "algorithm");
+    result.numberOfPoints = size_t(getNumberMember(object, "numberOfElements"));
+    if (environment != nullptr)
+      result.numberOfThreads = size_t(getNumberMember(*environment, "threads"));
+    for (const JSONValue& duration : durations->elements)
+      if (duration.type == JSONValue::Type::NUMBER)
+        result.durationsInNanoseconds.push_back(duration.number);
+
+    std::vector<BenchmarkResult>::iterator it =
+      std::find_if(resultSet.results.begin(), resultSet.results.end(), [&](const BenchmarkResult& existingResult)
+                   {
+                     return existingResult.pointSource == result.pointSource &&
+                            existingResult.algorithm == result.algorithm &&
+                            existingResult.numberOfPoints == result.numberOfPoints &&
+                            existingResult.numberOfThreads == result.numberOfThreads;
+                   });
+    if (it == resultSet.results.end())
+      resultSet.results.push_back(result);
+    else
+      it->durationsInNanoseconds.insert(it->durationsInNanoseconds.end(), result.durationsInNanoseconds.begin(),
+                                        result.durationsInNanoseconds.end());
+  }
+
+  return true;
+}
+
+// Method that performs a two-sided Mann-Whitney U test of the samples "firstSample" and "secondSample". The values of
+// both samples are ranked together (tied values get their mean rank); U is the rank sum of the first sample minus its
+// minimal value. Under the null hypothesis, U has the mean n1 * n2 / 2 and the variance
+// n1 * n2 / 12 * ((n + 1) - sum (t^3 - t) / (n * (n - 1))), where t runs over the sizes of the groups of tied values.
+MannWhitneyTestResult performMannWhitneyTest(const std::vector<double>& firstSample,
+                                             const std::vector<double>& secondSample)
+{
+  MannWhitneyTestResult result;
+  double n1 = double(firstSample.size()), n2 = double(secondSample.size()), n = n1 + n2;
+
+  if (firstSample.empty() || secondSample.empty())
+    return result;
+
+  // Rank the values; the flag indicates whether a value belongs to the first sample.
+  std::vector<std::pair<double, bool>> values;
+  for (double value : firstSample)
+    values.emplace_back(value, true);
+  for (double value : secondSample)
+    values.emplace_back(value, false);
+  std::sort(values.begin(), values.end());
+
+  double rankSumOfFirstSample = 0, tieCorrection = 0;
+  for (size_t i = 0; i < values.size();)
+  {
+    size_t j = i;
+    while (j < values.size() && values[j].first == values[i].first)
+      ++j;
+    double meanRank = double(i + j + 1) / 2, t = double(j - i);
+    for (size_t k = i; k < j; ++k)
+      if (values[k].second)
+        rankSumOfFirstSample += meanRank;
+    tieCorrection += t * t * t - t;
+    i = j;
+  }
+
+  result.u = rankSumOfFirstSample - n1 * (n1 + 1) / 2;
+  double mean = n1 * n2 / 2;
+  double variance = n1 * n2 / 12 * ((n + 1) - ((n > 1) ? tieCorrection / (n * (n - 1)) : 0));
+  if (variance <= 0)
+    return result;
+
+  double deviation = std::fabs(result.u - mean);
+  result.z = std::copysign(std::max(deviation - 0.5, 0.0) / std::sqrt(variance), result.u - mean);
+  result.pValue = std::min(1.0, std::erfc(std::fabs(result.z) / std::sqrt(2.0)));
+
+  return result;
+}
@@ -0,0 +1,91 @@
+#ifndef BENCHMARKRESULTS_H
+#define BENCHMARKRESULTS_H
+
+
+#include <cstddef>
+#include <string>
+#include <vector>
+
+// Benchmark results are the runtimes of the runs of the convex hull algorithms together with the environment in which
+// they were measured. The performance test writes them in the JSON lines format (see
+// "AlgorithmRuntimeManager::writeToJSONLinesFile" in "TimeMeasurement.h"): each line is a JSON object with the
+// members "environment" (see "BenchmarkEnvironment"), "pointSource" (the point distribution or the input file), the
+// name of the algorithm, the number of points, the runtimes of the runs in nanoseconds, and the values of the metrics.
+// A file with such lines is a result set.
+//
+// Result sets of two versions of the library (or of two machines) are compared with the program "BenchmarkCompare"
+// (see "BenchmarkCompare.cpp"). For each point source, algorithm, and number of points, the runtimes are compared
+// with the Mann-Whitney U test, which neither assumes normally distributed runtimes nor is disturbed by single slow
+// runs.
+
+// Type that keeps the environment in which the benchmark results were measured.
+struct BenchmarkEnvironment
+{
+  // Model name of the processor.
+  std::string processor;
+  std::string hostName;
+  // Compiler version and the compiler command with its flags (see "makefile").
+  std::string compiler;
+  std::string compilerFlags;
+  // Orientation policy of the tested algorithms (see "OrientationPredicates.h").
+  std::string orientationPolicy;
+  size_t numberOfThreads = 0;
+  // Git revision of the working directory; "-dirty" is appended if tracked files are modified.
+  std::string gitRevision;
+  // Start of the benchmark in UTC in the ISO 8601 format.
+  std::string startTime;
+};
+
+// Type that keeps the runtimes of an algorithm for a point source and a number of points.
+struct BenchmarkResult
+{
+  std::string pointSource;
+  std::string algorithm;
+  size_t numberOfPoints = 0;
+  // Number of threads of the environment of the result (see "--scaling" in "BenchmarkConfiguration.h").
+  size_t numberOfThreads = 0;
+  std::vector<double> durationsInNanoseconds;
+};
+
+// Type that keeps the results of a result set. Results with the same point source, algorithm, number of points, and
+// number of threads (e.g., of appended runs) are merged.
+struct BenchmarkResultSet
+{
+  std::string fileName;
+  // Environment of the first result; the numbers of threads of the results may differ from it.
+  BenchmarkEnvironment environment;
+  std::vector<BenchmarkResult> results;
+};
+
+// Type that keeps the result of a Mann-Whitney U test.
+struct MannWhitneyTestResult
+{
+  // Statistic U of the first sample, i.e., the number of pairs in which the value of the first sample is larger
+  // (ties count one half).
+  double u = 0;
+  // Standardized statistic and two-sided p-value of the normal approximation with tie and continuity corrections.
+  double z = 0;
+  double pValue = 1;
+};
+
+// Method that returns the environment of the running program. The orientation policy and the number of threads are
+// not known here and are left empty.
+BenchmarkEnvironment getBenchmarkEnvironment();
+
+// Method that converts the environment "environment" into a JSON object.
+std::string convertToJSONObject(const BenchmarkEnvironment& environment);
+
+// Method that converts the string "str" into a JSON string (with quotes).
+std::string convertToJSONString(const std::string& str);
+
+// Method that reads the result set "resultSet" from the JSON lines file "fileName". Empty lines are skipped. If the
+// file cannot be read or a line is invalid, the method prints an error message and returns "false".
+bool readBenchmarkResultSet(const std::string& fileName, BenchmarkResultSet& resultSet);
+
+// Method that performs a two-sided Mann-Whitney U test of the samples "firstSample" and "secondSample". The normal
+// approximation is reasonable from about five values per sample on; for fewer values, the p-value is only a rough
+// indication. If a sample is empty, the p-value is 1.
+MannWhitneyTestResult performMannWhitneyTest(const std::vector<double>& firstSample,
+                                             const std::vector<double>& secondSample);
+
+#endif // BENCHMARKRESULTS_H
@@ -0,0 +1,116 @@
+
+#include <algorithm>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <unistd.h>     // sysconf
+#if defined(__APPLE__)
+#include <sys/sysctl.h>
+#endif
+#include "CacheControl.h"
+#include "ParallelExecution.h"
+
+//+++++++++++++++++++++++
+// Local data and methods
+//+++++++++++++++++++++++
+
+// Size of a cache line; a larger value than the actual one would leave cache lines untouched.
+constexpr size_t CACHE_LINE_SIZE = 64;
+
+// Buffer that is swept to evict the caches and its size.
+static std::unique_ptr<unsigned char[]> evictionBuffer;
+static size_t evictionBufferSize = 0;
+
+// Sum of the bytes read by "touchMemory"; writing it keeps the compiler from dropping the reads.
+static volatile unsigned char touchedMemorySum = 0;
+
+// Method that returns the size of the last level cache in bytes (0 if it is unknown).
+static size_t getLastLevelCacheSize()
+{
+  return (getCacheSize(3) > 0) ? getCacheSize(3) : getCacheSize(2);
+}
+
+//++++++++++++++
+// Cache control
+//++++++++++++++
+
+// Method that converts a cache mode into its name.
+std::string convertToString(CacheMode cacheMode)
+{
+  switch (cacheMode)
+  {
+    case CacheMode::COLD : return "cold";
+    case CacheMode::WARM : return "warm";
+  }
+
+  return std::string();
+}
+
+// Method that converts a name into a cache mode.
+bool convertToCacheMode(const std::string& name, CacheMode& cacheMode)
+{
+  for (CacheMode candidate : {CacheMode::COLD, CacheMode::WARM})
+    if (convertToString(candidate) == name)
+    {
+      cacheMode = candidate;
+      return true;
+    }
+
+  return false;
+}
+
+// Method that returns the size of the data cache of the level "level" in bytes.
+size_t getCacheSize(size_t level)
+{
+  long cacheSize = 0;
+
+#if defined(__APPLE__)
+  const char* names[] = {"hw.l1dcachesize", "hw.l2cachesize", "hw.l3cachesize"};
+  std::int64_t size = 0;
+  size_t sizeOfSize = sizeof(size);
+  if (level >= 1 && level <= 3 && sysctlbyname(names[level - 1], &size, &sizeOfSize, nullptr, 0) == 0)
+    cacheSize = long(size);
+#elif defined(_SC_LEVEL1_DCACHE_SIZE)
+  const int names[] = {_SC_LEVEL1_DCACHE_SIZE, _SC_LEVEL2_CACHE_SIZE, _SC_LEVEL3_CACHE_SIZE};
+  if (level >= 1 && level <= 3)
+    cacheSize = sysconf(names[level - 1]);
+#endif
+
+  return (cacheSize > 0) ? size_t(cacheSize) : 0;
+}
+
+// Method that evicts the caches by writing to every cache line of a buffer that is twice as large as the last level
+// cache.
+void evictCaches()
+{
+  if (! evictionBuffer)
+  {
+    size_t lastLevelCacheSize = getLastLevelCacheSize();
+    evictionBufferSize = (lastLevelCacheSize > 0) ? std::max<size_t>(2 * lastLevelCacheSize, size_t(1) << 23)
+                                                  : size_t(1) << 26;
+    evictionBuffer.reset(new unsigned char[evictionBufferSize]());
+  }
+
+  size_t numberOfThreads = resolveNumberOfThreads(0);
+  unsigned char* buffer = evictionBuffer.get();
+  runInParallel(numberOfThreads, [&](size_t threadIndex)
+  {
+    size_t begin = getPartBegin(evictionBufferSize, numberOfThreads, threadIndex);
+    size_t end = getPartBegin(evictionBufferSize, numberOfThreads, threadIndex + 1);
+    for (size_t i = begin; i < end; i += CACHE_LINE_SIZE)
+      ++buffer[i];
+  });
+}
+
+// Method that reads the "numberOfBytes" bytes of memory starting at "memory" once. One byte per cache line is read.
+void touchMemory(const void* memory, size_t numberOfBytes)
+{
+  const volatile unsigned char* bytes = static_cast<const volatile unsigned char*>(memory);
+  unsigned char sum = 0;
+
+  for (size_t i = 0; i < numberOfBytes; i += CACHE_LINE_SIZE)
+    sum += bytes[i];
+  if (numberOfBytes > 0)
+    sum += bytes[numberOfBytes - 1];
+  touchedMemorySum = sum;
+}
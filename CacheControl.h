@@ -0,0 +1,75 @@
+#ifndef CACHECONTROL_H
+#define CACHECONTROL_H
+
+
+#include <algorithm>
+#include <cstddef>
+#include <string>
+#include <vector>
+#include "ParallelExecution.h"
+
+// The cache control puts the caches into a defined state before a convex hull algorithm runs, so that the measured
+// runtimes do not depend on what happened to be in the caches:
+// - COLD: the caches are evicted by writing to every cache line of a buffer that is twice as large as the last level
+//   cache (at least 8 MiB; 64 MiB if its size is unknown). Each thread of "runInParallel" (see "ParallelExecution.h")
+//   sweeps a part of the buffer, so that the private caches of the cores are evicted, too. The input points are only
+//   in the main memory when the algorithm starts. The buffer stays allocated, so it is part of the peak resident set
+//   size of cold runs (see "MemoryAccounting.h").
+// - WARM: the input points are read once by the calling thread, so that as many of them as fit are in the caches and
+//   their pages are in the TLB when the algorithm starts.
+//
+// Since the in place algorithms reorder the points, the input of each run is restored from the original points. The
+// restore copies the points in parallel, so that it costs much less than a run even for 100000000 points.
+
+// Type that indicates the state of the caches before a run.
+enum class CacheMode {COLD, WARM};
+
+// Methods that convert a cache mode into its name and a name into a cache mode. The latter method returns "false" if
+// the name is unknown.
+std::string convertToString(CacheMode cacheMode);
+bool convertToCacheMode(const std::string& name, CacheMode& cacheMode);
+
+// Method that returns the size of the data cache of the level "level" (1, 2, or 3) in bytes; 0 if it is unknown.
+size_t getCacheSize(size_t level);
+
+// Method that evicts the caches by sweeping a buffer. The buffer is allocated at the first call.
+void evictCaches();
+
+// Method that reads the "numberOfBytes" bytes of memory starting at "memory" once.
+void touchMemory(const void* memory, size_t numberOfBytes);
+
+// Minimal number of points per thread of a parallel restore; smaller restores are not worth starting threads.
+constexpr size_t MINIMAL_NUMBER_OF_POINTS_PER_RESTORE_THREAD = size_t(1) << 18;
+
+// Method that restores the input "pointSeq" of a run from the original points "originalPointSeq". Each thread of
+// "runInParallel" copies a consecutive part of the points, so that the restore is limited by the memory bandwidth
+// rather than by a single core. The input may have another allocator than the original points (e.g., a point buffer,
+// see "PointBuffer.h").
+template <typename PointType, typename OriginalAllocator, typename Allocator>
+void restorePointSequence(const std::vector<PointType, OriginalAllocator>& originalPointSeq,
+                          std::vector<PointType, Allocator>& pointSeq)
+{
+  size_t numberOfPoints = originalPointSeq.size();
+  size_t numberOfThreads = std::min(resolveNumberOfThreads(0),
+                                    std::max<size_t>(1, numberOfPoints / MINIMAL_NUMBER_OF_POINTS_PER_RESTORE_THREAD));
+
+  pointSeq.resize(numberOfPoints);
+  runInParallel(numberOfThreads, [&](size_t threadIndex)
+  {
+    size_t begin = getPartBegin(numberOfPoints, numberOfThreads, threadIndex);
+    size_t end = getPartBegin(numberOfPoints, numberOfThreads, threadIndex + 1);
+    std::copy(originalPointSeq.begin() + begin, originalPointSeq.begin() + end, pointSeq.begin() + begin);
+  });
+}
+
+// Method that puts the caches into the state of the cache mode "cacheMode" before a run with the input "pointSeq".
+template <typename PointType, typename Allocator>
+void prepareCaches(CacheMode cacheMode, const std::vector<PointType, Allocator>& pointSeq)
+{
+  if (cacheMode == CacheMode::COLD)
+    evictCaches();
+  else
+    touchMemory(pointSeq.data(), pointSeq.size() * sizeof(PointType));
+}
+
+#endif // CACHECONTROL_H
@@ -0,0 +1,159 @@
+
+#include <algorithm>
+#include <cmath>
+#include <iomanip>
+#include <sstream>
+#include <string>
+#include <utility>
+#include <vector>
+#include "ComplexityAnalysis.h"
+
+//++++++++++++++
+// Local methods
+//++++++++++++++
+
+// Method that fits the complexity model "model" to the samples "samples". The constant c minimizes
+// sum ((c * f_i - t_i) / t_i)^2, i.e., c = sum (f_i / t_i) / sum (f_i / t_i)^2, where f_i is the model value and t_i
+// the runtime of the i-th sample. The method returns "false" if fewer than two samples can be used.
+static bool fitComplexityModel(ComplexityModel model, const std::vector<ComplexitySample>& samples,
+                               ComplexityFit& fit)
+{
+  std::vector<double> ratios;
+
+  for (const ComplexitySample& sample : samples)
+  {
+    double value = evaluateComplexityModel(model, sample.numberOfPoints, sample.numberOfHullPoints);
+    if (sample.runtimeInNanoseconds > 0 && std::isfinite(value) && value > 0)
+      ratios.push_back(value / sample.runtimeInNanoseconds);
+  }
+  if (ratios.size() < 2)
+    return false;
+
+  double sumOfRatios = 0, sumOfSquaredRatios = 0, sumOfSquaredErrors = 0;
+  for (double ratio : ratios)
+  {
+    sumOfRatios += ratio;
+    sumOfSquaredRatios += ratio * ratio;
+  }
+  fit.model = model;
+  fit.constant = sumOfRatios / sumOfSquaredRatios;
+  for (double ratio : ratios)
+    sumOfSquaredErrors += (fit.constant * ratio - 1) * (fit.constant * ratio - 1);
+  fit.relativeResidual = std::sqrt(sumOfSquaredErrors / double(ratios.size()));
+
+  return true;
+}
+
+//++++++++++++++++++++
+// Complexity analysis
+//++++++++++++++++++++
+
+// Method that converts a complexity model into a string
+std::string convertToString(ComplexityModel model)
+{
+  switch (model)
+  {
+    case ComplexityModel::LINEAR    : return "n";
+    case ComplexityModel::N_LOG_N   : return "n log n";
+    case ComplexityModel::N_LOG_H   : return "n log h";
+    case ComplexityModel::QUADRATIC : return "n^2";
+  }
+
+  return std::string();
+}
+
+// Method that evaluates the complexity model "model" for "numberOfPoints" points and "numberOfHullPoints" hull points.
+double evaluateComplexityModel(ComplexityModel model, double numberOfPoints, double numberOfHullPoints)
+{
+  switch (model)
+  {
+    case ComplexityModel::LINEAR    : return numberOfPoints;
+    case ComplexityModel::N_LOG_N   : return numberOfPoints * std::log2(std::max(numberOfPoints, 2.0));
+    case ComplexityModel::N_LOG_H   : return numberOfPoints * std::log2(std::max(numberOfHullPoints, 2.0));
+    case ComplexityModel::QUADRATIC : return numberOfPoints * numberOfPoints;
+  }
+
+  return 0;
+}
+
+// Method that fits the complexity models to the samples "samples" and returns the fits ordered by their residuals.
+std::vector<ComplexityFit> fitComplexityModels(const std::vector<ComplexitySample>& samples)
+{
+  std::vector<ComplexityFit> fits;
+  ComplexityFit fit;
+
+  for (size_t i = 0; i < NUMBER_OF_COMPLEXITY_MODELS; ++i)
+    if (fitComplexityModel(ComplexityModel(i), samples, fit))
+      fits.push_back(fit);
+  std::stable_sort(fits.begin(), fits.end(), [](const ComplexityFit& lhs, const ComplexityFit& rhs)
+                   {
+                     return lhs.relativeResidual < rhs.relativeResidual;
+                   });
+
+  return fits;
+}
+
+// Method that finds the crossovers of all pairs of algorithms. For a pair (a, b), d = log(t_a / t_b) is computed for
+// each common number of points; if d changes its sign between two consecutive ones, the crossover is where the
+// linear interpolation of d over log n is 0.
+std::vector<RuntimeCrossover> findRuntimeCrossovers(
+  const std::vector<std::vector<ComplexitySample>>& samplesOfAlgorithms)
+{
+  std::vector<RuntimeCrossover> crossovers;
+
+  for (size_t a = 0; a < samplesOfAlgorithms.size(); ++a)
+    for (size_t b = a + 1; b < samplesOfAlgorithms.size(); ++b)
+    {
+      // Logarithms of the common numbers of points and of the runtime ratios in the order of the numbers of points.
+      std::vector<std::pair<double, double>> logRatios;
+      for (const ComplexitySample& sampleA : samplesOfAlgorithms[a])
+        for (const ComplexitySample& sampleB : samplesOfAlgorithms[b])
+          if (sampleA.numberOfPoints == sampleB.numberOfPoints && sampleA.runtimeInNanoseconds > 0 &&
+              sampleB.runtimeInNanoseconds > 0)
+            logRatios.emplace_back(std::log(sampleA.numberOfPoints),
+                                   std::log(sampleA.runtimeInNanoseconds / sampleB.runtimeInNanoseconds));
+      std::sort(logRatios.begin(), logRatios.end());
+
+      for (size_t i = 0; i + 1 < logRatios.size(); ++i)
+      {
+        double d0 = logRatios[i].second, d1 = logRatios[i + 1].second;
+        if ((d0 < 0 && d1 > 0) || (d0 > 0 && d1 < 0))
+        {
+          double logNumberOfPoints = logRatios[i].first +
+                                     (logRatios[i + 1].first - logRatios[i].first) * d0 / (d0 - d1);
+          // Algorithm a is faster below the crossover if it is faster for the smaller number of points.
+          crossovers.push_back({(d0 < 0) ? a : b, (d0 < 0) ? b : a, std::exp(logNumberOfPoints)});
+        }
+      }
+    }
+
+  return crossovers;
+}
+
+// Method that writes the fits of all algorithms and their crossovers as CSV tables into a string.
+std::string writeComplexityReport(const std::vector<std::string>& algorithmNames,
+                                  const std::vector<std::vector<ComplexitySample>>& samplesOfAlgorithms)
+{
+  std::ostringstream report;
+  std::vector<RuntimeCrossover> crossovers = findRuntimeCrossovers(samplesOfAlgorithms);
+
+  report << std::setprecision(6)
+         << "\nComplexity fits (runtime = constant * model; constants in nanoseconds; binary logarithms)\n"
+         << "Algorithm,Model,Constant,Relative residual,Best fit\n";
+  for (size_t i = 0; i < samplesOfAlgorithms.size(); ++i)
+  {
+    std::vector<ComplexityFit> fits = fitComplexityModels(samplesOfAlgorithms[i]);
+    for (size_t j = 0; j < fits.size(); ++j)
+      report << algorithmNames[i] << "," << convertToString(fits[j].model) << "," << fits[j].constant << ","
+             << fits[j].relativeResidual << "," << ((j == 0) ? "yes" : "") << "\n";
+  }
+
+  report << "Crossovers,Faster below,Faster above,Number of elements\n";
+  for (const RuntimeCrossover& crossover : crossovers)
+    report << "," << algorithmNames[crossover.fasterBelow] << "," << algorithmNames[crossover.fasterAbove] << ","
+           << std::llround(crossover.numberOfPoints) << "\n";
+  if (crossovers.empty())
+    report << ",None within the measured numbers of elements\n";
+
+  return report.str();
+}
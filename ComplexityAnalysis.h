@@ -0,0 +1,70 @@
+#ifndef COMPLEXITYANALYSIS_H
+#define COMPLEXITYANALYSIS_H
+
+
+#include <cstddef>
+#include <string>
+#include <vector>
+
+// The complexity analysis fits the median runtimes of an algorithm for several numbers of points n against the
+// complexity models n, n log n, n log h, and n^2, where h is the measured number of hull points. Each model has one
+// constant c (runtime = c * model(n, h)), which is fitted by least squares of the relative errors, so that the small
+// numbers of points weigh as much as the large ones. The relative residual of a fit is the root mean square of the
+// relative errors; the model with the smallest residual describes the scaling of the algorithm best. Logarithms are
+// binary; h is at least 2 in n log h.
+//
+// Crossovers are the numbers of points at which one algorithm overtakes another one. They are interpolated
+// between two measured numbers of points at which the faster algorithm changes (linearly in the logarithms of the
+// numbers of points and of the runtime ratio), so they are only found within the measured numbers of points.
+
+// Type that indicates a complexity model.
+enum class ComplexityModel {LINEAR, N_LOG_N, N_LOG_H, QUADRATIC};
+constexpr size_t NUMBER_OF_COMPLEXITY_MODELS = 4;
+
+// Type that keeps the median runtime of an algorithm for a number of points.
+struct ComplexitySample
+{
+  double numberOfPoints;
+  double numberOfHullPoints;
+  double runtimeInNanoseconds;
+};
+
+// Type that keeps the fit of a complexity model.
+struct ComplexityFit
+{
+  ComplexityModel model;
+  // Runtime per unit of the model in nanoseconds.
+  double constant = 0;
+  double relativeResidual = 0;
+};
+
+// Type that keeps a crossover of two algorithms, which are given by their indexes.
+struct RuntimeCrossover
+{
+  size_t fasterBelow;
+  size_t fasterAbove;
+  double numberOfPoints;
+};
+
+// Method that converts a complexity model into a string
+std::string convertToString(ComplexityModel model);
+
+// Method that evaluates the complexity model "model" for "numberOfPoints" points and "numberOfHullPoints" hull points.
+double evaluateComplexityModel(ComplexityModel model, double numberOfPoints, double numberOfHullPoints);
+
+// Method that fits the complexity models to the samples "samples" and returns the fits ordered by their relative
+// residuals (best fit first). Samples without a positive runtime or a finite model value are ignored; if fewer than
+// two samples remain for a model, it is not fitted.
+std::vector<ComplexityFit> fitComplexityModels(const std::vector<ComplexitySample>& samples);
+
+// Method that finds the crossovers of all pairs of algorithms whose samples are "samplesOfAlgorithms". Only numbers of
+// points that were measured for both algorithms of a pair are compared.
+std::vector<RuntimeCrossover> findRuntimeCrossovers(
+  const std::vector<std::vector<ComplexitySample>>& samplesOfAlgorithms);
+
+// Method that writes the fits of all algorithms and their crossovers as CSV tables into a string. "algorithmNames" are
+// the names of the algorithms whose samples are "samplesOfAlgorithms".
+std::string writeComplexityReport(const std::vector<std::string>& algorithmNames,
+                                  const std::vector<std::vector<ComplexitySample>>& samplesOfAlgorithms);
+
+#endif // COMPLEXITYANALYSIS_H
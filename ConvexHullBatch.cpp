@@ -0,0 +1,99 @@
+
+#include <algorithm>
+#include <cstdint>
+#include <iostream>
+#include <vector>
+#include "ConvexHullBatch.h"
+#include "ParallelExecution.h"
+#include "TraceRecorder.h"
+
+//+++++++++++++++++++++++
+// Local data and methods
+//+++++++++++++++++++++++
+
+// Minimal number of points that a thread of a batch gets; smaller batches use fewer threads.
+static const size_t MINIMAL_NUMBER_OF_POINTS_PER_BATCH_THREAD = size_t(1) << 12;
+
+// Method that checks whether the offsets of the batch "batch" are valid. Otherwise, it prints an error message.
+template <typename PointType>
+static bool checkOffsets(const BasicPointSequenceBatch<PointType>& batch)
+{
+  const std::vector<size_t>& offsets = batch.offsets;
+
+  if (offsets.empty() || offsets.front() != 0 || offsets.back() != batch.points.size())
+  {
+    std::cout << "ERROR: The offsets of the batch must begin with 0 and end with the number of points!" << std::endl;
+    return false;
+  }
+  if (!std::is_sorted(offsets.begin(), offsets.end()))
+  {
+    std::cout << "ERROR: The offsets of the batch must not decrease!" << std::endl;
+    return false;
+  }
+
+  return true;
+}
+
+//++++++++++++++++++++++++++++++++
+// Class template ConvexHullBatch
+//++++++++++++++++++++++++++++++++
+
+// Method that computes the convex hulls of all point sequences of a batch.
+template <typename OrientationPolicy>
+bool ConvexHullBatch<OrientationPolicy>::computeConvexHulls(const PointSequenceBatchType& batch,
+                                                            PointSequenceBatchType& convexHulls,
+                                                            size_t numberOfThreads)
+{
+  if (!checkOffsets(batch))
+    return false;
+
+  const std::vector<size_t>& offsets = batch.offsets;
+  size_t numberOfSequences = getNumberOfPointSequences(batch), numberOfPoints = batch.points.size();
+  TRACE_SIZED_SPAN("batch", numberOfSequences);
+
+  // Each thread gets the point sequences that begin in its part of the points, so that the threads get about the
+  // same number of points even if the sizes of the point sequences differ.
+  numberOfThreads = std::min(resolveNumberOfThreads(numberOfThreads),
+                             std::max<size_t>(1, numberOfPoints / MINIMAL_NUMBER_OF_POINTS_PER_BATCH_THREAD));
+  if (threadScratches.size() < numberOfThreads)
+    threadScratches.resize(numberOfThreads);
+  for (size_t threadIndex = 0; threadIndex < numberOfThreads; ++threadIndex)
+    threadScratches[threadIndex].firstSequence = size_t(std::lower_bound(offsets.begin(), offsets.end() - 1,
+      getPartBegin(numberOfPoints, numberOfThreads, threadIndex)) - offsets.begin());
+
+  // The number of points of each convex hull is stored at the offset of the next one and summed up afterwards.
+  convexHulls.offsets.assign(numberOfSequences + 1, 0);
+  runInParallel(numberOfThreads, [&](size_t threadIndex)
+  {
+    ThreadScratch& scratch = threadScratches[threadIndex];
+    size_t lastSequence = (threadIndex + 1 < numberOfThreads) ? threadScratches[threadIndex + 1].firstSequence
+                                                              : numberOfSequences;
+    TRACE_SIZED_SPAN("batch part", lastSequence - scratch.firstSequence);
+
+    scratch.convexHulls.clear();
+    for (size_t i = scratch.firstSequence; i < lastSequence; ++i)
+    {
+      scratch.points.assign(batch.points.begin() + offsets[i], batch.points.begin() + offsets[i + 1]);
+      typename PointSequenceType::iterator past = ConvexHullInPlaceQuickHull<OrientationPolicy>(scratch.points);
+      scratch.convexHulls.insert(scratch.convexHulls.end(), scratch.points.begin(), past);
+      convexHulls.offsets[i + 1] = size_t(past - scratch.points.begin());
+    }
+  });
+
+  for (size_t i = 0; i < numberOfSequences; ++i)
+    convexHulls.offsets[i + 1] += convexHulls.offsets[i];
+  convexHulls.points.resize(convexHulls.offsets.back());
+  runInParallel(numberOfThreads, [&](size_t threadIndex)
+  {
+    const ThreadScratch& scratch = threadScratches[threadIndex];
+    std::copy(scratch.convexHulls.begin(), scratch.convexHulls.end(),
+              convexHulls.points.begin() + convexHulls.offsets[scratch.firstSequence]);
+  });
+
+  return true;
+}
+
+template class ConvexHullBatch<FastOrientationPolicy>;
+template class ConvexHullBatch<AdaptiveOrientationPolicy>;
+template class ConvexHullBatch<FixedPointOrientationPolicy<std::int32_t>>;
+template class ConvexHullBatch<FixedPointOrientationPolicy<std::int64_t>>;
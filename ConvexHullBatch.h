@@ -0,0 +1,79 @@
+#ifndef CONVEXHULLBATCH_H
+#define CONVEXHULLBATCH_H
+
+
+#include <cstdint>
+#include <vector>
+#include "ConvexHullQuickHull.h"
+#include "OrientationPredicates.h"
+
+// The batch computes the convex hulls of many small point sequences (e.g., the cells of a grid or the objects of a
+// scene), for which calling a convex hull algorithm once per point sequence costs more for the allocations and the
+// copies of the results than for the hulls themselves. The point sequences are kept in a compressed (CSR) layout: all
+// points are stored one after another in a single point sequence, and the offsets give the first point of each point
+// sequence, followed by the total number of points. The convex hulls are returned in the same layout.
+//
+// The point sequences are split into consecutive parts with about the same number of points, one per thread (see
+// "ParallelExecution.h"). Each thread copies a point sequence into its scratch point sequence, computes its convex
+// hull in place (see "ConvexHullInPlaceQuickHull") and appends it to its own hulls; afterwards, the hulls of the
+// threads are copied to their offsets in the result in parallel. The scratch point sequences are kept by the batch
+// object, so that repeated batches of similar sizes do not allocate memory apart from the result. Each convex hull
+// fulfills the contract of the algorithms (see "ConvexHullQuickHull.h"); in particular, the convex hull of a point
+// sequence with less than three distinct points or with collinear points is empty. The point sequences should be
+// small; a large one is processed by a single thread (apart from its scan).
+
+// Type that keeps point sequences in the compressed layout (see above). The point sequence with index i consists of
+// the points "points[offsets[i]]", ..., "points[offsets[i + 1] - 1]"; the offsets are thus not decreasing, begin
+// with 0, and end with the number of points.
+template <typename PointType>
+struct BasicPointSequenceBatch
+{
+  std::vector<PointType> points;
+  std::vector<size_t> offsets {0};
+};
+
+// Type of the point sequence batches that are processed with the orientation policy "OrientationPolicy".
+template <typename OrientationPolicy>
+using PointSequenceBatchOf = BasicPointSequenceBatch<typename OrientationPolicy::PointType>;
+
+template <typename OrientationPolicy = FastOrientationPolicy>
+class ConvexHullBatch
+{
+  public:
+    using PointSequenceType = PointSequenceOf<OrientationPolicy>;
+    using PointSequenceBatchType = PointSequenceBatchOf<OrientationPolicy>;
+
+    // Method that computes the convex hulls of all point sequences of "batch" with "numberOfThreads" threads (0 means
+    // the default number of threads) and stores them in "convexHulls", whose previous content is replaced. If the
+    // offsets of "batch" are invalid (see above), the method prints an error message and returns "false".
+    bool computeConvexHulls(const PointSequenceBatchType& batch, PointSequenceBatchType& convexHulls,
+                            size_t numberOfThreads = 0);
+
+  private:
+    // Type that keeps the memory of a thread that is reused for all point sequences and batches.
+    struct ThreadScratch
+    {
+      // Copy of the current point sequence, which is reordered by the in-place algorithm.
+      PointSequenceType points;
+      // Convex hulls of the point sequences of the thread's part.
+      PointSequenceType convexHulls;
+      // Index of the first point sequence of the thread's part.
+      size_t firstSequence = 0;
+    };
+
+    std::vector<ThreadScratch> threadScratches;
+};
+
+// Method that returns the number of point sequences of the batch "batch".
+template <typename PointType>
+size_t getNumberOfPointSequences(const BasicPointSequenceBatch<PointType>& batch)
+{
+  return batch.offsets.empty() ? 0 : batch.offsets.size() - 1;
+}
+
+extern template class ConvexHullBatch<FastOrientationPolicy>;
+extern template class ConvexHullBatch<AdaptiveOrientationPolicy>;
+extern template class ConvexHullBatch<FixedPointOrientationPolicy<std::int32_t>>;
+extern template class ConvexHullBatch<FixedPointOrientationPolicy<std::int64_t>>;
+
+#endif // CONVEXHULLBATCH_H
@@ -4,7 +4,12 @@
 #include <memory>
 #include <vector>
 #include "ConvexHullQuickHull.h"
+#include "HullStatistics.h"
+#include "InplaceQuickHullKernels.h"
+#include "OrientationPredicates.h"
 #include "PointHandler.h"
+#include "SmallConvexHull.h"
+#include "TraceRecorder.h"
 
 #include <cassert> // assert macro
 #include <cstdlib> // std::size_t
@@ -15,52 +20,52 @@
 const signed short int LOWER  = 0;
 const signed short int UPPER  = 1;
 
-using P = Point;
-using S = std::vector<P>;
-using I = typename S::iterator;
-
 //**********************************************
 // Local methods used by our in place quickhull
 //**********************************************
+template <typename OrientationPolicy, typename I>
 void findHullInPlace(I first, I past, I leftMost, I rightMost, I& itrForNextHullPoint, const signed short int location);
-void lowerPartition(I& itrForNextOfLastPointOfFirstGroup, I& itrForFirstPointOfSecondGroup, 
-                    const I& leftMostP, const I& rightMostP, const I& furthestP);
-void upperPartition(I& itrForNextOfLastPointOfFirstGroup, I& itrForFirstPointOfSecondGroup, 
-                    const I& leftMostP, const I& rightMostP, const I& furthestP);
-// A function pointer that calls either lowerPartition or upperPartition. 
+// A function pointer that calls either lowerPartition or upperPartition (see "InplaceQuickHullKernels.h").
+template <typename OrientationPolicy, typename I>
 void (*partition[2])(I& itrForNextOfLastPointOfFirstGroup, I& itrForFirstPointOfSecondGroup, 
-                    const I& leftMostP, const I& rightMostP, const I& furthestP) = {lowerPartition, upperPartition};
-// Methods that duplicate their local methods. 
-I partition_right_left(I first, I last, const I& leftMostP, const I& rightMostP);
-I find_furthest(I first, I past, I leftMost, I rightMost);
+                    const I& leftMostP, const I& rightMostP, const I& furthestP) = 
+  {lowerPartition<OrientationPolicy, I>, upperPartition<OrientationPolicy, I>};
 
 //************************************************
 // Local methods used by their in place quickhull
 //************************************************
-I find_furthest(I first, I past, I antipole);
-std::pair<I, I> find_poles(I first, I past);
-void parallel_iter_swap(I st, I nd, I rd, I th);
-I partition_left_right(I first, I past, I antipole);
-void swap_blocks(I source, I past, I target);
-void move_away(I here, I rest, I past); 
+template <typename OrientationPolicy, typename I>
 I chain(I pole, I past, I antipole);
 
 //**********************************************************
 // ConvexHullInplaceQuickHull: In place QuickHull algorithm
 //**********************************************************
 // It returns an iterator and it points the next of the last convex hull vertex in the PointSequence.  
-std::vector<Point>::iterator ConvexHullInPlaceQuickHull(PointSequence& pointSeq)
+template <typename OrientationPolicy, typename Allocator>
+typename PointSequenceOf<OrientationPolicy, Allocator>::iterator ConvexHullInPlaceQuickHull(
+  PointSequenceOf<OrientationPolicy, Allocator>& pointSeq)
 { 
-  // Check whether the point sequence "pointSeq" fulfills some minimal requirements for computing the convex hull from
-  // it. These requirements include that the point sequence contains at least three points and that it is not the case
-  // that all points are collinear. If it does not, return the empty point sequence.
-  if (! PointSequenceFulfillsMinimalRequirements(pointSeq))
+  using I = typename PointSequenceOf<OrientationPolicy, Allocator>::iterator;
+
+  // Small point sequences are processed by a small convex hull kernel (see "SmallConvexHull.h").
+  if (pointSeq.size() <= getSmallConvexHullThreshold())
+    return computeSmallConvexHullInPlace<OrientationPolicy>(pointSeq);
+
+  // Scan the point sequence "pointSeq" once. The scan checks whether it fulfills some minimal requirements for
+  // computing the convex hull from it. These requirements include that the point sequence contains at least three
+  // points and that it is not the case that all points are collinear. If it does not, return the empty point sequence.
+  // The scan also finds the leftmost and the rightmost point so that they need not be searched again.
+  BasicPointSequenceScan<typename OrientationPolicy::PointType> scan = scanPointSequence(pointSeq);
+  if (! scan.fulfillsMinimalRequirements)
     return pointSeq.begin();
 
-  // Adapt their way to find the leftmost and rightmost points. 
+  // The orientation policy may use the bounding box of the points to speed up the orientation tests.
+  typename OrientationPolicy::BoundingBoxScope boundingBoxScope(scan.minCorner, scan.maxCorner);
+
+  // Take the leftmost and rightmost points from the scan. 
   I first = pointSeq.begin();
   I past = pointSeq.end();
-  std::pair<I, I> pair = find_poles(first, past);
+  std::pair<I, I> pair(first + scan.leftMostIndex, first + scan.rightMostIndex);
   I itrForLeftMostPoint = first;
   I itrForRightMostPoint = std::prev(past);
   // Place the leftmost point at the beginning of the pointSeq and the rightmost point at the end of the pointSeq. 
@@ -77,13 +82,14 @@ std::vector<Point>::iterator ConvexHullInPlaceQuickHull(PointSequence& pointSeq)
   // An iterator of the first point of the second block.
   // Second block is a group of points that place above the middle segment.
   // After partition, it can be found. 
-  I itrForFirstPointOfSecondGroup = partition_right_left(first, past, itrForLeftMostPoint, itrForRightMostPoint);
+  I itrForFirstPointOfSecondGroup = partition_right_left<OrientationPolicy>(first, past, itrForLeftMostPoint,
+                                                                           itrForRightMostPoint);
   
   // Find the lower hull vertices recursively. 
-  findHullInPlace(first, itrForFirstPointOfSecondGroup, itrForLeftMostPoint, itrForRightMostPoint, 
-                  itrForNextHullPoint, LOWER);
+  findHullInPlace<OrientationPolicy>(first, itrForFirstPointOfSecondGroup, itrForLeftMostPoint, itrForRightMostPoint,
+                                     itrForNextHullPoint, LOWER);
   // After finding the lower hull vertices, the rightmost point will be placed to the next. 
-  std::iter_swap(itrForRightMostPoint, itrForNextHullPoint);
+  swapPoints(itrForRightMostPoint, itrForNextHullPoint);
   itrForRightMostPoint = itrForNextHullPoint;
   // If the iterator for the next hull point is the same as the iterator for the first point of the second block, 
   // the first point of the second group moves to the end, hence, increase the iterator to include the point. 
@@ -94,20 +100,27 @@ std::vector<Point>::iterator ConvexHullInPlaceQuickHull(PointSequence& pointSeq)
   }
   itrForNextHullPoint++;
   // Find the upper hull vertices recursively. 
-  findHullInPlace(itrForFirstPointOfSecondGroup, past, 
-                  itrForRightMostPoint, itrForLeftMostPoint, itrForNextHullPoint, UPPER);
+  findHullInPlace<OrientationPolicy>(itrForFirstPointOfSecondGroup, past, 
+                                     itrForRightMostPoint, itrForLeftMostPoint, itrForNextHullPoint, UPPER);
 
   return itrForNextHullPoint;
 }
 
+template <typename OrientationPolicy, typename I>
 void findHullInPlace(I first, I past, I leftMost, I rightMost, I& itrForNextHullPoint, const signed short int location)
 {
   size_t sizeOfPoints = std::distance(first, past);
+  RECORD_HULL_SUBPROBLEM(sizeOfPoints);
+  TRACE_SIZED_SPAN("findHullInPlace", sizeOfPoints);
   
-  // if the point sequence only has one point, it should be added to the result vector. 
+  // The points of the top-level blocks may also be collinear with the middle segment (including duplicates of the
+  // leftmost and the rightmost point). Such points are never hull vertices and are skipped here. The blocks of all
+  // deeper recursion levels only contain points strictly on the right side of the segment.
+  // if the point sequence only has one point, it should be added to the result vector unless it is collinear.
   if (sizeOfPoints == 1)
   {
-    std::iter_swap(first, itrForNextHullPoint++);
+    if (OrientationPolicy::orientation(*leftMost, *rightMost, *first) != Orientation::COLLINEAR)
+      swapPoints(first, itrForNextHullPoint++);
     return;
   }
 
@@ -116,11 +129,14 @@ void findHullInPlace(I first, I past, I leftMost, I rightMost, I& itrForNextHull
     return;
   }
 
-  // Iterators for the furthest point and the last point in the current block of points. 
-  I furthestPoint = find_furthest(first, past, leftMost, rightMost);
+  // Iterators for the furthest point and the last point in the current block of points. If even the furthest point is
+  // collinear with the segment, all points are and none of them is a hull vertex.
+  I furthestPoint = find_furthest<OrientationPolicy>(first, past, leftMost, rightMost);
+  if (OrientationPolicy::orientation(*leftMost, *rightMost, *furthestPoint) == Orientation::COLLINEAR)
+    return;
   I last = std::prev(past);
   // Move the furthest point to the end. 
-  std::iter_swap(furthestPoint, last);
+  swapPoints(furthestPoint, last);
   furthestPoint = last; // to make it understandable. 
 
   // Initialize an iterator of the next point of the first block.
@@ -134,13 +150,14 @@ void findHullInPlace(I first, I past, I leftMost, I rightMost, I& itrForNextHull
   // After finding the furthest point, partition the current group of points.
   // partition is a function pointer and it calls either lowerPartition or upperPartition 
   // depending on the location variable.  
-  partition[location](itrForNextOfLastPointOfFirstGroup, itrForFirstPointOfSecondGroup, 
-                      leftMost, rightMost, furthestPoint);
+  partition<OrientationPolicy, I>[location](itrForNextOfLastPointOfFirstGroup, itrForFirstPointOfSecondGroup, 
+                                         leftMost, rightMost, furthestPoint);
   
   // Recursively find the hull vertices. 
-  findHullInPlace(first, itrForNextOfLastPointOfFirstGroup, leftMost, furthestPoint, itrForNextHullPoint, location);
+  findHullInPlace<OrientationPolicy>(first, itrForNextOfLastPointOfFirstGroup, leftMost, furthestPoint,
+                                     itrForNextHullPoint, location);
   // After finding the hull vertices, the furthest point will be placed to the next. 
-  std::iter_swap(furthestPoint, itrForNextHullPoint);
+  swapPoints(furthestPoint, itrForNextHullPoint);
   furthestPoint = itrForNextHullPoint; if (itrForNextHullPoint == itrForFirstPointOfSecondGroup)
   { 
     itrForFirstPointOfSecondGroup++;
@@ -149,314 +166,94 @@ void findHullInPlace(I first, I past, I leftMost, I rightMost, I& itrForNextHull
   itrForNextHullPoint++;
 
   // Recursively find the hull vertices for the next group of points. 
-  findHullInPlace(itrForFirstPointOfSecondGroup, last, furthestPoint, rightMost, itrForNextHullPoint, location);
+  findHullInPlace<OrientationPolicy>(itrForFirstPointOfSecondGroup, last, furthestPoint, rightMost,
+                                     itrForNextHullPoint, location);
 }
-// Partition the points placed in the lower of middle segment. 
-void lowerPartition(I& itrForNextOfLastPointOfFirstGroup, I& itrForFirstPointOfSecondGroup, 
-                    const I& leftMostP, const I& rightMostP, const I& furthestP)
-{ 
-  // Initialize current to the first of the points.
-  I current = itrForNextOfLastPointOfFirstGroup;
-  while (current != itrForFirstPointOfSecondGroup)
-  {
-    // without Orienting vector.
-    if (getOrientation(*leftMostP, *furthestP, *current) == Orientation::CLOCKWISE)
-    {
-      std::iter_swap(current, itrForNextOfLastPointOfFirstGroup);
-      itrForNextOfLastPointOfFirstGroup++;
-      current++;
-    }
 
-    else if (getOrientation(*furthestP, *rightMostP, *current) == Orientation::CLOCKWISE)
-    {
-      std::iter_swap(current, itrForFirstPointOfSecondGroup);
-      itrForFirstPointOfSecondGroup--;
-    }
-    else
-      current++;
-    
-    /* if ((*current).x < (*furthestP).x) // Orienting vector.
-     * {
-     *   if (getOrientation(*leftMostP, *furthestP, *current) == Orientation::CLOCKWISE)
-     *   {
-     *     std::iter_swap(current, itrForNextOfLastPointOfFirstGroup);
-     *     itrForNextOfLastPointOfFirstGroup++;
-     *   }
-     *   current++;
-     * }
-     * else
-     * {
-     *   if (getOrientation(*furthestP, *rightMostP, *current) == Orientation::CLOCKWISE)
-     *   {
-     *     std::iter_swap(current, itrForFirstPointOfSecondGroup);
-     *     itrForFirstPointOfSecondGroup--;
-     *   }
-     *   else
-     *     current++;
-     * } */
-  }
-  // for the element that is not checked in the loop.
-  if ((*current).x < (*furthestP).x)
-  {
-    if (getOrientation(*leftMostP, *furthestP, *current) == Orientation::CLOCKWISE)
-    {
-      std::iter_swap(current, itrForNextOfLastPointOfFirstGroup);
-      itrForNextOfLastPointOfFirstGroup++;
-    }
-    itrForFirstPointOfSecondGroup++;
-    
-  }
-  else
-  {
-    if (getOrientation(*furthestP, *rightMostP, *current) == Orientation::COUNTERCLOCKWISE)
-      itrForFirstPointOfSecondGroup++;
-  }
 
-}
-// Partition the points placed in the upper of middle segment. 
-void upperPartition(I& itrForNextOfLastPointOfFirstGroup, I& itrForFirstPointOfSecondGroup, 
-                    const I& leftMostP, const I& rightMostP, const I& furthestP)
+// Their in-place quickhull algorithm
+template <typename OrientationPolicy, typename Allocator>
+typename PointSequenceOf<OrientationPolicy, Allocator>::iterator TheirConvexHullInPlaceQuickHull(
+  PointSequenceOf<OrientationPolicy, Allocator>& pointSeq)
 {
-  // Initialize current to the first of the points.
-  I current = itrForNextOfLastPointOfFirstGroup;
-  while (current != itrForFirstPointOfSecondGroup)
-  {
-    // without Orienting vector
-    if (getOrientation(*leftMostP, *furthestP, *current) == Orientation::CLOCKWISE)
-    {
-      std::iter_swap(current, itrForNextOfLastPointOfFirstGroup);
-      itrForNextOfLastPointOfFirstGroup++;
-      current++;
-    }
-    else if (getOrientation(*furthestP, *rightMostP, *current) == Orientation::CLOCKWISE)
-    {
-      std::iter_swap(current, itrForFirstPointOfSecondGroup);
-      itrForFirstPointOfSecondGroup--;
-    }
-    else
-      current++;
-    
-    /* // with orienting vector
-     * if ((*current).x > (*furthestP).x)
-     * {
-     *   if (getOrientation(*leftMostP, *furthestP, *current) == Orientation::CLOCKWISE)
-     *   {
-     *     std::iter_swap(current, itrForNextOfLastPointOfFirstGroup);
-     *     itrForNextOfLastPointOfFirstGroup++;
-     *   }
-     *   current++;
-     * }
-     * else
-     * {
-     *   if (getOrientation(*furthestP, *rightMostP, *current) == Orientation::CLOCKWISE)
-     *   {
-     *     std::iter_swap(current, itrForFirstPointOfSecondGroup);
-     *     itrForFirstPointOfSecondGroup--;
-     *   }
-     *   else
-     *     current++;
-     * } */
-  }
-  // for the element that is not checked in the loop.
-  if ((*current).x > (*furthestP).x)
-  {
-    if (getOrientation(*leftMostP, *furthestP, *current) == Orientation::CLOCKWISE)
-    {
-      std::iter_swap(current, itrForNextOfLastPointOfFirstGroup);
-      itrForNextOfLastPointOfFirstGroup++;
-    }
-    itrForFirstPointOfSecondGroup++;
-  }
-  else
-  {
-    if (getOrientation(*furthestP, *rightMostP, *current) == Orientation::COUNTERCLOCKWISE)
-      itrForFirstPointOfSecondGroup++;
-  }
-}
+  using I = typename PointSequenceOf<OrientationPolicy, Allocator>::iterator;
 
+  // Small point sequences are processed by a small convex hull kernel (see "SmallConvexHull.h").
+  if (pointSeq.size() <= getSmallConvexHullThreshold())
+    return computeSmallConvexHullInPlace<OrientationPolicy>(pointSeq);
 
-// Their in-place quickhull algorithm
-std::vector<Point>::iterator TheirConvexHullInPlaceQuickHull(PointSequence& pointSeq)
-{
-  // Check whether the point sequence "pointSeq" fulfills some minimal requirements for computing the convex hull from
-  // it. These requirements include that the point sequence contains at least three points and that it is not the case
-  // that all points are collinear. If it does not, return the empty point sequence.
-  if (! PointSequenceFulfillsMinimalRequirements(pointSeq))
+  // Scan the point sequence "pointSeq" once. The scan checks whether it fulfills some minimal requirements for
+  // computing the convex hull from it. These requirements include that the point sequence contains at least three
+  // points and that it is not the case that all points are collinear. If it does not, return the empty point sequence.
+  // The scan also finds the leftmost and the rightmost point so that they need not be searched again.
+  BasicPointSequenceScan<typename OrientationPolicy::PointType> scan = scanPointSequence(pointSeq);
+  if (! scan.fulfillsMinimalRequirements)
     return pointSeq.begin();
 
+  // The orientation policy may use the bounding box of the points to speed up the orientation tests.
+  typename OrientationPolicy::BoundingBoxScope boundingBoxScope(scan.minCorner, scan.maxCorner);
+
   I first = pointSeq.begin();
   I past = pointSeq.end();
 
-  // Find the leftmost point with minimum x-coordinate and the rightmost point with maximum x-coordinate of the point
-  // sequence "pointSeq".
-  std::pair<I, I> pair = find_poles(first, past);
+  // Take the leftmost point with minimum x-coordinate and the rightmost point with maximum x-coordinate of the point
+  // sequence "pointSeq" from the scan.
+  std::pair<I, I> pair(first + scan.leftMostIndex, first + scan.rightMostIndex);
   I west = first;
   I east = std::prev(past);
   parallel_iter_swap(west, east, std::get<0>(pair) , std::get<1>(pair));
   if (*west == *east) {
     return std::next(first);
   }
-  I middle = partition_left_right(west, east, east); 
+  I middle = partition_left_right<OrientationPolicy>(west, east, east); 
   std::size_t m = std::distance(middle, past);
-  I eliminated = chain(first, middle, east);
-  std::iter_swap(middle, east);
-  std::iter_swap(eliminated, middle); // east at its final place
+  I eliminated = chain<OrientationPolicy>(first, middle, east);
+  swapPoints(middle, east);
+  swapPoints(eliminated, middle); // east at its final place
   east = eliminated;
   ++middle;
   ++eliminated;
   move_away(eliminated, middle, past);
   I border = east;
   std::advance(border, m);
-  eliminated = chain(east, border, west); // downunder
-
-  return eliminated;
-}
-std::pair<I, I> find_poles(I first, I past) 
-{
-  using P = typename std::iterator_traits<I>::value_type;
-  auto pair = std::minmax_element(first, past,
-    [ ](P const& a, P const& b) -> bool {
-      return (a.x < b.x) or (a.x == b.x and a.y < b.y);
-    });
-  return pair;
-}
-void parallel_iter_swap(I st, I nd, I rd, I th) 
-{
-  /* assert(st != nd and rd != th); */
-  std::iter_swap(st, rd);
-  if (th == st) {
-    std::iter_swap(nd, rd);
-  }
-  else {
-    std::iter_swap(nd, th);
-  }
-}
-I partition_left_right(I first, I past, I antipole) 
-{
-  /* assert(first != past); */
-  using P = typename std::iterator_traits<I>::value_type;
-  I pole = first;
-  I middle = std::partition(std::next(pole), past,
-    [&](P const& q) -> bool {
-      return Orientation::COUNTERCLOCKWISE != getOrientation(*pole, q, *antipole);  // not left_turn(*pole, q, *antipole);
-    });
-  return middle;
-}
-I partition_right_left(I first, I last, const I& leftMostP, const I& rightMostP) 
-{
-  /* assert(first != last); */
-  using P = typename std::iterator_traits<I>::value_type;
-  I middle = std::partition(first, last,
-    [&](P const& q) -> bool {
-      return Orientation::CLOCKWISE != getOrientation(*leftMostP, q, *rightMostP);  // not left_turn(*pole, q, *antipole);
-    });
-  return middle;
-}
+  eliminated = chain<OrientationPolicy>(east, border, west); // downunder
 
-void swap_blocks(I source, I past, I target) 
-{
-  if (source == target or source == past) {
-    return;
-  }
-  using P = typename std::iterator_traits<I>::value_type;
-  I hole = target;
-  P p = *target;
-  I const last = std::prev(past);
-  while (true) {
-    *hole = *source;
-    ++hole;
-    if (source == last) {
-      break;
-    }
-    *source = *hole;
-    ++source;
-  }
-  *source = p;
-}
+  // The chains list the upper hull from west to east and then the lower hull from east to west, i.e., the hull points
+  // are in clockwise order. Reverse all hull points after the westmost point so that they are in counterclockwise
+  // order like the results of the other convex hull algorithms.
+  std::reverse(std::next(first), eliminated);
 
-void move_away(I here, I rest, I past) 
-{
-  if (here == rest or rest == past) {
-    return;
-  }
-  if (std::distance(here, rest) < std::distance(rest, past)) {
-    I target = past;
-    std::advance(target, -std::distance(here, rest));
-    swap_blocks(here, rest, target);
-  }
-  else {
-    swap_blocks(rest, past, here);
-  }
+  return eliminated;
 }
-I find_furthest(I first, I past, I leftMost, I rightMost) 
-{
-  I furthest = first;
-  Number squaredDistanceFromPointToSegment, maxSquaredDistance = 0;
 
-  for (I i = first; i != past; ++i) 
-  {
-    squaredDistanceFromPointToSegment = computeSquaredDistanceFromPointToSegment(*i, *leftMost, *rightMost);
-    if (maxSquaredDistance < squaredDistanceFromPointToSegment)
-    {
-      maxSquaredDistance = squaredDistanceFromPointToSegment;
-      furthest = i;
-    }
-    else if (maxSquaredDistance == squaredDistanceFromPointToSegment && (*i).x < (*furthest).x)
-      // If there are more than two points with the same largest distance to the segment, we must ensure that none of
-      // the interior collinear points are selected for the convex hull. We achieve this by selecting the point with
-      // the smallest x-coordinate; it will definitely belong to the convex hull. The point with the largest
-      // x-coordinate of all collinear points will be taken in the next recursive step of "findHull". 
-      furthest = i;
-  }
-  return furthest;
-}
-I find_furthest(I first, I past, I antipole) 
-{
-  I pole = first;
-  I answer = pole;
-  Number squaredDistanceFromPointToSegment, maxSquaredDistance = 0;
 
-  for (I i = std::next(first); i != past; ++i) 
-  {
-    squaredDistanceFromPointToSegment = computeSquaredDistanceFromPointToSegment(*i, *pole, *antipole);
-    if (maxSquaredDistance < squaredDistanceFromPointToSegment)
-    {
-      maxSquaredDistance = squaredDistanceFromPointToSegment;
-      answer = i;
-    }
-    else if (maxSquaredDistance == squaredDistanceFromPointToSegment && (*i).x < (*answer).x)
-      // If there are more than two points with the same largest distance to the segment, we must ensure that none of
-      // the interior collinear points are selected for the convex hull. We achieve this by selecting the point with
-      // the smallest x-coordinate; it will definitely belong to the convex hull. The point with the largest
-      // x-coordinate of all collinear points will be taken in the next recursive step of "findHull". 
-      answer = i;
-  }
-  return answer;
-}
+template <typename OrientationPolicy, typename I>
 I chain(I pole, I past, I antipole)
 {
   std::size_t n = std::distance(pole, past);
+  RECORD_HULL_SUBPROBLEM(n);
+  TRACE_SIZED_SPAN("chain", n);
   if (n == 1) {
     return past;
   }
   if (n == 2) {
-    if (getOrientation(*std::next(pole) , *pole, *antipole) == Orientation::COLLINEAR) {
+    if (OrientationPolicy::orientation(*std::next(pole) , *pole, *antipole) == Orientation::COLLINEAR) {
       return std::next(pole);
     }
     else {
       return past;
     }
   }
-  I pivot = find_furthest(pole, past, antipole);
-  if (getOrientation(*pivot, *pole, *antipole) == Orientation::COLLINEAR) {
+  I pivot = find_furthest<OrientationPolicy>(pole, past, antipole);
+  if (OrientationPolicy::orientation(*pivot, *pole, *antipole) == Orientation::COLLINEAR) {
     return std::next(pole);
   }
   I last = std::prev(past);
-  std::iter_swap(pivot, last); // pivot at the end
-  I mid = partition_left_right(pole, last, last);
-  I eliminated = chain(pole, mid, last);
-  std::iter_swap(mid, last);
-  std::iter_swap(eliminated, mid); // pivot at its final place
+  swapPoints(pivot, last); // pivot at the end
+  I mid = partition_left_right<OrientationPolicy>(pole, last, last);
+  I eliminated = chain<OrientationPolicy>(pole, mid, last);
+  swapPoints(mid, last);
+  swapPoints(eliminated, mid); // pivot at its final place
   pivot = eliminated;
   std::size_t m = std::distance(mid, past);
   ++mid;
@@ -464,7 +261,42 @@ I chain(I pole, I past, I antipole)
   move_away(eliminated, mid, past);
   I border = pivot;
   std::advance(border, m);
-  I interior = partition_left_right(pivot, border, antipole);
-  eliminated = chain(pivot, interior, antipole);
+  I interior = partition_left_right<OrientationPolicy>(pivot, border, antipole);
+  eliminated = chain<OrientationPolicy>(pivot, interior, antipole);
   return eliminated;
 }
+
+// Explicit instantiations for the provided orientation policies and for the point sequences and the point buffers.
+template std::vector<Point>::iterator ConvexHullInPlaceQuickHull<FastOrientationPolicy>(PointSequence& pointSeq);
+template std::vector<Point>::iterator ConvexHullInPlaceQuickHull<AdaptiveOrientationPolicy>(PointSequence& pointSeq);
+template FixedPointSequence::iterator ConvexHullInPlaceQuickHull<FixedPointOrientationPolicy<std::int32_t>>(
+  FixedPointSequence& pointSeq);
+template WideFixedPointSequence::iterator ConvexHullInPlaceQuickHull<FixedPointOrientationPolicy<std::int64_t>>(
+  WideFixedPointSequence& pointSeq);
+template PointBufferOf<FastOrientationPolicy>::iterator ConvexHullInPlaceQuickHull<FastOrientationPolicy>(
+  PointBufferOf<FastOrientationPolicy>& pointSeq);
+template PointBufferOf<AdaptiveOrientationPolicy>::iterator ConvexHullInPlaceQuickHull<AdaptiveOrientationPolicy>(
+  PointBufferOf<AdaptiveOrientationPolicy>& pointSeq);
+template PointBufferOf<FixedPointOrientationPolicy<std::int32_t>>::iterator
+ConvexHullInPlaceQuickHull<FixedPointOrientationPolicy<std::int32_t>>(
+  PointBufferOf<FixedPointOrientationPolicy<std::int32_t>>& pointSeq);
+template PointBufferOf<FixedPointOrientationPolicy<std::int64_t>>::iterator
+ConvexHullInPlaceQuickHull<FixedPointOrientationPolicy<std::int64_t>>(
+  PointBufferOf<FixedPointOrientationPolicy<std::int64_t>>& pointSeq);
+template std::vector<Point>::iterator TheirConvexHullInPlaceQuickHull<FastOrientationPolicy>(PointSequence& pointSeq);
+template std::vector<Point>::iterator TheirConvexHullInPlaceQuickHull<AdaptiveOrientationPolicy>(
+  PointSequence& pointSeq);
+template FixedPointSequence::iterator TheirConvexHullInPlaceQuickHull<FixedPointOrientationPolicy<std::int32_t>>(
+  FixedPointSequence& pointSeq);
+template WideFixedPointSequence::iterator TheirConvexHullInPlaceQuickHull<FixedPointOrientationPolicy<std::int64_t>>(
+  WideFixedPointSequence& pointSeq);
+template PointBufferOf<FastOrientationPolicy>::iterator TheirConvexHullInPlaceQuickHull<FastOrientationPolicy>(
+  PointBufferOf<FastOrientationPolicy>& pointSeq);
+template PointBufferOf<AdaptiveOrientationPolicy>::iterator TheirConvexHullInPlaceQuickHull<AdaptiveOrientationPolicy>(
+  PointBufferOf<AdaptiveOrientationPolicy>& pointSeq);
+template PointBufferOf<FixedPointOrientationPolicy<std::int32_t>>::iterator
+TheirConvexHullInPlaceQuickHull<FixedPointOrientationPolicy<std::int32_t>>(
+  PointBufferOf<FixedPointOrientationPolicy<std::int32_t>>& pointSeq);
+template PointBufferOf<FixedPointOrientationPolicy<std::int64_t>>::iterator
+TheirConvexHullInPlaceQuickHull<FixedPointOrientationPolicy<std::int64_t>>(
+  PointBufferOf<FixedPointOrientationPolicy<std::int64_t>>& pointSeq);
@@ -3,7 +3,11 @@
 #include <iostream>
 #include <vector>
 #include "ConvexHullQuickHull.h"
+#include "HullStatistics.h"
+#include "OrientationPredicates.h"
 #include "PointHandler.h"
+#include "SmallConvexHull.h"
+#include "TraceRecorder.h"
 
 const signed short int UPPER        = 0;
 const signed short int LOWER        = 1;
@@ -11,34 +15,42 @@ const signed short int LOWER        = 1;
 //
 // Local methods
 //
-void findHull(const PointSequence& pointSeq, const Point& p, const Point& q, CCWPointSequence& ccwPointSeq, 
-              const signed short int location);
+template <typename OrientationPolicy, typename PointType>
+void findHull(const std::vector<PointType>& pointSeq, const PointType& p, const PointType& q,
+              std::vector<PointType>& ccwPointSeq, const signed short int location);
 
 
 //********************
 // ConvexHullQuickHull
 //********************
 
-CCWPointSequence ConvexHullQuickHull(const PointSequence& pointSeq)
+template <typename OrientationPolicy, typename Allocator>
+PointSequenceOf<OrientationPolicy> ConvexHullQuickHull(const PointSequenceOf<OrientationPolicy, Allocator>& pointSeq)
 {
-  CCWPointSequence ccwPointSeq; // ccw means counterclockwise
+  using PointType = typename OrientationPolicy::PointType;
+  PointSequenceOf<OrientationPolicy> ccwPointSeq; // ccw means counterclockwise
 
-  // Check whether the point sequence "pointSeq" fulfills some minimal requirements for computing the convex hull from
-  // it. These requirements include that the point sequence contains at least three points and that it is not the case
-  // that all points are collinear. If it does not, return the empty point sequence.
-  if (! PointSequenceFulfillsMinimalRequirements(pointSeq))
+  // Small point sequences are processed by a small convex hull kernel (see "SmallConvexHull.h").
+  if (pointSeq.size() <= getSmallConvexHullThreshold())
+  {
+    computeSmallConvexHull<OrientationPolicy>(pointSeq, ccwPointSeq);
     return ccwPointSeq;
+  }
 
-  // Find the leftmost point with minimum x-coordinate and the rightmost point with maximum x-coordinate of the point
-  // sequence "pointSeq".
-  Point leftMostPoint = pointSeq[0], rightMostPoint = pointSeq[0];
-  size_t numOfElements = pointSeq.size();
+  // Scan the point sequence "pointSeq" once. The scan checks whether it fulfills some minimal requirements for
+  // computing the convex hull from it. These requirements include that the point sequence contains at least three
+  // points and that it is not the case that all points are collinear. If it does not, return the empty point sequence.
+  // The scan also finds the leftmost point with minimum x-coordinate and the rightmost point with maximum x-coordinate
+  // of the point sequence "pointSeq".
+  BasicPointSequenceScan<PointType> scan = scanPointSequence(pointSeq);
+  if (! scan.fulfillsMinimalRequirements)
+    return ccwPointSeq;
 
-  for(size_t i = 1; i < numOfElements; ++i)
-    if(pointSeq[i] < leftMostPoint)
-      leftMostPoint = pointSeq[i];
-    else if (pointSeq[i] > rightMostPoint)
-      rightMostPoint = pointSeq[i];
+  // The orientation policy may use the bounding box of the points to speed up the orientation tests.
+  typename OrientationPolicy::BoundingBoxScope boundingBoxScope(scan.minCorner, scan.maxCorner);
+
+  PointType leftMostPoint = pointSeq[scan.leftMostIndex], rightMostPoint = pointSeq[scan.rightMostIndex];
+  size_t numOfElements = pointSeq.size();
 
   // Split point sequence "pointSeq" into the two point sequences "pointSeqAbove" and "pointSeqBelow" that contain the
   // points above and below the directed segment (leftMostPoint, rightMostPoint) respectively. Points that are located
@@ -49,19 +61,24 @@ CCWPointSequence ConvexHullQuickHull(const PointSequence& pointSeq)
   // of the point sequence "pointSeq" are reserved. This avoids reallocations that especially for very high numbers of
   // points lead to program abortions due to memory allocation errors.
   Orientation pointOrientation;
-  PointSequence pointSeqAbove, pointSeqBelow;
+  PointSequenceOf<OrientationPolicy> pointSeqAbove, pointSeqBelow;
   pointSeqAbove.reserve(pointSeq.size());
   pointSeqBelow.reserve(pointSeq.size());
-  for (size_t i = 0; i < numOfElements; ++i)
   {
-    // Check where point "pointSeq[i]" is located with respect to the middle segment from point "leftMostPoint" to
-    // point "rightMostPoint".
-    pointOrientation = getOrientation(leftMostPoint, rightMostPoint, pointSeq[i]);
-    if (pointOrientation == Orientation::COUNTERCLOCKWISE) // Point "pointSeq[i]" is above segment.
-      pointSeqAbove.push_back(pointSeq[i]);
-    else if (pointOrientation == Orientation::CLOCKWISE) // Point "pointSeq[i]" is below segment.
-      pointSeqBelow.push_back(pointSeq[i]);
+    TRACE_SIZED_SPAN("top-level partition", numOfElements);
+    for (size_t i = 0; i < numOfElements; ++i)
+    {
+      // Check where point "pointSeq[i]" is located with respect to the middle segment from point "leftMostPoint" to
+      // point "rightMostPoint".
+      pointOrientation = OrientationPolicy::orientation(leftMostPoint, rightMostPoint, pointSeq[i]);
+      if (pointOrientation == Orientation::COUNTERCLOCKWISE) // Point "pointSeq[i]" is above segment.
+        pointSeqAbove.push_back(pointSeq[i]);
+      else if (pointOrientation == Orientation::CLOCKWISE) // Point "pointSeq[i]" is below segment.
+        pointSeqBelow.push_back(pointSeq[i]);
+    }
   }
+  COUNT_HULL_OPERATION(PARTITION_PASSES);
+  COUNT_HULL_OPERATIONS(POINT_COPIES, pointSeqAbove.size() + pointSeqBelow.size());
 
   // The leftmost point and the rightmost point definitely belong to the convex hull. Use the point sequence
   // "ccwPointSeq" to determine all those points (in arbitrary order) that belong to the lower convex hull including
@@ -76,22 +93,29 @@ CCWPointSequence ConvexHullQuickHull(const PointSequence& pointSeq)
   /* std::cout << "recursive for below \n"; */
 
   // Compute the lower convex hull recursively.
-  findHull(pointSeqBelow, leftMostPoint, rightMostPoint, ccwPointSeq, LOWER);
+  findHull<OrientationPolicy>(pointSeqBelow, leftMostPoint, rightMostPoint, ccwPointSeq, LOWER);
   ccwPointSeq.push_back(rightMostPoint);
   /* std::cout << "recursive for above \n"; */
   // Compute the upper convex hull recursively.
-  findHull(pointSeqAbove, rightMostPoint, leftMostPoint, ccwPointSeq, UPPER);
+  findHull<OrientationPolicy>(pointSeqAbove, rightMostPoint, leftMostPoint, ccwPointSeq, UPPER);
 
   return ccwPointSeq;
 }
 
 
 // Given the points "p" and "q" that are known to belong to the convex hull and the point sequence "pointSeq" whose
-// points are known to be located on the right side of the directed segment from "p" to "q", this method recursively
-// determines all points that belong to the convex hull of the points in the point sequence "pointSeq". These convex
-// hull points are stored in the point sequence "ccwPointSeq" in arbitrary (and not counterclockwise) order.
-void findHull(const PointSequence& pointSeq, const Point& p, const Point& q, CCWPointSequence& ccwPointSeq, const signed short int location)
+// points are known to be located strictly on the right side of the directed segment from "p" to "q", this method
+// recursively determines all points that belong to the convex hull of the points in the point sequence "pointSeq".
+// These convex hull points are stored in the point sequence "ccwPointSeq" in arbitrary (and not counterclockwise)
+// order. Duplicates and collinear points never enter a recursive call since the partition below only keeps points
+// that are strictly on the right side of the new segments.
+template <typename OrientationPolicy, typename PointType>
+void findHull(const std::vector<PointType>& pointSeq, const PointType& p, const PointType& q,
+              std::vector<PointType>& ccwPointSeq, const signed short int location)
 {
+  RECORD_HULL_SUBPROBLEM(pointSeq.size());
+  TRACE_SIZED_SPAN("findHull", pointSeq.size());
+
   // If the point sequence "pointSeq" is empty, nothing has to be done.
   if (pointSeq.size() == 0)
     return;
@@ -101,68 +125,96 @@ void findHull(const PointSequence& pointSeq, const Point& p, const Point& q, CCW
     ccwPointSeq.push_back(pointSeq[0]);
     return;
   }
-  // Find the point "furthestPoint" of the point sequence "pointSeq" that has the largest (minimal) distance from the
-  // segment defined by the points "p" and "q". This point belongs definitely to the convex hull and is stored in the
-  // point sequence "ccwPointSeq".
-  Number squaredDistanceFromPointToSegment, maxSquaredDistance = 0;
-  size_t index, numOfElements = pointSeq.size();
-  for(size_t i = 0; i < numOfElements; ++i)
+  // Find the point "furthestPoint" of the point sequence "pointSeq" that has the largest distance from the line
+  // through the points "p" and "q". This point belongs definitely to the convex hull and is stored in the point
+  // sequence "ccwPointSeq". For a fixed line, the distance is proportional to the area of the triangle defined by the
+  // points "p", "q", and the respective point, so that the areas can be compared without a division.
+  typename OrientationPolicy::Area area, maxArea;
+  size_t index = 0, numOfElements = pointSeq.size();
+  maxArea = OrientationPolicy::area(p, q, pointSeq[0]);
   {
-    squaredDistanceFromPointToSegment = computeSquaredDistanceFromPointToSegment(pointSeq[i], p, q);
-    if (maxSquaredDistance < squaredDistanceFromPointToSegment)
+    TRACE_SIZED_SPAN("find furthest", numOfElements);
+    for(size_t i = 1; i < numOfElements; ++i)
     {
-      maxSquaredDistance = squaredDistanceFromPointToSegment;
-      index = i;
+      area = OrientationPolicy::area(p, q, pointSeq[i]);
+      int comparison = OrientationPolicy::compareAreas(p, q, pointSeq[i], area, pointSeq[index], maxArea);
+      if (comparison > 0)
+      {
+        maxArea = area;
+        index = i;
+      }
+      else if (comparison == 0 && pointSeq[i] < pointSeq[index])
+        // If there are several points with the same largest distance to the line, they are collinear and we must
+        // ensure that none of the interior collinear points (and none of the duplicates) is selected for the convex
+        // hull. We achieve this by selecting the lexicographically smallest point; it will definitely belong to the
+        // convex hull. The other extreme point of all collinear points will be taken in the next recursive step of
+        // "findHull".
+        index = i;
     }
-    else if (maxSquaredDistance == squaredDistanceFromPointToSegment && pointSeq[i].x < pointSeq[index].x)
-      // If there are more than two points with the same largest distance to the segment, we must ensure that none of
-      // the interior collinear points are selected for the convex hull. We achieve this by selecting the point with
-      // the smallest x-coordinate; it will definitely belong to the convex hull. The point with the largest
-      // x-coordinate of all collinear points will be taken in the next recursive step of "findHull". 
-      index = i;
   }
-  Point furthestPoint = pointSeq[index];
+  PointType furthestPoint = pointSeq[index];
 
   // The point sequence "pointSeq" is split into the point sequence "pointseq1" of points that are located right of the
   // directed segment defined by the points "p" and "furthestPoint", and into the point sequence "pointseq2" of points
   // that are located right of the directed segment defined by the points "furthestPoint" and "q". The points of the
   // point sequence "pointSeq" that are located in the triangle defined by the points "p", "furthestPoint", and "q" are
   // ignored since they cannot be part of the convex hull.
-  PointSequence pointSeq1,pointSeq2;
-  if (location == LOWER)
+  std::vector<PointType> pointSeq1,pointSeq2;
   {
-    for(size_t i = 0; i < numOfElements; ++i)
-    if (pointSeq[i].x < furthestPoint.x)
+    TRACE_SIZED_SPAN("partition", numOfElements);
+    if (location == LOWER)
     {
-      if (getOrientation(p, furthestPoint, pointSeq[i]) == Orientation::CLOCKWISE)
-        pointSeq1.push_back(pointSeq[i]);
-    }
+      for(size_t i = 0; i < numOfElements; ++i)
+      if (pointSeq[i].x < furthestPoint.x)
+      {
+        if (OrientationPolicy::orientation(p, furthestPoint, pointSeq[i]) == Orientation::CLOCKWISE)
+          pointSeq1.push_back(pointSeq[i]);
+      }
+      else
+        if (OrientationPolicy::orientation(furthestPoint, q, pointSeq[i]) == Orientation::CLOCKWISE)
+          pointSeq2.push_back(pointSeq[i]);
+      }
     else
-      if (getOrientation(furthestPoint, q, pointSeq[i]) == Orientation::CLOCKWISE)
-        pointSeq2.push_back(pointSeq[i]);
-    }
-  else
-  {
-    for(size_t i = 0; i < numOfElements; ++i)
-    if (pointSeq[i].x > furthestPoint.x)
     {
-      if (getOrientation(p, furthestPoint, pointSeq[i]) == Orientation::CLOCKWISE)
-        pointSeq1.push_back(pointSeq[i]);
+      for(size_t i = 0; i < numOfElements; ++i)
+      if (pointSeq[i].x > furthestPoint.x)
+      {
+        if (OrientationPolicy::orientation(p, furthestPoint, pointSeq[i]) == Orientation::CLOCKWISE)
+          pointSeq1.push_back(pointSeq[i]);
+      }
+      else
+        if (OrientationPolicy::orientation(furthestPoint, q, pointSeq[i]) == Orientation::CLOCKWISE)
+          pointSeq2.push_back(pointSeq[i]);
     }
-    else
-      if (getOrientation(furthestPoint, q, pointSeq[i]) == Orientation::CLOCKWISE)
-        pointSeq2.push_back(pointSeq[i]);
   }
+  COUNT_HULL_OPERATION(PARTITION_PASSES);
+  COUNT_HULL_OPERATIONS(POINT_COPIES, pointSeq1.size() + pointSeq2.size());
   /* std::cout << "number of points left+right: " << pointSeq1.size() + pointSeq2.size() << "\n"; */
 
   /* std::cout << "recursive for left\n"; */
 
   // Recursively determine the convex hull points in the point sequence "pointSeq1" that are located on the right side
   // of the the segment between point "p" and point "furthestPoint". 
-  findHull(pointSeq1, p, furthestPoint, ccwPointSeq, location);
+  findHull<OrientationPolicy>(pointSeq1, p, furthestPoint, ccwPointSeq, location);
   ccwPointSeq.push_back(furthestPoint);
   // Recursively determine the convex hull points in the point sequence "pointSeq2" that are located on the right side
   // of the the segment between point "furthestPoint" and point "q".
   /* std::cout << "recursive for right\n"; */
-  findHull(pointSeq2, furthestPoint, q, ccwPointSeq, location);
+  findHull<OrientationPolicy>(pointSeq2, furthestPoint, q, ccwPointSeq, location);
 }
+
+// Explicit instantiations for the provided orientation policies and for the point sequences and the point buffers.
+template CCWPointSequence ConvexHullQuickHull<FastOrientationPolicy>(const PointSequence& pointSeq);
+template CCWPointSequence ConvexHullQuickHull<AdaptiveOrientationPolicy>(const PointSequence& pointSeq);
+template FixedPointSequence ConvexHullQuickHull<FixedPointOrientationPolicy<std::int32_t>>(
+  const FixedPointSequence& pointSeq);
+template WideFixedPointSequence ConvexHullQuickHull<FixedPointOrientationPolicy<std::int64_t>>(
+  const WideFixedPointSequence& pointSeq);
+template CCWPointSequence ConvexHullQuickHull<FastOrientationPolicy>(
+  const PointBufferOf<FastOrientationPolicy>& pointSeq);
+template CCWPointSequence ConvexHullQuickHull<AdaptiveOrientationPolicy>(
+  const PointBufferOf<AdaptiveOrientationPolicy>& pointSeq);
+template FixedPointSequence ConvexHullQuickHull<FixedPointOrientationPolicy<std::int32_t>>(
+  const PointBufferOf<FixedPointOrientationPolicy<std::int32_t>>& pointSeq);
+template WideFixedPointSequence ConvexHullQuickHull<FixedPointOrientationPolicy<std::int64_t>>(
+  const PointBufferOf<FixedPointOrientationPolicy<std::int64_t>>& pointSeq);
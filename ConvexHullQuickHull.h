@@ -1,12 +1,101 @@
 #ifndef CONVEXHULLQUICKHULL_H
 #define CONVEXHULLQUICKHULL_H
 
+#include <cstdint>
+#include <memory>
+#include <vector>
+#include "FixedPoint.h"
+#include "OrientationPredicates.h"
+#include "PointBuffer.h"
 #include "PointHandler.h"
 
-CCWPointSequence ConvexHullQuickHull(const PointSequence& pointSeq);
+// All convex hull algorithms accept arbitrary point sequences, including sequences with duplicates and with long runs
+// of collinear points, without any preprocessing. Their result consists of the vertices of the convex hull in
+// counterclockwise order, beginning with the lexicographically smallest point. Duplicates and collinear boundary
+// points, i.e., points on the boundary of the convex hull that are not vertices, are dropped. If the point sequence
+// has less than three distinct points or if all points are collinear, the result is empty. The in-place algorithms
+// reorder the point sequence such that the result is placed at its beginning and return the end of the result.
+//
+// The template parameter "OrientationPolicy" selects how the orientations of triplets of points are determined and
+// the type of the points (see "OrientationPredicates.h"). The algorithms are instantiated for "FastOrientationPolicy"
+// (the default) and for "AdaptiveOrientationPolicy", which yields exact results also for almost collinear points, as
+// well as for "FixedPointOrientationPolicy<std::int32_t>" and "FixedPointOrientationPolicy<std::int64_t>", which
+// process fixed-point points (see "FixedPoint.h").
+
+// Type of the point sequences that are processed with the orientation policy "OrientationPolicy". The allocator of the
+// point sequences is a template parameter of the algorithms, so that they also process the point buffers of the
+// performance tests (see "PointBufferOf"); their results are always point sequences with the standard allocator.
+template <typename OrientationPolicy, typename Allocator = std::allocator<typename OrientationPolicy::PointType>>
+using PointSequenceOf = std::vector<typename OrientationPolicy::PointType, Allocator>;
+
+// Type of the point buffers that keep the large input point sequences of the performance tests, which may be backed by
+// huge pages (see "PointBuffer.h").
+template <typename OrientationPolicy>
+using PointBufferOf = PointSequenceOf<OrientationPolicy, PointBufferAllocator<typename OrientationPolicy::PointType>>;
+
+template <typename OrientationPolicy = FastOrientationPolicy,
+          typename Allocator = std::allocator<typename OrientationPolicy::PointType>>
+PointSequenceOf<OrientationPolicy> ConvexHullQuickHull(const PointSequenceOf<OrientationPolicy, Allocator>& pointSeq);
 CCWPointSequence ConvexHullQuickHullJustification(PointSequence& pointSeqA, PointSequence& pointSeqB, 
                                                   const Point& leftMost, const Point& rightMost);
 
-std::vector<Point>::iterator ConvexHullInPlaceQuickHull(PointSequence& pointSeq);
-std::vector<Point>::iterator TheirConvexHullInPlaceQuickHull(PointSequence& pointSeq);
+template <typename OrientationPolicy = FastOrientationPolicy,
+          typename Allocator = std::allocator<typename OrientationPolicy::PointType>>
+typename PointSequenceOf<OrientationPolicy, Allocator>::iterator ConvexHullInPlaceQuickHull(
+  PointSequenceOf<OrientationPolicy, Allocator>& pointSeq);
+template <typename OrientationPolicy = FastOrientationPolicy,
+          typename Allocator = std::allocator<typename OrientationPolicy::PointType>>
+typename PointSequenceOf<OrientationPolicy, Allocator>::iterator TheirConvexHullInPlaceQuickHull(
+  PointSequenceOf<OrientationPolicy, Allocator>& pointSeq);
+
+extern template CCWPointSequence ConvexHullQuickHull<FastOrientationPolicy>(const PointSequence& pointSeq);
+extern template CCWPointSequence ConvexHullQuickHull<AdaptiveOrientationPolicy>(const PointSequence& pointSeq);
+extern template FixedPointSequence ConvexHullQuickHull<FixedPointOrientationPolicy<std::int32_t>>(
+  const FixedPointSequence& pointSeq);
+extern template WideFixedPointSequence ConvexHullQuickHull<FixedPointOrientationPolicy<std::int64_t>>(
+  const WideFixedPointSequence& pointSeq);
+extern template CCWPointSequence ConvexHullQuickHull<FastOrientationPolicy>(
+  const PointBufferOf<FastOrientationPolicy>& pointSeq);
+extern template CCWPointSequence ConvexHullQuickHull<AdaptiveOrientationPolicy>(
+  const PointBufferOf<AdaptiveOrientationPolicy>& pointSeq);
+extern template FixedPointSequence ConvexHullQuickHull<FixedPointOrientationPolicy<std::int32_t>>(
+  const PointBufferOf<FixedPointOrientationPolicy<std::int32_t>>& pointSeq);
+extern template WideFixedPointSequence ConvexHullQuickHull<FixedPointOrientationPolicy<std::int64_t>>(
+  const PointBufferOf<FixedPointOrientationPolicy<std::int64_t>>& pointSeq);
+extern template std::vector<Point>::iterator ConvexHullInPlaceQuickHull<FastOrientationPolicy>(
+  PointSequence& pointSeq);
+extern template std::vector<Point>::iterator ConvexHullInPlaceQuickHull<AdaptiveOrientationPolicy>(
+  PointSequence& pointSeq);
+extern template FixedPointSequence::iterator ConvexHullInPlaceQuickHull<FixedPointOrientationPolicy<std::int32_t>>(
+  FixedPointSequence& pointSeq);
+extern template WideFixedPointSequence::iterator ConvexHullInPlaceQuickHull<FixedPointOrientationPolicy<std::int64_t>>(
+  WideFixedPointSequence& pointSeq);
+extern template PointBufferOf<FastOrientationPolicy>::iterator ConvexHullInPlaceQuickHull<FastOrientationPolicy>(
+  PointBufferOf<FastOrientationPolicy>& pointSeq);
+extern template PointBufferOf<AdaptiveOrientationPolicy>::iterator
+ConvexHullInPlaceQuickHull<AdaptiveOrientationPolicy>(PointBufferOf<AdaptiveOrientationPolicy>& pointSeq);
+extern template PointBufferOf<FixedPointOrientationPolicy<std::int32_t>>::iterator
+ConvexHullInPlaceQuickHull<FixedPointOrientationPolicy<std::int32_t>>(
+  PointBufferOf<FixedPointOrientationPolicy<std::int32_t>>& pointSeq);
+extern template PointBufferOf<FixedPointOrientationPolicy<std::int64_t>>::iterator
+ConvexHullInPlaceQuickHull<FixedPointOrientationPolicy<std::int64_t>>(
+  PointBufferOf<FixedPointOrientationPolicy<std::int64_t>>& pointSeq);
+extern template std::vector<Point>::iterator TheirConvexHullInPlaceQuickHull<FastOrientationPolicy>(
+  PointSequence& pointSeq);
+extern template std::vector<Point>::iterator TheirConvexHullInPlaceQuickHull<AdaptiveOrientationPolicy>(
+  PointSequence& pointSeq);
+extern template FixedPointSequence::iterator TheirConvexHullInPlaceQuickHull<FixedPointOrientationPolicy<std::int32_t>>(
+  FixedPointSequence& pointSeq);
+extern template WideFixedPointSequence::iterator
+TheirConvexHullInPlaceQuickHull<FixedPointOrientationPolicy<std::int64_t>>(WideFixedPointSequence& pointSeq);
+extern template PointBufferOf<FastOrientationPolicy>::iterator TheirConvexHullInPlaceQuickHull<FastOrientationPolicy>(
+  PointBufferOf<FastOrientationPolicy>& pointSeq);
+extern template PointBufferOf<AdaptiveOrientationPolicy>::iterator
+TheirConvexHullInPlaceQuickHull<AdaptiveOrientationPolicy>(PointBufferOf<AdaptiveOrientationPolicy>& pointSeq);
+extern template PointBufferOf<FixedPointOrientationPolicy<std::int32_t>>::iterator
+TheirConvexHullInPlaceQuickHull<FixedPointOrientationPolicy<std::int32_t>>(
+  PointBufferOf<FixedPointOrientationPolicy<std::int32_t>>& pointSeq);
+extern template PointBufferOf<FixedPointOrientationPolicy<std::int64_t>>::iterator
+TheirConvexHullInPlaceQuickHull<FixedPointOrientationPolicy<std::int64_t>>(
+  PointBufferOf<FixedPointOrientationPolicy<std::int64_t>>& pointSeq);
 #endif // CONVEXHULLQUICKHULL_H
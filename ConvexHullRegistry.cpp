@@ -0,0 +1,92 @@
+
+#include <string>
+#include <utility>
+#include <vector>
+#include "ConvexHullQuickHull.h"
+#include "ConvexHullRegistry.h"
+#include "OrientationPredicates.h"
+
+//++++++++++++++
+// Local methods
+//++++++++++++++
+
+// Methods that call the convex hull algorithms through the uniform interface of the registry.
+template <typename OrientationPolicy>
+static size_t computeQuickHull(PointBufferOf<OrientationPolicy>& pointSeq,
+                               PointSequenceOf<OrientationPolicy>& convexHull)
+{
+  convexHull = ConvexHullQuickHull<OrientationPolicy>(pointSeq);
+  return convexHull.size();
+}
+
+template <typename OrientationPolicy>
+static size_t computeInPlaceQuickHull(PointBufferOf<OrientationPolicy>& pointSeq, PointSequenceOf<OrientationPolicy>&)
+{
+  return size_t(ConvexHullInPlaceQuickHull<OrientationPolicy>(pointSeq) - pointSeq.begin());
+}
+
+template <typename OrientationPolicy>
+static size_t computeTheirInPlaceQuickHull(PointBufferOf<OrientationPolicy>& pointSeq,
+                                           PointSequenceOf<OrientationPolicy>&)
+{
+  return size_t(TheirConvexHullInPlaceQuickHull<OrientationPolicy>(pointSeq) - pointSeq.begin());
+}
+
+//+++++++++++++++++++++++++++++++++++
+// Registry of convex hull algorithms
+//+++++++++++++++++++++++++++++++++++
+
+// Method that returns the registry of all convex hull algorithms for the orientation policy "OrientationPolicy".
+template <typename OrientationPolicy>
+const std::vector<ConvexHullAlgorithm<OrientationPolicy>>& getConvexHullAlgorithms()
+{
+  static const std::vector<ConvexHullAlgorithm<OrientationPolicy>> algorithms {
+    {"quickhull", "Quickhull algorithm", 1, false, MemoryClass::LINEAR, &computeQuickHull<OrientationPolicy>},
+    {"inplace-quickhull", "In place Quickhull algorithm", 2, true, MemoryClass::LOGARITHMIC,
+     &computeInPlaceQuickHull<OrientationPolicy>},
+    {"inplace-quickhull-2", "In place Quickhull-2 algorithm", 3, true, MemoryClass::LOGARITHMIC,
+     &computeTheirInPlaceQuickHull<OrientationPolicy>}
+  };
+
+  return algorithms;
+}
+
+// Method that returns the convex hull algorithm with the name "name" or nullptr if no algorithm has this name.
+template <typename OrientationPolicy>
+const ConvexHullAlgorithm<OrientationPolicy>* findConvexHullAlgorithm(const std::string& name)
+{
+  for (const ConvexHullAlgorithm<OrientationPolicy>& algorithm : getConvexHullAlgorithms<OrientationPolicy>())
+    if (algorithm.name == name)
+      return &algorithm;
+
+  return nullptr;
+}
+
+// Method that converts a memory class into a string
+std::string convertToString(MemoryClass memoryClass)
+{
+  switch (memoryClass)
+  {
+    case MemoryClass::LINEAR      : return "linear";
+    case MemoryClass::LOGARITHMIC : return "logarithmic";
+  }
+
+  return std::string();
+}
+
+template const std::vector<ConvexHullAlgorithm<FastOrientationPolicy>>&
+getConvexHullAlgorithms<FastOrientationPolicy>();
+template const std::vector<ConvexHullAlgorithm<AdaptiveOrientationPolicy>>&
+getConvexHullAlgorithms<AdaptiveOrientationPolicy>();
+template const std::vector<ConvexHullAlgorithm<FixedPointOrientationPolicy<std::int32_t>>>&
+getConvexHullAlgorithms<FixedPointOrientationPolicy<std::int32_t>>();
+template const std::vector<ConvexHullAlgorithm<FixedPointOrientationPolicy<std::int64_t>>>&
+getConvexHullAlgorithms<FixedPointOrientationPolicy<std::int64_t>>();
+template const ConvexHullAlgorithm<FastOrientationPolicy>*
+findConvexHullAlgorithm<FastOrientationPolicy>(const std::string& name);
+template const ConvexHullAlgorithm<AdaptiveOrientationPolicy>*
+findConvexHullAlgorithm<AdaptiveOrientationPolicy>(const std::string& name);
+template const ConvexHullAlgorithm<FixedPointOrientationPolicy<std::int32_t>>*
+findConvexHullAlgorithm<FixedPointOrientationPolicy<std::int32_t>>(const std::string& name);
+template const ConvexHullAlgorithm<FixedPointOrientationPolicy<std::int64_t>>*
+findConvexHullAlgorithm<FixedPointOrientationPolicy<std::int64_t>>(const std::string& name);
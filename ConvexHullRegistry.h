@@ -0,0 +1,72 @@
+#ifndef CONVEXHULLREGISTRY_H
+#define CONVEXHULLREGISTRY_H
+
+
+#include <cstdint>
+#include <string>
+#include <vector>
+#include "ConvexHullQuickHull.h"
+#include "OrientationPredicates.h"
+
+// The registry lists all convex hull algorithms that can be tested and compared by the performance tests. Each entry
+// describes an algorithm and calls it through a uniform interface, so that a test can select the algorithms at
+// runtime (e.g., by their names on the command line) and time them with the same code. The registry exists for each
+// orientation policy for which the algorithms are instantiated (see "ConvexHullQuickHull.h").
+
+// Type that indicates how much memory a convex hull algorithm needs in addition to the point sequence.
+enum class MemoryClass {LINEAR, LOGARITHMIC};
+
+template <typename OrientationPolicy>
+struct ConvexHullAlgorithm
+{
+  // Types of the point sequence whose convex hull is computed, which may be backed by huge pages (see
+  // "PointBufferOf"), and of the convex hull computed by a copying algorithm.
+  using PointSequenceType = PointBufferOf<OrientationPolicy>;
+  using ConvexHullType = PointSequenceOf<OrientationPolicy>;
+
+  // Short name of the algorithm that is used on the command line, e.g., "quickhull".
+  std::string name;
+  // Descriptive name of the algorithm that is used in the output, e.g., "Quickhull algorithm".
+  std::string description;
+  // Number that uniquely identifies the algorithm (starting with 1, see "AlgorithmRuntimeManager").
+  size_t algorithmNumber;
+  // Flag that indicates whether the algorithm reorders the point sequence such that the convex hull is placed at its
+  // beginning (in-place algorithm) or returns the convex hull as a new point sequence (copying algorithm).
+  bool isInPlace;
+  MemoryClass memoryClass;
+  // Method that computes the convex hull of the point sequence "pointSeq" and returns its number of points. An
+  // in-place algorithm places the convex hull at the beginning of "pointSeq"; a copying algorithm leaves "pointSeq"
+  // unchanged and stores the convex hull in "convexHull".
+  size_t (*computeConvexHull)(PointSequenceType& pointSeq, ConvexHullType& convexHull);
+};
+
+// Method that returns the registry of all convex hull algorithms for the orientation policy "OrientationPolicy" in the
+// order of their algorithm numbers.
+template <typename OrientationPolicy>
+const std::vector<ConvexHullAlgorithm<OrientationPolicy>>& getConvexHullAlgorithms();
+
+// Method that returns the convex hull algorithm with the name "name" or nullptr if no algorithm has this name.
+template <typename OrientationPolicy>
+const ConvexHullAlgorithm<OrientationPolicy>* findConvexHullAlgorithm(const std::string& name);
+
+// Method that converts a memory class into a string
+std::string convertToString(MemoryClass memoryClass);
+
+extern template const std::vector<ConvexHullAlgorithm<FastOrientationPolicy>>&
+getConvexHullAlgorithms<FastOrientationPolicy>();
+extern template const std::vector<ConvexHullAlgorithm<AdaptiveOrientationPolicy>>&
+getConvexHullAlgorithms<AdaptiveOrientationPolicy>();
+extern template const std::vector<ConvexHullAlgorithm<FixedPointOrientationPolicy<std::int32_t>>>&
+getConvexHullAlgorithms<FixedPointOrientationPolicy<std::int32_t>>();
+extern template const std::vector<ConvexHullAlgorithm<FixedPointOrientationPolicy<std::int64_t>>>&
+getConvexHullAlgorithms<FixedPointOrientationPolicy<std::int64_t>>();
+extern template const ConvexHullAlgorithm<FastOrientationPolicy>*
+findConvexHullAlgorithm<FastOrientationPolicy>(const std::string& name);
+extern template const ConvexHullAlgorithm<AdaptiveOrientationPolicy>*
+findConvexHullAlgorithm<AdaptiveOrientationPolicy>(const std::string& name);
+extern template const ConvexHullAlgorithm<FixedPointOrientationPolicy<std::int32_t>>*
+findConvexHullAlgorithm<FixedPointOrientationPolicy<std::int32_t>>(const std::string& name);
+extern template const ConvexHullAlgorithm<FixedPointOrientationPolicy<std::int64_t>>*
+findConvexHullAlgorithm<FixedPointOrientationPolicy<std::int64_t>>(const std::string& name);
+
+#endif // CONVEXHULLREGISTRY_H
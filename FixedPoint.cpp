@@ -0,0 +1,119 @@
+
+#include <algorithm>
+#include <cmath>        // std::nearbyint
+#include <iomanip>
+#include <iostream>
+#include <limits>
+#include <vector>
+#include "FixedPoint.h"
+#include "Number.h"
+#include "ParallelExecution.h"
+#include "PointHandler.h"
+
+// Minimal number of points that a thread converts. Smaller point sequences are converted by fewer threads since
+// creating a thread costs more than converting them.
+static const size_t MINIMAL_NUMBER_OF_POINTS_PER_CONVERSION_THREAD = size_t(1) << 16;
+
+// Method that returns the number of threads for converting "numberOfPoints" points.
+static size_t getNumberOfConversionThreads(size_t numberOfPoints, size_t numberOfThreads)
+{
+  return std::min(resolveNumberOfThreads(numberOfThreads),
+                  std::max<size_t>(1, numberOfPoints / MINIMAL_NUMBER_OF_POINTS_PER_CONVERSION_THREAD));
+}
+
+// Method that checks whether the coordinate "coordinate" is converted into fixed-point units whose absolute value does
+// not exceed "BasicFixedPoint<Integer>::MAX_COORDINATE". The comparison fails for NaN.
+template <typename Integer>
+static bool coordinateIsInRange(Number coordinate)
+{
+  return std::fabs(std::nearbyint(coordinate * FIXED_POINT_SCALE)) <
+         Number(BasicFixedPoint<Integer>::MAX_COORDINATE) + 1;
+}
+
+// Method that converts the coordinate "coordinate" into fixed-point units. The coordinate must be within the range of
+// the fixed-point type. The method returns "false" if the coordinate is not a multiple of 1/FIXED_POINT_SCALE, where
+// the deviation caused by rounding the decimal coordinate to a "Number" and by the scaling is tolerated.
+template <typename Integer>
+static inline bool convertCoordinate(Number coordinate, Integer& fixedPointCoordinate)
+{
+  Number scaledCoordinate = coordinate * FIXED_POINT_SCALE;
+  Number roundedCoordinate = std::nearbyint(scaledCoordinate);
+  Number tolerance = 1e-6 + 4 * std::numeric_limits<Number>::epsilon() * std::fabs(scaledCoordinate);
+
+  fixedPointCoordinate = Integer(roundedCoordinate);
+  return std::fabs(scaledCoordinate - roundedCoordinate) <= tolerance;
+}
+
+// Method that converts the point sequence "pointSeq" into the fixed-point sequence "fixedPointSeq" (see
+// "FixedPoint.h").
+template <typename Integer>
+bool convertToFixedPointSequence(const PointSequence& pointSeq, std::vector<BasicFixedPoint<Integer>>& fixedPointSeq,
+                                 size_t numberOfThreads)
+{
+  size_t numberOfPoints = pointSeq.size();
+
+  // Check the range of the coordinates with the bounding box of the points before anything is converted.
+  if (numberOfPoints > 0)
+  {
+    PointSequenceScan scan = scanPointSequence(pointSeq, numberOfThreads);
+    if (! (coordinateIsInRange<Integer>(scan.minCorner.x) && coordinateIsInRange<Integer>(scan.minCorner.y) &&
+           coordinateIsInRange<Integer>(scan.maxCorner.x) && coordinateIsInRange<Integer>(scan.maxCorner.y)))
+    {
+      std::cout << "ERROR: The bounding box from " << scan.minCorner << " to " << scan.maxCorner
+                << " exceeds the coordinate range of " << 8 * sizeof(Integer) << "-bit fixed-point points (at most "
+                << BasicFixedPoint<Integer>::MAX_COORDINATE << " fixed-point units in absolute value)!" << std::endl;
+      return false;
+    }
+  }
+
+  fixedPointSeq.resize(numberOfPoints);
+  numberOfThreads = getNumberOfConversionThreads(numberOfPoints, numberOfThreads);
+  std::vector<size_t> invalidIndexes(numberOfThreads, numberOfPoints);
+  runInParallel(numberOfThreads, [&](size_t threadIndex)
+  {
+    size_t end = getPartBegin(numberOfPoints, numberOfThreads, threadIndex + 1);
+    for (size_t i = getPartBegin(numberOfPoints, numberOfThreads, threadIndex); i < end; ++i)
+      if (! (convertCoordinate(pointSeq[i].x, fixedPointSeq[i].x) &
+             convertCoordinate(pointSeq[i].y, fixedPointSeq[i].y)) && invalidIndexes[threadIndex] == numberOfPoints)
+        invalidIndexes[threadIndex] = i;
+  });
+
+  for (size_t invalidIndex : invalidIndexes)
+    if (invalidIndex < numberOfPoints)
+    {
+      std::cout << "ERROR: The point (" << std::defaultfloat << std::setprecision(17) << pointSeq[invalidIndex].x
+                << ", " << pointSeq[invalidIndex].y << ") with index " << invalidIndex
+                << " has more decimal places than fixed-point points can keep!" << std::endl;
+      fixedPointSeq.clear();
+      return false;
+    }
+
+  return true;
+}
+
+// Method that converts the fixed-point sequence "fixedPointSeq" into the point sequence "pointSeq" (see
+// "FixedPoint.h").
+template <typename Integer>
+void convertToPointSequence(const std::vector<BasicFixedPoint<Integer>>& fixedPointSeq, PointSequence& pointSeq,
+                            size_t numberOfThreads)
+{
+  size_t numberOfPoints = fixedPointSeq.size();
+
+  pointSeq.resize(numberOfPoints);
+  numberOfThreads = getNumberOfConversionThreads(numberOfPoints, numberOfThreads);
+  runInParallel(numberOfThreads, [&](size_t threadIndex)
+  {
+    size_t end = getPartBegin(numberOfPoints, numberOfThreads, threadIndex + 1);
+    for (size_t i = getPartBegin(numberOfPoints, numberOfThreads, threadIndex); i < end; ++i)
+      pointSeq[i] = fixedPointSeq[i].toPoint();
+  });
+}
+
+template bool convertToFixedPointSequence(const PointSequence& pointSeq, FixedPointSequence& fixedPointSeq,
+                                          size_t numberOfThreads);
+template bool convertToFixedPointSequence(const PointSequence& pointSeq, WideFixedPointSequence& fixedPointSeq,
+                                          size_t numberOfThreads);
+template void convertToPointSequence(const FixedPointSequence& fixedPointSeq, PointSequence& pointSeq,
+                                     size_t numberOfThreads);
+template void convertToPointSequence(const WideFixedPointSequence& fixedPointSeq, PointSequence& pointSeq,
+                                     size_t numberOfThreads);
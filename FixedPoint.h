@@ -0,0 +1,109 @@
+#ifndef FIXEDPOINT_H
+#define FIXEDPOINT_H
+
+
+#include <cstddef>
+#include <cstdint>
+#include <ostream>
+#include <type_traits>
+#include <vector>
+#include "Number.h"
+#include "PointHandler.h"
+
+// The generated points (see "generateRandomPoints") have coordinates with at most two decimal places. A fixed-point
+// point stores such coordinates exactly as integer multiples of 1/FIXED_POINT_SCALE. With 32-bit integers, a point
+// takes 8 bytes instead of the 16 bytes of a point with "Number" coordinates, which halves the memory traffic of the
+// convex hull algorithms; 64-bit integers cover much larger coordinate ranges with 16 bytes per point. Since all
+// differences and cross products of the coordinates are computed exactly in 64-bit or 128-bit integers, the
+// orientation tests of fixed-point points are always exact (see "FixedPointOrientationPolicy" in
+// "OrientationPredicates.h").
+
+// Number of fixed-point units per coordinate unit, i.e., the coordinates are stored with two decimal places.
+constexpr Number FIXED_POINT_SCALE = 100;
+
+template <typename Integer>
+class BasicFixedPoint
+{
+  static_assert(std::is_same<Integer, std::int32_t>::value || std::is_same<Integer, std::int64_t>::value,
+                "Fixed-point coordinates must be 32-bit or 64-bit integers.");
+
+  public:
+  // Coordinates in fixed-point units.
+  Integer x;
+  Integer y;
+
+  // Type in which the differences of two coordinates are computed exactly.
+  using Difference = std::int64_t;
+
+  // Type in which the products of two differences and the cross products are computed exactly.
+  using Product = typename std::conditional<sizeof(Integer) == 4, std::int64_t, __int128>::type;
+
+  // Maximal absolute value of a coordinate. It guarantees that the differences of two coordinates fit into the type
+  // "Difference" and that the cross products, i.e., differences of two products of two differences, fit into the type
+  // "Product".
+  static constexpr Integer MAX_COORDINATE = (Integer(1) << (8 * sizeof(Integer) - 2)) - 1;
+
+  // Empty constructor: Initializes data members x and y with 0
+  BasicFixedPoint() : x(0), y(0) {}
+
+  // Constructor: Initializes data members x and y with the fixed-point coordinates x and y
+  BasicFixedPoint(Integer x, Integer y) : x(x), y(y) {}
+
+  // Comparison operators based on the lexicographical order on points
+  bool operator <  (const BasicFixedPoint& rhs) const { return (x < rhs.x || (x == rhs.x && y < rhs.y)); }
+  bool operator <= (const BasicFixedPoint& rhs) const { return (x < rhs.x || (x == rhs.x && y <= rhs.y)); }
+  bool operator >  (const BasicFixedPoint& rhs) const { return (x > rhs.x || (x == rhs.x && y > rhs.y)); }
+  bool operator == (const BasicFixedPoint& rhs) const { return (x == rhs.x && y == rhs.y); }
+  bool operator != (const BasicFixedPoint& rhs) const { return ! (*this == rhs); }
+
+  // Method that converts the fixed-point point into a point with "Number" coordinates.
+  Point toPoint() const { return Point(Number(x) / FIXED_POINT_SCALE, Number(y) / FIXED_POINT_SCALE); }
+
+  // Output method
+  friend std::ostream& operator << (std::ostream& os, const BasicFixedPoint& p) { return os << p.toPoint(); }
+};
+
+// Fixed-point point with 32-bit coordinates (8 bytes per point).
+using FixedPoint = BasicFixedPoint<std::int32_t>;
+
+// Fixed-point point with 64-bit coordinates (16 bytes per point).
+using WideFixedPoint = BasicFixedPoint<std::int64_t>;
+
+using FixedPointSequence = std::vector<FixedPoint>;
+using WideFixedPointSequence = std::vector<WideFixedPoint>;
+
+// Method that converts the point sequence "pointSeq" into the fixed-point sequence "fixedPointSeq" using
+// "numberOfThreads" threads (0 means the default number of threads). The bounding box of the point sequence is checked
+// first so that the conversion fails early if the coordinates exceed the range of the fixed-point type. Each
+// coordinate is rounded to the nearest multiple of 1/FIXED_POINT_SCALE; if a coordinate differs from it by more than
+// its floating-point rounding error, it has more decimal places than the fixed-point type can keep. In both cases,
+// the method prints an error message and returns "false".
+template <typename Integer>
+bool convertToFixedPointSequence(const PointSequence& pointSeq, std::vector<BasicFixedPoint<Integer>>& fixedPointSeq,
+                                 size_t numberOfThreads = 0);
+
+// Method that converts the fixed-point sequence "fixedPointSeq" into the point sequence "pointSeq" (e.g., the convex
+// hull computed from a fixed-point sequence).
+template <typename Integer>
+void convertToPointSequence(const std::vector<BasicFixedPoint<Integer>>& fixedPointSeq, PointSequence& pointSeq,
+                            size_t numberOfThreads = 0);
+
+// Methods that scan a fixed-point sequence exactly like the method "scanPointSequence" for point sequences (see
+// "PointHandler.h").
+template <typename Allocator>
+BasicPointSequenceScan<FixedPoint> scanPointSequence(const std::vector<FixedPoint, Allocator>& pointSeq,
+                                                     size_t numberOfThreads = 0);
+template <typename Allocator>
+BasicPointSequenceScan<WideFixedPoint> scanPointSequence(const std::vector<WideFixedPoint, Allocator>& pointSeq,
+                                                         size_t numberOfThreads = 0);
+
+extern template bool convertToFixedPointSequence(const PointSequence& pointSeq, FixedPointSequence& fixedPointSeq,
+                                                 size_t numberOfThreads);
+extern template bool convertToFixedPointSequence(const PointSequence& pointSeq, WideFixedPointSequence& fixedPointSeq,
+                                                 size_t numberOfThreads);
+extern template void convertToPointSequence(const FixedPointSequence& fixedPointSeq, PointSequence& pointSeq,
+                                            size_t numberOfThreads);
+extern template void convertToPointSequence(const WideFixedPointSequence& fixedPointSeq, PointSequence& pointSeq,
+                                            size_t numberOfThreads);
+
+#endif // FIXEDPOINT_H
@@ -0,0 +1,99 @@
+
+#include <algorithm>
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include "HullStatistics.h"
+
+//+++++++++++++++++++++++
+// Local data and methods
+//+++++++++++++++++++++++
+
+// Statistics of the threads that exited since the last reset and the mutex that protects them.
+static HullStatistics exitedThreadStatistics;
+static std::mutex exitedThreadStatisticsMutex;
+
+//++++++++++++++++
+// Hull statistics
+//++++++++++++++++
+
+// Method that converts an operation into a string
+std::string convertToString(HullOperation operation)
+{
+  switch (operation)
+  {
+    case HullOperation::ORIENTATION_TESTS    : return "orientation tests";
+    case HullOperation::DISTANCE_EVALUATIONS : return "distance evaluations";
+    case HullOperation::SWAPS                : return "swaps";
+    case HullOperation::POINT_COPIES         : return "point copies";
+    case HullOperation::PARTITION_PASSES     : return "partition passes";
+    case HullOperation::SUBPROBLEMS          : return "sub-problems";
+  }
+
+  return std::string();
+}
+
+// Method that adds the statistics "statistics" to these statistics.
+void HullStatistics::add(const HullStatistics& statistics)
+{
+  for (size_t i = 0; i < NUMBER_OF_HULL_OPERATIONS; ++i)
+    operationCounts[i] += statistics.operationCounts[i];
+  maximalRecursionDepth = std::max(maximalRecursionDepth, statistics.maximalRecursionDepth);
+  for (size_t i = 0; i < NUMBER_OF_SUBPROBLEM_SIZE_CLASSES; ++i)
+    subproblemSizeCounts[i] += statistics.subproblemSizeCounts[i];
+}
+
+// Method that returns the size class of a sub-problem with "size" points, i.e., the number of bits of "size".
+size_t HullStatistics::getSizeClass(size_t size)
+{
+  size_t sizeClass = 0;
+
+  for (; size > 0; size >>= 1)
+    ++sizeClass;
+
+  return sizeClass;
+}
+
+//+++++++++++++++++++++++++
+// Hull statistics recorder
+//+++++++++++++++++++++++++
+
+thread_local HullStatisticsRecorder::ThreadStatistics HullStatisticsRecorder::threadStatistics;
+
+// Constructor that records a sub-problem with "size" points in the calling thread.
+HullStatisticsRecorder::SubproblemScope::SubproblemScope(size_t size)
+{
+  ThreadStatistics& statistics = threadStatistics;
+
+  ++statistics.recursionDepth;
+  statistics.statistics.maximalRecursionDepth = std::max(statistics.statistics.maximalRecursionDepth,
+                                                         statistics.recursionDepth);
+  ++statistics.statistics.operationCounts[size_t(HullOperation::SUBPROBLEMS)];
+  ++statistics.statistics.subproblemSizeCounts[HullStatistics::getSizeClass(size)];
+}
+
+// Destructor that adds the statistics of the exiting thread to the statistics of the exited threads.
+HullStatisticsRecorder::ThreadStatistics::~ThreadStatistics()
+{
+  std::lock_guard<std::mutex> lock(exitedThreadStatisticsMutex);
+  exitedThreadStatistics.add(statistics);
+}
+
+// Method that resets the statistics of the calling thread and of the exited threads.
+void HullStatisticsRecorder::reset()
+{
+  std::lock_guard<std::mutex> lock(exitedThreadStatisticsMutex);
+
+  exitedThreadStatistics = HullStatistics();
+  threadStatistics.statistics = HullStatistics();
+}
+
+// Method that returns the statistics of the calling thread and of the threads that exited since the last reset.
+HullStatistics HullStatisticsRecorder::collect()
+{
+  std::lock_guard<std::mutex> lock(exitedThreadStatisticsMutex);
+  HullStatistics statistics = exitedThreadStatistics;
+
+  statistics.add(threadStatistics.statistics);
+  return statistics;
+}
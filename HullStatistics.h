@@ -0,0 +1,106 @@
+#ifndef HULLSTATISTICS_H
+#define HULLSTATISTICS_H
+
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+// Hull statistics count the operations that the convex hull algorithms perform (orientation tests, distance
+// evaluations, swaps, and so on) and the sizes of the sub-problems of their recursions, so that the operation counts
+// can be related to the runtimes and the expected O(n log h) behavior can be checked. The algorithms record them with
+// the macros below. They are only enabled if all files are compiled with "HULL_STATISTICS" defined as 1 (e.g., with
+// "make FLAGS=-DHULL_STATISTICS=1"); otherwise the macros expand to nothing and cost nothing. Runtimes measured with
+// enabled statistics include the counting and cannot be compared with runtimes measured without.
+//
+// The counters are kept per thread, so that the counting needs no synchronization. The counters of a thread are added
+// to global counters when the thread exits; hence, the collected statistics also include the work of the helper
+// threads of "runInParallel" (see "ParallelExecution.h").
+
+#ifndef HULL_STATISTICS
+#define HULL_STATISTICS 0
+#endif
+
+// Type that indicates a counted operation. The orientation tests and distance evaluations are counted by the
+// orientation policies (see "OrientationPredicates.h"), including those of the scan of the point sequence. Swaps that
+// "std::partition" performs internally are not counted, but its passes are.
+enum class HullOperation {ORIENTATION_TESTS, DISTANCE_EVALUATIONS, SWAPS, POINT_COPIES, PARTITION_PASSES, SUBPROBLEMS};
+
+constexpr size_t NUMBER_OF_HULL_OPERATIONS = 6;
+
+// Number of size classes of the sub-problems. Size class 0 contains the empty sub-problems and size class k > 0 the
+// sub-problems with 2^(k-1) to 2^k - 1 points.
+constexpr size_t NUMBER_OF_SUBPROBLEM_SIZE_CLASSES = 65;
+
+// Method that converts an operation into a string
+std::string convertToString(HullOperation operation);
+
+// Type that keeps the statistics of one or more runs of convex hull algorithms.
+struct HullStatistics
+{
+  // Numbers of the operations, indexed by the operations.
+  std::array<std::uint64_t, NUMBER_OF_HULL_OPERATIONS> operationCounts {};
+  // Maximal depth of the nested sub-problems.
+  size_t maximalRecursionDepth = 0;
+  // Numbers of the sub-problems, indexed by their size classes.
+  std::array<std::uint64_t, NUMBER_OF_SUBPROBLEM_SIZE_CLASSES> subproblemSizeCounts {};
+
+  // Method that adds the statistics "statistics" to these statistics.
+  void add(const HullStatistics& statistics);
+
+  // Method that returns the size class of a sub-problem with "size" points.
+  static size_t getSizeClass(size_t size);
+};
+
+class HullStatisticsRecorder
+{
+  public:
+    // Method that counts "number" operations "operation" in the calling thread.
+    static void count(HullOperation operation, std::uint64_t number = 1)
+    {
+      threadStatistics.statistics.operationCounts[size_t(operation)] += number;
+    }
+
+    // Type whose objects record a sub-problem with "size" points in the calling thread while they exist.
+    class SubproblemScope
+    {
+      public:
+        explicit SubproblemScope(size_t size);
+        ~SubproblemScope() { --threadStatistics.recursionDepth; }
+
+        SubproblemScope(const SubproblemScope&) = delete;
+        SubproblemScope& operator = (const SubproblemScope&) = delete;
+    };
+
+    // Method that resets the statistics of the calling thread and of the exited threads.
+    static void reset();
+
+    // Method that returns the statistics of the calling thread and of the threads that exited since the last reset.
+    // It must not be called while other threads record statistics.
+    static HullStatistics collect();
+
+  private:
+    // Type that keeps the statistics of a thread. Its destructor adds them to the statistics of the exited threads.
+    struct ThreadStatistics
+    {
+      HullStatistics statistics;
+      size_t recursionDepth = 0;
+
+      ~ThreadStatistics();
+    };
+
+    static thread_local ThreadStatistics threadStatistics;
+};
+
+#if HULL_STATISTICS
+#define COUNT_HULL_OPERATION(operation) HullStatisticsRecorder::count(HullOperation::operation)
+#define COUNT_HULL_OPERATIONS(operation, number) HullStatisticsRecorder::count(HullOperation::operation, number)
+#define RECORD_HULL_SUBPROBLEM(size) HullStatisticsRecorder::SubproblemScope hullSubproblemScope(size)
+#else
+#define COUNT_HULL_OPERATION(operation) ((void) 0)
+#define COUNT_HULL_OPERATIONS(operation, number) ((void) 0)
+#define RECORD_HULL_SUBPROBLEM(size) ((void) 0)
+#endif
+
+#endif // HULLSTATISTICS_H
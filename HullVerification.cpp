@@ -0,0 +1,247 @@
+
+#include <algorithm>
+#include <cstdint>
+#include <sstream>
+#include <string>
+#include <vector>
+#include "HullVerification.h"
+#include "OrientationPredicates.h"
+#include "ParallelExecution.h"
+
+//+++++++++++++++++++++++
+// Local data and methods
+//+++++++++++++++++++++++
+
+// Minimal number of points that a thread of the containment test gets; smaller point sequences use fewer threads.
+static const size_t MINIMAL_NUMBER_OF_POINTS_PER_VERIFICATION_THREAD = size_t(1) << 16;
+
+// Type that keeps the result of the containment test of a part of the point sequence.
+struct ContainmentTestOfPart
+{
+  // Index of the first point of the part that lies outside of the hull; the end of the part if there is none.
+  size_t outsideIndex;
+  // Flags that indicate which vertices of the hull equal a point of the part.
+  std::vector<bool> verticesAreFound;
+};
+
+// Method that returns a hull verification with the violation "violation".
+static HullVerification reportViolation(const std::string& violation)
+{
+  return HullVerification{false, violation};
+}
+
+// Method that checks whether the points "p" and "q" are the same. Unlike the comparison operator of "Point", it is
+// inlined.
+template <typename PointType>
+static inline bool isSamePoint(const PointType& p, const PointType& q)
+{
+  return p.x == q.x && p.y == q.y;
+}
+
+// Method that checks in O(h) whether the "h" points "hull" form a strictly convex, counterclockwise polygon that
+// begins with its lexicographically smallest vertex. It returns the violation or an empty string.
+template <typename ExactOrientationPolicy>
+static std::string checkConvexity(const typename ExactOrientationPolicy::PointType* hull, size_t h)
+{
+  std::ostringstream violation;
+  size_t i = 1;
+
+  // The vertices increase lexicographically up to the largest one (the lower hull) and decrease afterwards down to
+  // the first vertex (the upper hull). Duplicates violate both orders.
+  while (i < h && hull[i - 1] < hull[i])
+    ++i;
+  while (i < h && hull[i] < hull[i - 1])
+    ++i;
+  if (i < h || !(hull[0] < hull[h - 1]))
+  {
+    violation << "The hull points are not ordered like a counterclockwise convex polygon that begins with its "
+              << "lexicographically smallest vertex (at hull index " << ((i < h) ? i : 0) << ").";
+    return violation.str();
+  }
+
+  // Together with the orders, left turns at all vertices make the polygon strictly convex.
+  for (i = 0; i < h; ++i)
+    if (ExactOrientationPolicy::orientation(hull[i], hull[(i + 1) % h], hull[(i + 2) % h]) !=
+        Orientation::COUNTERCLOCKWISE)
+    {
+      violation << "The hull does not turn left strictly at hull index " << (i + 1) % h << ".";
+      return violation.str();
+    }
+
+  return std::string();
+}
+
+// Method that checks whether the point "q" lies inside or on the strictly convex, counterclockwise polygon of the
+// "h" points "hull" (h >= 3) whose bounding box has the corners "minCorner" and "maxCorner". The point is located in
+// the fan of triangles (hull[0], hull[i], hull[i + 1]) by a binary search. If it equals a vertex, the method returns
+// the index of the vertex in "vertexIndex"; otherwise, it stores "h" there.
+template <typename ExactOrientationPolicy>
+static bool isInsideOrOnHull(const typename ExactOrientationPolicy::PointType& q,
+                             const typename ExactOrientationPolicy::PointType* hull, size_t h,
+                             const typename ExactOrientationPolicy::PointType& minCorner,
+                             const typename ExactOrientationPolicy::PointType& maxCorner, size_t& vertexIndex)
+{
+  const typename ExactOrientationPolicy::PointType& first = hull[0];
+
+  vertexIndex = h;
+  // A point outside of the bounding box lies outside of the hull; all other points are within the bounding box scope
+  // of the orientation tests.
+  if (q.x < minCorner.x || q.x > maxCorner.x || q.y < minCorner.y || q.y > maxCorner.y)
+    return false;
+  // The point must lie within the wedge of the fan, i.e., not to the right of the ray from the first vertex through
+  // the second one and not to the left of the ray through the last one.
+  if (ExactOrientationPolicy::orientation(first, hull[1], q) == Orientation::CLOCKWISE ||
+      ExactOrientationPolicy::orientation(first, hull[h - 1], q) == Orientation::COUNTERCLOCKWISE)
+    return false;
+
+  // Find the last vertex "hull[low]" such that the point does not lie to the right of the ray through it. The search
+  // halves the candidates "hull[low]", ..., "hull[low + length - 1]" with conditional moves instead of branches, which
+  // would be mispredicted for half of the points.
+  size_t low = 1, length = h - 1;
+  while (length > 1)
+  {
+    size_t half = length / 2;
+    low = (ExactOrientationPolicy::orientation(first, hull[low + half], q) != Orientation::CLOCKWISE) ? low + half
+                                                                                                       : low;
+    length -= half;
+  }
+
+  // On the ray through the last vertex (which includes the first vertex), the point must not lie beyond the last
+  // vertex. Since the first vertex is the lexicographically smallest one, the points of the ray are ordered by their
+  // distance from it.
+  if (low == h - 1)
+  {
+    if (isSamePoint(q, first))
+      vertexIndex = 0;
+    else if (isSamePoint(q, hull[h - 1]))
+      vertexIndex = h - 1;
+    return q.x < hull[h - 1].x || (q.x == hull[h - 1].x && q.y <= hull[h - 1].y);
+  }
+  // Only a point on the line through the edge can equal one of its vertices.
+  Orientation orientation = ExactOrientationPolicy::orientation(hull[low], hull[low + 1], q);
+  if (orientation == Orientation::COLLINEAR)
+  {
+    if (isSamePoint(q, hull[low]))
+      vertexIndex = low;
+    else if (isSamePoint(q, hull[low + 1]))
+      vertexIndex = low + 1;
+  }
+  return orientation != Orientation::CLOCKWISE;
+}
+
+// Method that verifies that the "numberOfHullPoints" points starting at "convexHull" are the convex hull of the point
+// sequence "pointSeq" with the exact orientation policy "ExactOrientationPolicy". The containment test is made by
+// "numberOfThreads" threads.
+template <typename ExactOrientationPolicy>
+static HullVerification verifyConvexHullExactly(
+  const std::vector<typename ExactOrientationPolicy::PointType>& pointSeq,
+  const typename ExactOrientationPolicy::PointType* convexHull, size_t numberOfHullPoints, size_t numberOfThreads)
+{
+  size_t numberOfPoints = pointSeq.size(), h = numberOfHullPoints;
+  std::ostringstream violation;
+
+  if (h == 0 || h > numberOfPoints)
+  {
+    bool fulfillsMinimalRequirements = scanPointSequence(pointSeq, numberOfThreads).fulfillsMinimalRequirements;
+    if (h == 0 && !fulfillsMinimalRequirements)
+      return HullVerification{true, std::string()};
+    violation << "The hull has " << h << " points for a point sequence of " << numberOfPoints << " points that "
+              << (fulfillsMinimalRequirements ? "fulfills" : "does not fulfill") << " the minimal requirements.";
+    return reportViolation(violation.str());
+  }
+  if (h < 3)
+  {
+    violation << "The hull has " << h << " points; a non-empty hull has at least three points.";
+    return reportViolation(violation.str());
+  }
+
+  // The orientation tests are made within the bounding box of the hull, so that the adaptive orientation policy
+  // mostly decides them by its static error bound.
+  typename ExactOrientationPolicy::PointType minCorner = convexHull[0], maxCorner = convexHull[0];
+  for (size_t i = 1; i < h; ++i)
+  {
+    minCorner.x = std::min(minCorner.x, convexHull[i].x);
+    minCorner.y = std::min(minCorner.y, convexHull[i].y);
+    maxCorner.x = std::max(maxCorner.x, convexHull[i].x);
+    maxCorner.y = std::max(maxCorner.y, convexHull[i].y);
+  }
+  std::string convexityViolation;
+  {
+    typename ExactOrientationPolicy::BoundingBoxScope boundingBoxScope(minCorner, maxCorner);
+    convexityViolation = checkConvexity<ExactOrientationPolicy>(convexHull, h);
+  }
+  if (!convexityViolation.empty())
+    return reportViolation(convexityViolation);
+
+  // Each thread tests a consecutive part of the point sequence and stops at its first point outside of the hull.
+  numberOfThreads = std::min(resolveNumberOfThreads(numberOfThreads),
+                             std::max<size_t>(1, numberOfPoints / MINIMAL_NUMBER_OF_POINTS_PER_VERIFICATION_THREAD));
+  std::vector<ContainmentTestOfPart> containmentTests(numberOfThreads);
+  runInParallel(numberOfThreads, [&](size_t threadIndex)
+  {
+    ContainmentTestOfPart& test = containmentTests[threadIndex];
+    size_t end = getPartBegin(numberOfPoints, numberOfThreads, threadIndex + 1), vertexIndex;
+    typename ExactOrientationPolicy::BoundingBoxScope boundingBoxScope(minCorner, maxCorner);
+
+    test.verticesAreFound.assign(h, false);
+    for (test.outsideIndex = getPartBegin(numberOfPoints, numberOfThreads, threadIndex); test.outsideIndex < end;
+         ++test.outsideIndex)
+    {
+      if (!isInsideOrOnHull<ExactOrientationPolicy>(pointSeq[test.outsideIndex], convexHull, h, minCorner, maxCorner,
+                                                    vertexIndex))
+        break;
+      if (vertexIndex < h)
+        test.verticesAreFound[vertexIndex] = true;
+    }
+  });
+
+  std::vector<bool> verticesAreFound(h, false);
+  for (size_t k = 0; k < numberOfThreads; ++k)
+  {
+    if (containmentTests[k].outsideIndex < getPartBegin(numberOfPoints, numberOfThreads, k + 1))
+    {
+      violation << "The point " << pointSeq[containmentTests[k].outsideIndex] << " (index "
+                << containmentTests[k].outsideIndex << ") lies outside of the hull.";
+      return reportViolation(violation.str());
+    }
+    for (size_t i = 0; i < h; ++i)
+      if (containmentTests[k].verticesAreFound[i])
+        verticesAreFound[i] = true;
+  }
+  for (size_t i = 0; i < h; ++i)
+    if (!verticesAreFound[i])
+    {
+      violation << "The hull point " << convexHull[i] << " (hull index " << i << ") is no point of the point sequence.";
+      return reportViolation(violation.str());
+    }
+
+  return HullVerification{true, std::string()};
+}
+
+//++++++++++++++++++
+// Hull verification
+//++++++++++++++++++
+
+// Method that verifies the convex hull of a point sequence. Without a bounding box scope, the adaptive orientation
+// policy is exact.
+HullVerification verifyConvexHull(const PointSequence& pointSeq, const Point* convexHull, size_t numberOfHullPoints,
+                                  size_t numberOfThreads)
+{
+  return verifyConvexHullExactly<AdaptiveOrientationPolicy>(pointSeq, convexHull, numberOfHullPoints,
+                                                            numberOfThreads);
+}
+
+// Methods that verify the convex hull of a fixed-point sequence.
+HullVerification verifyConvexHull(const FixedPointSequence& pointSeq, const FixedPoint* convexHull,
+                                  size_t numberOfHullPoints, size_t numberOfThreads)
+{
+  return verifyConvexHullExactly<FixedPointOrientationPolicy<std::int32_t>>(pointSeq, convexHull, numberOfHullPoints,
+                                                                            numberOfThreads);
+}
+
+HullVerification verifyConvexHull(const WideFixedPointSequence& pointSeq, const WideFixedPoint* convexHull,
+                                  size_t numberOfHullPoints, size_t numberOfThreads)
+{
+  return verifyConvexHullExactly<FixedPointOrientationPolicy<std::int64_t>>(pointSeq, convexHull, numberOfHullPoints,
+                                                                            numberOfThreads);
+}
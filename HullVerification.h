@@ -0,0 +1,44 @@
+#ifndef HULLVERIFICATION_H
+#define HULLVERIFICATION_H
+
+
+#include <cstddef>
+#include <string>
+#include "FixedPoint.h"
+#include "PointHandler.h"
+
+// The hull verification checks the result of a convex hull algorithm for a point sequence against the contract of
+// the algorithms (see "ConvexHullQuickHull.h"), so that wrong results are noticed in the performance test. It is fast
+// enough to check every run, even for 100000000 points:
+// - The hull must be strictly convex and counterclockwise and begin with its lexicographically smallest vertex. This
+//   is checked in O(h) for h hull points: the vertices must increase lexicographically up to the largest one and
+//   decrease afterwards, and all consecutive triplets (including the ones that wrap around) must turn left.
+// - All points of the point sequence must lie inside or on the hull. Each point is located in the fan of triangles
+//   from the first vertex by a binary search and then tested against the edge of its triangle, which costs O(log h)
+//   orientation tests per point, i.e., O(n log h) for n points instead of O(n h) for testing all edges. The points
+//   are tested by several threads (see "ParallelExecution.h").
+// - All vertices must be points of the point sequence. Since a point that equals a vertex is located in the triangle
+//   of this vertex, this is checked during the containment test with two comparisons per point.
+// - The hull must be empty if and only if the point sequence does not fulfill the minimal requirements (see
+//   "PointSequenceFulfillsMinimalRequirements" in "PointHandler.h").
+// All orientation tests are exact, independently of the orientation policy of the tested algorithm, so that the
+// verification also reveals the rounding errors of the fast orientation policy.
+
+// Type that keeps the result of a hull verification.
+struct HullVerification
+{
+  bool isValid = false;
+  // Description of the violation that was found; empty if the hull is valid.
+  std::string violation;
+};
+
+// Methods that verify that the "numberOfHullPoints" points starting at "convexHull" are the convex hull of the point
+// sequence "pointSeq". The points are tested by "numberOfThreads" threads (0 means the default number of threads).
+HullVerification verifyConvexHull(const PointSequence& pointSeq, const Point* convexHull, size_t numberOfHullPoints,
+                                  size_t numberOfThreads = 0);
+HullVerification verifyConvexHull(const FixedPointSequence& pointSeq, const FixedPoint* convexHull,
+                                  size_t numberOfHullPoints, size_t numberOfThreads = 0);
+HullVerification verifyConvexHull(const WideFixedPointSequence& pointSeq, const WideFixedPoint* convexHull,
+                                  size_t numberOfHullPoints, size_t numberOfThreads = 0);
+
+#endif // HULLVERIFICATION_H
@@ -0,0 +1,304 @@
+#ifndef INPLACEQUICKHULLKERNELS_H
+#define INPLACEQUICKHULLKERNELS_H
+
+
+#include <algorithm>
+#include <cstddef>
+#include <iterator>
+#include <utility>
+#include "HullStatistics.h"
+#include "OrientationPredicates.h"
+#include "PointHandler.h"
+#include "TraceRecorder.h"
+
+// The kernels are the loops over the points that the in place quickhulls (see "ConvexHullInplaceQuickHull.cpp")
+// spend their time in: the partitions, the searches of the furthest point, and the block moves. They are templates of
+// the orientation policy (see "OrientationPredicates.h") and of the iterator type, so that they are compiled into
+// the algorithms and can also be timed in isolation by the kernel microbenchmark (see "KernelMicrobenchmark.cpp").
+
+//*****************************************
+// Kernels used by both in place quickhulls
+//*****************************************
+// Method that swaps the points that the iterators "first" and "second" refer to and counts the swap.
+template <typename I>
+inline void swapPoints(I first, I second)
+{
+  COUNT_HULL_OPERATION(SWAPS);
+  std::iter_swap(first, second);
+}
+
+//***************************************
+// Kernels used by our in place quickhull
+//***************************************
+// Partition the points placed in the lower of middle segment. 
+template <typename OrientationPolicy, typename I>
+void lowerPartition(I& itrForNextOfLastPointOfFirstGroup, I& itrForFirstPointOfSecondGroup, 
+                    const I& leftMostP, const I& rightMostP, const I& furthestP)
+{ 
+  COUNT_HULL_OPERATION(PARTITION_PASSES);
+  TRACE_SIZED_SPAN("partition", std::distance(itrForNextOfLastPointOfFirstGroup, itrForFirstPointOfSecondGroup) + 1);
+  // Initialize current to the first of the points.
+  I current = itrForNextOfLastPointOfFirstGroup;
+  while (current != itrForFirstPointOfSecondGroup)
+  {
+    // without Orienting vector.
+    if (OrientationPolicy::orientation(*leftMostP, *furthestP, *current) == Orientation::CLOCKWISE)
+    {
+      swapPoints(current, itrForNextOfLastPointOfFirstGroup);
+      itrForNextOfLastPointOfFirstGroup++;
+      current++;
+    }
+
+    else if (OrientationPolicy::orientation(*furthestP, *rightMostP, *current) == Orientation::CLOCKWISE)
+    {
+      swapPoints(current, itrForFirstPointOfSecondGroup);
+      itrForFirstPointOfSecondGroup--;
+    }
+    else
+      current++;
+    
+    /* if ((*current).x < (*furthestP).x) // Orienting vector.
+     * {
+     *   if (OrientationPolicy::orientation(*leftMostP, *furthestP, *current) == Orientation::CLOCKWISE)
+     *   {
+     *     swapPoints(current, itrForNextOfLastPointOfFirstGroup);
+     *     itrForNextOfLastPointOfFirstGroup++;
+     *   }
+     *   current++;
+     * }
+     * else
+     * {
+     *   if (OrientationPolicy::orientation(*furthestP, *rightMostP, *current) == Orientation::CLOCKWISE)
+     *   {
+     *     swapPoints(current, itrForFirstPointOfSecondGroup);
+     *     itrForFirstPointOfSecondGroup--;
+     *   }
+     *   else
+     *     current++;
+     * } */
+  }
+  // for the element that is not checked in the loop. It is classified exactly like in the loop, so that points that
+  // are collinear with one of the two segments (e.g., duplicates of the furthest point) are discarded.
+  if (OrientationPolicy::orientation(*leftMostP, *furthestP, *current) == Orientation::CLOCKWISE)
+  {
+    swapPoints(current, itrForNextOfLastPointOfFirstGroup);
+    itrForNextOfLastPointOfFirstGroup++;
+    itrForFirstPointOfSecondGroup++;
+  }
+  else if (OrientationPolicy::orientation(*furthestP, *rightMostP, *current) != Orientation::CLOCKWISE)
+    itrForFirstPointOfSecondGroup++;
+
+}
+
+// Partition the points placed in the upper of middle segment. 
+template <typename OrientationPolicy, typename I>
+void upperPartition(I& itrForNextOfLastPointOfFirstGroup, I& itrForFirstPointOfSecondGroup, 
+                    const I& leftMostP, const I& rightMostP, const I& furthestP)
+{
+  COUNT_HULL_OPERATION(PARTITION_PASSES);
+  TRACE_SIZED_SPAN("partition", std::distance(itrForNextOfLastPointOfFirstGroup, itrForFirstPointOfSecondGroup) + 1);
+  // Initialize current to the first of the points.
+  I current = itrForNextOfLastPointOfFirstGroup;
+  while (current != itrForFirstPointOfSecondGroup)
+  {
+    // without Orienting vector
+    if (OrientationPolicy::orientation(*leftMostP, *furthestP, *current) == Orientation::CLOCKWISE)
+    {
+      swapPoints(current, itrForNextOfLastPointOfFirstGroup);
+      itrForNextOfLastPointOfFirstGroup++;
+      current++;
+    }
+    else if (OrientationPolicy::orientation(*furthestP, *rightMostP, *current) == Orientation::CLOCKWISE)
+    {
+      swapPoints(current, itrForFirstPointOfSecondGroup);
+      itrForFirstPointOfSecondGroup--;
+    }
+    else
+      current++;
+    
+    /* // with orienting vector
+     * if ((*current).x > (*furthestP).x)
+     * {
+     *   if (OrientationPolicy::orientation(*leftMostP, *furthestP, *current) == Orientation::CLOCKWISE)
+     *   {
+     *     swapPoints(current, itrForNextOfLastPointOfFirstGroup);
+     *     itrForNextOfLastPointOfFirstGroup++;
+     *   }
+     *   current++;
+     * }
+     * else
+     * {
+     *   if (OrientationPolicy::orientation(*furthestP, *rightMostP, *current) == Orientation::CLOCKWISE)
+     *   {
+     *     swapPoints(current, itrForFirstPointOfSecondGroup);
+     *     itrForFirstPointOfSecondGroup--;
+     *   }
+     *   else
+     *     current++;
+     * } */
+  }
+  // for the element that is not checked in the loop. It is classified exactly like in the loop, so that points that
+  // are collinear with one of the two segments (e.g., duplicates of the furthest point) are discarded.
+  if (OrientationPolicy::orientation(*leftMostP, *furthestP, *current) == Orientation::CLOCKWISE)
+  {
+    swapPoints(current, itrForNextOfLastPointOfFirstGroup);
+    itrForNextOfLastPointOfFirstGroup++;
+    itrForFirstPointOfSecondGroup++;
+  }
+  else if (OrientationPolicy::orientation(*furthestP, *rightMostP, *current) != Orientation::CLOCKWISE)
+    itrForFirstPointOfSecondGroup++;
+}
+
+// Method that partitions the points [first, last) into the points that are not right of the segment (leftMostP,
+// rightMostP) followed by the points right of it and returns the first point of the second group.
+template <typename OrientationPolicy, typename I>
+I partition_right_left(I first, I last, const I& leftMostP, const I& rightMostP) 
+{
+  /* assert(first != last); */
+  using P = typename std::iterator_traits<I>::value_type;
+  COUNT_HULL_OPERATION(PARTITION_PASSES);
+  TRACE_SIZED_SPAN("top-level partition", std::distance(first, last));
+  I middle = std::partition(first, last,
+    [&](P const& q) -> bool {
+      // not left_turn(*pole, q, *antipole);
+      return Orientation::CLOCKWISE != OrientationPolicy::orientation(*leftMostP, q, *rightMostP);
+    });
+  return middle;
+}
+
+// Method that returns the point of [first, past) that is furthest from the line through "leftMost" and "rightMost".
+template <typename OrientationPolicy, typename I>
+I find_furthest(I first, I past, I leftMost, I rightMost) 
+{
+  // The distance of a point from the line through the points "leftMost" and "rightMost" is proportional to the area
+  // of the triangle defined by these points and the point, so that the areas can be compared without a division.
+  TRACE_SIZED_SPAN("find furthest", std::distance(first, past));
+  I furthest = first;
+  typename OrientationPolicy::Area area, maxArea = OrientationPolicy::area(*leftMost, *rightMost, *first);
+
+  for (I i = std::next(first); i != past; ++i) 
+  {
+    area = OrientationPolicy::area(*leftMost, *rightMost, *i);
+    int comparison = OrientationPolicy::compareAreas(*leftMost, *rightMost, *i, area, *furthest, maxArea);
+    if (comparison > 0)
+    {
+      maxArea = area;
+      furthest = i;
+    }
+    else if (comparison == 0 && *i < *furthest)
+      // If there are several points with the same largest distance to the line, they are collinear and we must ensure
+      // that none of the interior collinear points (and none of the duplicates) is selected for the convex hull. We
+      // achieve this by selecting the lexicographically smallest point; it will definitely belong to the convex hull.
+      // The other extreme point of all collinear points will be taken in the next recursive step of "findHull".
+      furthest = i;
+  }
+  return furthest;
+}
+
+//*****************************************
+// Kernels used by their in place quickhull
+//*****************************************
+// Method that swaps the points "rd" and "th" to the positions "st" and "nd" (also if "th" is at "st").
+template <typename I>
+void parallel_iter_swap(I st, I nd, I rd, I th) 
+{
+  /* assert(st != nd and rd != th); */
+  swapPoints(st, rd);
+  if (th == st) {
+    swapPoints(nd, rd);
+  }
+  else {
+    swapPoints(nd, th);
+  }
+}
+
+// Method that partitions the points after the pole "first" in [first, past) into the points that are not left of
+// the segment (pole, antipole) followed by the points left of it and returns the first point of the second group.
+template <typename OrientationPolicy, typename I>
+I partition_left_right(I first, I past, I antipole) 
+{
+  /* assert(first != past); */
+  using P = typename std::iterator_traits<I>::value_type;
+  COUNT_HULL_OPERATION(PARTITION_PASSES);
+  TRACE_SIZED_SPAN("partition", std::distance(first, past));
+  I pole = first;
+  I middle = std::partition(std::next(pole), past,
+    [&](P const& q) -> bool {
+      // not left_turn(*pole, q, *antipole);
+      return Orientation::COUNTERCLOCKWISE != OrientationPolicy::orientation(*pole, q, *antipole);
+    });
+  return middle;
+}
+
+// Method that moves the block [source, past) to "target" by a cycle of copies; the points at "target" move to the
+// old place of the block.
+template <typename I>
+void swap_blocks(I source, I past, I target) 
+{
+  if (source == target or source == past) {
+    return;
+  }
+  using P = typename std::iterator_traits<I>::value_type;
+  // The block of n points is moved with 2 n + 1 copies.
+  COUNT_HULL_OPERATIONS(POINT_COPIES, 2 * std::distance(source, past) + 1);
+  I hole = target;
+  P p = *target;
+  I const last = std::prev(past);
+  while (true) {
+    *hole = *source;
+    ++hole;
+    if (source == last) {
+      break;
+    }
+    *source = *hole;
+    ++source;
+  }
+  *source = p;
+}
+
+// Method that moves the points [here, rest) behind the points [rest, past) with the fewest point copies.
+template <typename I>
+void move_away(I here, I rest, I past) 
+{
+  if (here == rest or rest == past) {
+    return;
+  }
+  TRACE_SIZED_SPAN("move away", std::distance(here, past));
+  if (std::distance(here, rest) < std::distance(rest, past)) {
+    I target = past;
+    std::advance(target, -std::distance(here, rest));
+    swap_blocks(here, rest, target);
+  }
+  else {
+    swap_blocks(rest, past, here);
+  }
+}
+
+// Method that returns the point of [first, past) that is furthest from the line through the pole "first" and
+// "antipole".
+template <typename OrientationPolicy, typename I>
+I find_furthest(I first, I past, I antipole) 
+{
+  TRACE_SIZED_SPAN("find furthest", std::distance(first, past));
+  I pole = first;
+  I answer = pole;
+  // The pole itself has the area 0.
+  typename OrientationPolicy::Area area, maxArea = 0;
+
+  for (I i = std::next(first); i != past; ++i) 
+  {
+    area = OrientationPolicy::area(*pole, *antipole, *i);
+    int comparison = OrientationPolicy::compareAreas(*pole, *antipole, *i, area, *answer, maxArea);
+    if (comparison > 0)
+    {
+      maxArea = area;
+      answer = i;
+    }
+    else if (comparison == 0 && *i < *answer)
+      // See the comment of the other overload of "find_furthest".
+      answer = i;
+  }
+  return answer;
+}
+
+#endif // INPLACEQUICKHULLKERNELS_H
@@ -1,48 +1,128 @@
 
-// Flags that indicate which convex hull algorithms are tested and compared. A flag equal to 0 means that an algorithm
-// is not tested; otherwise, it is tested. At the same time, each number unequal to 0 is interpreted as an
-// "algorithm number" that uniquely identifies the algorithm and can be used in other contexts.
-#define CONVEX_HULL_QUICK_HULL              1     //  1 if tested, 0 if not tested
-#define CONVEX_HULL_IN_PLACE_QUICK_HULL     2     //  2 if tested, 0 if not tested 
-#define CONVEX_HULL_IN_PLACE_QUICK_HULL_2   3     //  3 if tested, 0 if not tested 
-#define MAX_NUMBER_OF_CH_ALGORITHMS         3
-
-
-// Depending on the flags above, the corresponding include files are loaded.
-#if CONVEX_HULL_QUICK_HULL
-#include "ConvexHullQuickHull.h"
-#endif
-#if CONVEX_HULL_IN_PLACE_QUICK_HULL
-#include "ConvexHullQuickHull.h"
-#endif
-#if CONVEX_HULL_IN_PLACE_QUICK_HULL_2
-#include "ConvexHullQuickHull.h"
-#endif
+// The tested convex hull algorithms, numbers of points, point distributions, and further settings are selected on the
+// command line (see "BenchmarkConfiguration.h"); the algorithms are listed in the registry (see
+// "ConvexHullRegistry.h"). Run the program with the option "--help" to print the options.
 
 #define CHT 1
 
+// Orientation policy of the tested convex hull algorithms: "FastOrientationPolicy" for plain floating-point
+// orientation tests, "AdaptiveOrientationPolicy" for exact orientation tests with a floating-point filter, or
+// "FixedPointOrientationPolicy<std::int32_t>" and "FixedPointOrientationPolicy<std::int64_t>" for exact orientation
+// tests of fixed-point points (see "OrientationPredicates.h"). The generated points are converted into fixed-point
+// points outside of the time measurements. Note that 32-bit fixed-point points only cover the coordinates of up to
+// about 1000000 uniformly distributed points.
+#define ORIENTATION_POLICY FastOrientationPolicy
+
 #if CHT
 #include <iostream>
 #include <ostream>
 #include <fstream>
 #include <iomanip>
 #endif
+#include <algorithm>
+#include <cmath>
 #include <string>
 #include <vector>
+#include "BenchmarkCheckpoint.h"
+#include "BenchmarkConfiguration.h"
+#include "BenchmarkResults.h"
+#include "CacheControl.h"
+#include "ComplexityAnalysis.h"
+#include "ConvexHullQuickHull.h"
+#include "ConvexHullRegistry.h"
+#include "FixedPoint.h"
+#include "HullStatistics.h"
+#include "HullVerification.h"
+#include "MemoryAccounting.h"
+#include "ParallelExecution.h"
+#include "PerformanceCounters.h"
+#include "PointBuffer.h"
+#include "PointGenerationPipeline.h"
 #include "PointHandler.h"
+#include "PointIO.h"
 #include "TimeMeasurement.h"
+#include "TraceRecorder.h"
 
 //***************************************
 // Constants and constant data structures
 //***************************************
 
-// Constant for the number of times each convex hull algorithm is executed in order to average the execution times.
-const size_t NUMBER_OF_RUNS = 20; // 20 runs intended
+// Name of the orientation policy for the results (see "BenchmarkResults.h").
+#define CONVERT_TO_STRING(name) #name
+#define ORIENTATION_POLICY_NAME(policy) CONVERT_TO_STRING(policy)
+
+// Types of the point sequences and of the convex hull algorithms that are processed with the orientation policy.
+using TestedPointSequence = PointSequenceOf<ORIENTATION_POLICY>;
+using TestedAlgorithm = ConvexHullAlgorithm<ORIENTATION_POLICY>;
+
+//**************************************
+// Providing the tested point sequences
+//**************************************
+const PointSequence* getTestedPointSequence(const PointSequence& pointSeq, PointSequence& convertedPointSeq);
+template <typename Integer>
+const std::vector<BasicFixedPoint<Integer>>* getTestedPointSequence(
+  const PointSequence& pointSeq, std::vector<BasicFixedPoint<Integer>>& convertedPointSeq);
+
+//**************************
+// Point generation pipeline
+//**************************
+bool predictNextPointGeneration(const BenchmarkConfiguration& configuration, const std::vector<size_t>& threadCounts,
+                                size_t d, size_t t, size_t i, size_t j, PointGenerationRequest& request);
+
+//***********
+// Checkpoint
+//***********
+void addCheckpointedRuns(const BenchmarkCheckpoint& checkpoint, AlgorithmRuntimeManager& runtimeManager,
+                         const std::string& pointSource, size_t numberOfThreads);
+size_t findFirstRunAfterCheckpoint(const BenchmarkCheckpoint& checkpoint, AlgorithmRuntimeManager& runtimeManager,
+                                   const std::vector<const TestedAlgorithm*>& testedAlgorithms,
+                                   const std::string& pointSource, size_t numberOfThreads, size_t numberOfPoints,
+                                   std::vector<size_t>& checkpointedAlgorithmNumbers);
+
+//*******************
+// Adaptive sampling
+//*******************
+bool anyAlgorithmNeedsMoreRuns(AlgorithmRuntimeManager& runtimeManager,
+                               const std::vector<const TestedAlgorithm*>& testedAlgorithms, size_t numberOfPoints);
+
+//*********************
+// Performance counters
+//*********************
+void addPerformanceCounterValues(AlgorithmRuntimeManager& runtimeManager, size_t algorithmNumber,
+                                 size_t numberOfPoints, const PerformanceCounterValues& counterValues);
+
+//*************
+// Memory usage
+//*************
+void addMemoryUsage(AlgorithmRuntimeManager& runtimeManager, size_t algorithmNumber, size_t numberOfPoints,
+                    const MemoryUsage& memoryUsage);
+
+//****************
+// Hull statistics
+//****************
+void addHullStatistics(AlgorithmRuntimeManager& runtimeManager, size_t algorithmNumber, size_t numberOfPoints,
+                       size_t numberOfHullPoints, const HullStatistics& hullStatistics);
+
+//********************
+// Complexity analysis
+//********************
+std::string analyzeComplexity(AlgorithmRuntimeManager& runtimeManager,
+                              const std::vector<const TestedAlgorithm*>& testedAlgorithms,
+                              const std::vector<size_t>& numbersOfPoints);
 
-// Vector that keeps the numbers of points that will be consecutively generated and for which the performance of the
-// convex hull algorithms will be tested. Note that it is assumed that the numbers are listed in increasing order in
-// the vector.
-const std::vector<size_t> numberOfPointsList {10000, 100000, 1000000, 10000000 , 100000000};
+//***************
+// Thread scaling
+//***************
+void addScalingMetrics(std::vector<AlgorithmRuntimeManager>& runtimeManagers,
+                       const std::vector<const TestedAlgorithm*>& testedAlgorithms,
+                       const std::vector<size_t>& threadCounts,
+                       const std::vector<std::vector<size_t>>& numbersOfPointsOfThreadCounts, ScalingMode scalingMode);
+std::string writeThreadCounts(const std::vector<size_t>& threadCounts);
+
+//****************
+// Writing results
+//****************
+std::string getOutputFileName(const std::string& fileName, const std::string& suffix);
 
 //************************************
 // Printing in place quickhull result
@@ -56,122 +136,627 @@ void storeGeneratedPointsToFiles(const PointSequence& pointSeq);
 // Main program
 //*************
 
-int main()
+int main(int argc, char* argv[])
 {
-  PointSequence copiedPointSeq;
-  std::string fileName, header;
-  std::vector<std::string> ConvexHullAlgorithmNames(MAX_NUMBER_OF_CH_ALGORITHMS + 1, "");
-  AlgorithmRuntimeManager runtimeManager(MAX_NUMBER_OF_CH_ALGORITHMS, numberOfPointsList);
-  BaseTimeUnit timeUnit;
-  CCWPointSequence ccwPointSeq;
+  const std::vector<TestedAlgorithm>& algorithms = getConvexHullAlgorithms<ORIENTATION_POLICY>();
+  std::vector<std::string> algorithmNames, ConvexHullAlgorithmNames(algorithms.size() + 1, ""),
+                           algorithmNamesByNumber(algorithms.size() + 1, "");
+  std::vector<const TestedAlgorithm*> testedAlgorithms;
+  BenchmarkConfiguration configuration;
+
+  // Read the configuration from the command line.
+  for (const TestedAlgorithm& algorithm : algorithms)
+  {
+    algorithmNames.push_back(algorithm.name);
+    ConvexHullAlgorithmNames[algorithm.algorithmNumber] = algorithm.description;
+    algorithmNamesByNumber[algorithm.algorithmNumber] = algorithm.name;
+  }
+  if (!parseBenchmarkConfiguration(argc, argv, algorithmNames, configuration))
+  {
+    printBenchmarkUsage(std::cout, argv[0], algorithmNames);
+    return 1;
+  }
+  if (configuration.helpIsRequested)
+  {
+    printBenchmarkUsage(std::cout, argv[0], algorithmNames);
+    return 0;
+  }
+  for (const std::string& name : configuration.algorithmNames)
+    testedAlgorithms.push_back(findConvexHullAlgorithm<ORIENTATION_POLICY>(name));
+  // In the scaling mode, the algorithms are measured once for each number of threads; otherwise, they are measured
+  // once with the configured number of threads.
+  bool scalingIsMeasured = (configuration.scalingMode != ScalingMode::NONE);
+  std::vector<size_t> threadCounts = scalingIsMeasured ? configuration.threadCounts
+                                                       : std::vector<size_t>{configuration.numberOfThreads};
+  if (scalingIsMeasured && !setThreadPinning(true))
+  {
+    #if CHT
+    std::cout << "Threads cannot be pinned on this system and are not pinned." << std::endl;
+    #endif
+  }
+
+  // The point buffers, i.e., the copies of the points on which the algorithms run, are allocated according to the
+  // parameters from now on.
+  setPointBufferParameters(configuration.pointBufferParameters);
+
+  // The points are either read from the input file once or generated for each run.
+  bool pointsAreGenerated = configuration.inputFileName.empty();
+  PointSequence pointSeq;
+  if (!pointsAreGenerated)
+  {
+    if (!readPointSequenceFromCSVFile(configuration.inputFileName, pointSeq))
+      return 1;
+    configuration.numbersOfPoints.assign(1, pointSeq.size());
+  }
+  else
+  {
+    // With weak scaling, the numbers of points are per thread.
+    size_t maximalNumberOfPoints = configuration.numbersOfPoints.back() *
+                                   ((configuration.scalingMode == ScalingMode::WEAK) ? threadCounts.back() : 1);
+    #if CHT
+    std::cout << "Allocating a point sequence for maximally " << maximalNumberOfPoints << " points begins ..."
+              << std::endl;
+    #endif
+    pointSeq.resize(maximalNumberOfPoints); // Maximally needed size
+    #if CHT
+    std::cout << "... and is completed now." << std::endl;
+    #endif
+  }
+  size_t numberOfPointSources = pointsAreGenerated ? configuration.distributions.size() : 1;
+
+  // The points of the next run are generated in a background thread between the measurements if it is enabled and a
+  // processor is left over by the measured threads. All threads are pinned then, so that the background thread stays
+  // off the processors of the measured threads.
+  size_t maximalNumberOfMeasuredThreads = resolveNumberOfThreads(threadCounts.back());
+  bool generationIsPipelined = pointsAreGenerated && configuration.generationIsPipelined &&
+                               getNumberOfAvailableProcessors() > maximalNumberOfMeasuredThreads &&
+                               setThreadPinning(true);
   #if CHT
-  std::cout << "Allocating a point sequence for maximally " << numberOfPointsList[numberOfPointsList.size()-1]
-            << " points begins ..." << std::endl;
+  if (pointsAreGenerated && configuration.generationIsPipelined && !generationIsPipelined)
+    std::cout << "No processor is left over by the measured threads; the points are generated before each run."
+              << std::endl;
   #endif
-  PointSequence pointSeq(numberOfPointsList[numberOfPointsList.size() - 1]); // Maximally needed size
+  PointGenerationPipeline pointGenerationPipeline(generationIsPipelined, pointSeq.size(), configuration.distributions,
+                                                  maximalNumberOfMeasuredThreads);
+  PointGenerationRequest nextPointGeneration;
+
+  // The environment is recorded with the results, so that results of different machines or builds can be told apart.
+  BenchmarkEnvironment environment = getBenchmarkEnvironment();
+  environment.orientationPolicy = ORIENTATION_POLICY_NAME(ORIENTATION_POLICY);
+
+  // Each measured run is appended to the checkpoint file, so that a killed test can be resumed.
+  BenchmarkCheckpoint checkpoint;
+  if (!openBenchmarkCheckpoint(configuration, environment, checkpoint))
+    return 1;
   #if CHT
-  std::cout << "... and is completed now." << std::endl;
+  if (configuration.checkpointIsResumed)
+    std::cout << "The performance test is resumed after " << checkpoint.getRecords().size() << " checkpointed runs."
+              << std::endl;
   #endif
-  Timer timer;
+
+  // Only the copy of the points on which the algorithms run is a point buffer, which is allocated according to the
+  // parameters of the point buffers outside of the time measurement (see "restorePointSequence").
+  TestedPointSequence convertedPointSeq;
+  const TestedPointSequence* testedPointSeq;
+  TestedAlgorithm::PointSequenceType copiedPointSeq;
+  TestedAlgorithm::ConvexHullType convexHull;
+  Timer timer(configuration.clockSource);
   TimeDuration duration;
-  std::vector<Point>::iterator it;
+  size_t numberOfHullPoints;
+  MemoryAccounting memoryAccounting;
+  PerformanceCounters performanceCounters;
+  bool performanceCountersAreCollected = configuration.performanceCountersAreCollected &&
+                                         performanceCounters.isAvailable();
+  #if CHT
+  if (configuration.performanceCountersAreCollected && !performanceCountersAreCollected)
+    std::cout << "Performance counters are not available and are not collected." << std::endl;
+  #endif
 
-  for(size_t i = 0; i < numberOfPointsList.size(); i++)
+  for (size_t d = 0; d < numberOfPointSources; d++)
   {
-    for(size_t j = 0; j < NUMBER_OF_RUNS; j++)
+    std::string pointSource = pointsAreGenerated ? convertToString(configuration.distributions[d])
+                                                 : configuration.inputFileName;
+    // Each number of threads has its own runtime manager. The first one keeps the results that are written into the
+    // CSV file, including the scaling metrics.
+    std::vector<AlgorithmRuntimeManager> runtimeManagers;
+    std::vector<std::vector<size_t>> numbersOfPointsOfThreadCounts;
+    if (!configuration.traceFileName.empty())
+      TraceRecorder::initialize(configuration.traceParameters);
+
+    for (size_t t = 0; t < threadCounts.size(); t++)
     {
+      std::vector<size_t> numbersOfPoints(configuration.numbersOfPoints);
+      if (configuration.scalingMode == ScalingMode::WEAK)
+        for (size_t& numberOfPoints : numbersOfPoints)
+          numberOfPoints *= threadCounts[t];
+      numbersOfPointsOfThreadCounts.push_back(numbersOfPoints);
+      runtimeManagers.emplace_back(algorithms.size(), numbersOfPoints, configuration.samplingParameters);
+      AlgorithmRuntimeManager& runtimeManager = runtimeManagers.back();
+      addCheckpointedRuns(checkpoint, runtimeManager, pointSource, threadCounts[t]);
+      setDefaultNumberOfThreads(threadCounts[t]);
       #if CHT
-      std::cout << "Point sequence size: " << numberOfPointsList[i] << ", run number: " << j << std::endl;
-      std::cout << "Generating random point sequence without duplicates ..." << std::endl;
+      if (scalingIsMeasured)
+        std::cout << "Number of threads: " << threadCounts[t] << std::endl;
       #endif
 
-      // Create a sequence with randomly generated points.
-      generateRandomPoints(pointSeq, numberOfPointsList[i]);
+      for(size_t i = 0; i < numbersOfPoints.size(); i++)
+      {
+        size_t numberOfPoints = numbersOfPoints[i];
+        // A resumed test continues with the run number of the checkpointed runs, so that no seed is used twice for an
+        // algorithm. The algorithms that completed the first run before the test was killed skip it.
+        std::vector<size_t> checkpointedAlgorithmNumbers;
+        size_t firstRunNumber = findFirstRunAfterCheckpoint(checkpoint, runtimeManager, testedAlgorithms, pointSource,
+                                                            threadCounts[t], numberOfPoints,
+                                                            checkpointedAlgorithmNumbers);
+        // The algorithms whose first measured run in this process (which follows the checkpointed runs of a resumed
+        // test) is traced.
+        std::vector<size_t> tracedAlgorithmNumbers;
 
-      // Create a sequence with randomly generated points. Points are placed in a shape of a Circle. 
-      /* generateCircledPointSequence(pointSeq, numberOfPointsList[i]); */
+        for(size_t j = firstRunNumber; anyAlgorithmNeedsMoreRuns(runtimeManager, testedAlgorithms, numberOfPoints);
+            j++)
+        {
+          #if CHT
+          std::cout << "Point sequence size: " << numberOfPoints << ", run number: " << j << std::endl;
+          #endif
 
-      #if CHT
-      std::cout << "... completed with " << pointSeq.size() << " points." << std::endl;
-      printPointSequence("The input point sequence has", "points. Its points are:", pointSeq);
-      std::cout << std::endl;
-      #endif
+          if (pointsAreGenerated)
+          {
+            #if CHT
+            std::cout << "Generating random point sequence (" << pointSource << ") ..." << std::endl;
+            #endif
+            // Create a sequence with randomly generated points. Each run has its own seed, so that a run can be
+            // reproduced with the seed printed at the end. The points of the next run are generated in the background
+            // meanwhile if the pipeline is enabled.
+            pointGenerationPipeline.generate({numberOfPoints, configuration.distributions[d], configuration.seed + j},
+                                             pointSeq);
+            if (predictNextPointGeneration(configuration, threadCounts, d, t, i, j, nextPointGeneration))
+              pointGenerationPipeline.prefetch(nextPointGeneration);
+            #if CHT
+            std::cout << "... completed with " << pointSeq.size() << " points." << std::endl;
+            printPointSequence("The input point sequence has", "points. Its points are:", pointSeq);
+            std::cout << std::endl;
+            #endif
+          }
 
-      #if CONVEX_HULL_QUICK_HULL
-      ConvexHullAlgorithmNames[CONVEX_HULL_QUICK_HULL].assign("Quickhull algorithm"); 
-      #if CHT
-      std::cout << "Quickhull algorithm begins ... " << std::endl;
-      #endif
-      copiedPointSeq.clear();
-      copiedPointSeq = pointSeq;
-      timer.setStartTime();
-      ccwPointSeq = ConvexHullQuickHull(copiedPointSeq);
-      timer.setStopTime();
-      duration = timer.getElapsedTime();
-      runtimeManager.addDuration(CONVEX_HULL_QUICK_HULL, numberOfPointsList[i], duration);
-      #if CHT
-      std::cout << "... and is completed now in " << duration.convertToString(BaseTimeUnit::MILLISECONDS)
-                << " milliseconds." << std::endl;
-      /* printPointSequence("The convex hull contains", "points. The counterclockwise point sequence is:",
-       *                    ccwPointSeq); */
-      #endif
-      #endif
+          // Provide the points in the representation of the orientation policy.
+          testedPointSeq = getTestedPointSequence(pointSeq, convertedPointSeq);
+          if (testedPointSeq == nullptr)
+            return 1;
 
-      #if CONVEX_HULL_IN_PLACE_QUICK_HULL
-      ConvexHullAlgorithmNames[CONVEX_HULL_IN_PLACE_QUICK_HULL].assign("In place Quickhull algorithm"); 
-      #if CHT
-      std::cout << "In place Quickhull algorithm begins ... " << std::endl;
-      #endif
-      copiedPointSeq.clear();
-      copiedPointSeq = pointSeq;
-      timer.setStartTime();
-      it = ConvexHullInPlaceQuickHull(copiedPointSeq);
-      timer.setStopTime();
-      duration = timer.getElapsedTime();
-      runtimeManager.addDuration(CONVEX_HULL_IN_PLACE_QUICK_HULL, numberOfPointsList[i], duration);
-      #if CHT
-      std::cout << "... and is completed now in " << duration.convertToString(BaseTimeUnit::MILLISECONDS)
-                << " milliseconds." << std::endl;
-      /* printInplaceQuickhull(it, copiedPointSeq); */
-      /* printPointSequence("The convex hull contains", "points. The counterclockwise point sequence is:",
-       *                    ccwPointSeq); */
-      #endif
-      #endif
+          for (const TestedAlgorithm* algorithm : testedAlgorithms)
+          {
+            if (!runtimeManager.needsMoreRuns(algorithm->algorithmNumber, numberOfPoints) ||
+                (j == firstRunNumber && std::find(checkpointedAlgorithmNumbers.begin(),
+                                                  checkpointedAlgorithmNumbers.end(),
+                                                  algorithm->algorithmNumber) != checkpointedAlgorithmNumbers.end()))
+              continue;
 
-      #if CONVEX_HULL_IN_PLACE_QUICK_HULL_2
-      ConvexHullAlgorithmNames[CONVEX_HULL_IN_PLACE_QUICK_HULL_2].assign("In place Quickhull-2 algorithm"); 
-      #if CHT
-      std::cout << "In place Quickhull-2 algorithm begins ... " << std::endl;
-      #endif
-      copiedPointSeq.clear();
-      copiedPointSeq = pointSeq;
-      timer.setStartTime();
-      it = TheirConvexHullInPlaceQuickHull(copiedPointSeq);
-      timer.setStopTime();
-      duration = timer.getElapsedTime();
-      runtimeManager.addDuration(CONVEX_HULL_IN_PLACE_QUICK_HULL_2, numberOfPointsList[i], duration);
+            #if CHT
+            std::cout << algorithm->description << " begins ... " << std::endl;
+            #endif
+            // The in place algorithms reorder the points, so each run gets a fresh copy. The caches are put into
+            // the state of the cache mode afterwards, since the copy itself leaves an arbitrary part of the points in
+            // the caches.
+            restorePointSequence(*testedPointSeq, copiedPointSeq);
+            // The generation of the points of the next run in the background is paused from the preparation of the
+            // caches until the run is measured.
+            pointGenerationPipeline.pause();
+            prepareCaches(configuration.cacheMode, copiedPointSeq);
+            // The memory accounting and the performance counters are started and stopped outside of the time
+            // measurement. The copied points are not part of the measured memory usage.
+            #if HULL_STATISTICS
+            HullStatisticsRecorder::reset();
+            #endif
+            // Only the first measured run of each algorithm and number of points that is executed is traced.
+            bool runIsTraced = !configuration.traceFileName.empty() &&
+                               !runtimeManager.nextRunIsWarmupRun(algorithm->algorithmNumber, numberOfPoints) &&
+                               std::find(tracedAlgorithmNumbers.begin(), tracedAlgorithmNumbers.end(),
+                                         algorithm->algorithmNumber) == tracedAlgorithmNumbers.end();
+            if (runIsTraced)
+              tracedAlgorithmNumbers.push_back(algorithm->algorithmNumber);
+            TraceRecorder::setEnabled(runIsTraced);
+            memoryAccounting.start();
+            if (performanceCountersAreCollected)
+              performanceCounters.start();
+            {
+              TRACE_SPAN(algorithm->name.c_str());
+              timer.setStartTime();
+              numberOfHullPoints = algorithm->computeConvexHull(copiedPointSeq, convexHull);
+              timer.setStopTime();
+            }
+            if (performanceCountersAreCollected)
+              performanceCounters.stop();
+            memoryAccounting.stop();
+            pointGenerationPipeline.resume();
+            TraceRecorder::setEnabled(false);
+            duration = timer.getElapsedTime();
+            runtimeManager.addDuration(algorithm->algorithmNumber, numberOfPoints, duration);
+            runtimeManager.addMetric(algorithm->algorithmNumber, numberOfPoints, "hull points",
+                                     double(numberOfHullPoints));
+            addMemoryUsage(runtimeManager, algorithm->algorithmNumber, numberOfPoints, memoryAccounting.getUsage());
+            #if HULL_STATISTICS
+            addHullStatistics(runtimeManager, algorithm->algorithmNumber, numberOfPoints, numberOfHullPoints,
+                              HullStatisticsRecorder::collect());
+            #endif
+            if (performanceCountersAreCollected)
+              addPerformanceCounterValues(runtimeManager, algorithm->algorithmNumber, numberOfPoints,
+                                          performanceCounters.getValues());
+            // The convex hull is verified against the unchanged input points outside of the time measurement; a
+            // wrong hull ends the performance test, since its runtimes are meaningless.
+            if (configuration.hullsAreVerified)
+            {
+              HullVerification verification =
+                verifyConvexHull(*testedPointSeq, algorithm->isInPlace ? copiedPointSeq.data() : convexHull.data(),
+                                 numberOfHullPoints);
+              if (!verification.isValid)
+              {
+                #if CHT
+                std::cout << "ERROR: " << algorithm->description << " computed a wrong convex hull for "
+                          << numberOfPoints << " points (run number " << j << "): " << verification.violation
+                          << std::endl;
+                #endif
+                return 1;
+              }
+            }
+            if (checkpoint.isActive() &&
+                !checkpoint.addRecord({pointSource, threadCounts[t], numberOfPoints, j, algorithm->algorithmNumber,
+                                       std::int64_t(duration.getNanoseconds().count()),
+                                       runtimeManager.getMetricsOfLastRun(algorithm->algorithmNumber,
+                                                                          numberOfPoints)}))
+              return 1;
+            #if CHT
+            std::cout << "... and is completed now in " << duration.convertToString(BaseTimeUnit::MILLISECONDS)
+                      << " milliseconds." << std::endl;
+            /* printPointSequence("The convex hull contains", "points. The counterclockwise point sequence is:",
+             *                    convexHull); */
+            #endif
+          }
+          /* storeGeneratedPointsToFiles(pointSeq); */
+        }
+        #if CHT
+        for (const TestedAlgorithm* algorithm : testedAlgorithms)
+          std::cout << algorithm->description << ": sampling for " << numberOfPoints << " points stopped ("
+                    << convertToString(runtimeManager.getStoppingReason(algorithm->algorithmNumber, numberOfPoints))
+                    << ")." << std::endl;
+        #endif
+      }
+    }
+    AlgorithmRuntimeManager& runtimeManager = runtimeManagers.front();
+    if (scalingIsMeasured)
+      addScalingMetrics(runtimeManagers, testedAlgorithms, threadCounts, numbersOfPointsOfThreadCounts,
+                        configuration.scalingMode);
+
+    // Write the collected runtime information into a CSV file. With several point distributions, each distribution
+    // gets its own file.
+    std::string header("Performance Test of Selected Convex Hull Algorithms\n"
+                       "(Runtimes are provided in milliseconds)\n"
+                       "Points: " + pointSource);
+    if (pointsAreGenerated)
+      header += ", seed: " + std::to_string(configuration.seed);
+    if (scalingIsMeasured)
+      header += ", threads: " + writeThreadCounts(threadCounts) + " (" + convertToString(configuration.scalingMode) +
+                " scaling; the runtimes are those of " + std::to_string(threadCounts.front()) + " thread(s))";
+    else
+      header += ", threads: " + std::to_string(resolveNumberOfThreads(configuration.numberOfThreads));
+    header += ", cache: " + convertToString(configuration.cacheMode) + ", huge pages: " +
+              convertToString(configuration.pointBufferParameters.hugePageMode) + ", page placement: " +
+              convertToString(configuration.pointBufferParameters.pagePlacement) + "\n";
+    runtimeManager.writeToCSVFile((numberOfPointSources > 1) ? getOutputFileName(configuration.outputFileName,
+                                                                                 pointSource)
+                                                             : configuration.outputFileName,
+                                  header, BaseTimeUnit::MILLISECONDS, ConvexHullAlgorithmNames,
+                                  analyzeComplexity(runtimeManager, testedAlgorithms,
+                                                    numbersOfPointsOfThreadCounts.front()));
+    // The results of all point sources and numbers of threads are written into one JSON lines file; the number of
+    // threads is part of the environment.
+    for (size_t t = 0; t < threadCounts.size() && !configuration.resultsFileName.empty(); t++)
+    {
+      environment.numberOfThreads = resolveNumberOfThreads(threadCounts[t]);
+      std::string commonMembers = "\"environment\":" + convertToJSONObject(environment) + ",\"pointSource\":" +
+                                  convertToJSONString(pointSource) + ",\"cache\":" +
+                                  convertToJSONString(convertToString(configuration.cacheMode));
+      commonMembers += ",\"hugePages\":" +
+                       convertToJSONString(convertToString(configuration.pointBufferParameters.hugePageMode)) +
+                       ",\"pagePlacement\":" +
+                       convertToJSONString(convertToString(configuration.pointBufferParameters.pagePlacement));
+      if (pointsAreGenerated)
+        commonMembers += ",\"seed\":" + std::to_string(configuration.seed);
+      if (scalingIsMeasured)
+        commonMembers += ",\"scaling\":" + convertToJSONString(convertToString(configuration.scalingMode));
+      runtimeManagers[t].writeToJSONLinesFile(configuration.resultsFileName, commonMembers, algorithmNamesByNumber,
+                                              d > 0 || t > 0);
+    }
+    if (!configuration.traceFileName.empty())
+    {
       #if CHT
-      std::cout << "... and is completed now in " << duration.convertToString(BaseTimeUnit::MILLISECONDS)
-                << " milliseconds." << std::endl;
-      /* printInplaceQuickhull(it, copiedPointSeq); */
-      /* printPointSequence("The convex hull contains", "points. The counterclockwise point sequence is:",
-       *                    ccwPointSeq); */
+      if (TraceRecorder::getNumberOfOverwrittenSpans() > 0)
+        std::cout << TraceRecorder::getNumberOfOverwrittenSpans() << " spans were overwritten; increase the minimal "
+                  << "span size to keep all spans." << std::endl;
       #endif
-      #endif
-      /* storeGeneratedPointsToFiles(pointSeq); */
-
+      TraceRecorder::writeToJSONFile((numberOfPointSources > 1) ? getOutputFileName(configuration.traceFileName,
+                                                                                    pointSource)
+                                                                : configuration.traceFileName);
     }
   }
+  setThreadPinning(false);
 
-  // Write the collected runtime information into a CSV file.
-  fileName.assign("ConvexHullAlgorithmsTest.csv");
-  header.assign("Performance Test of Selected Convex Hull Algorithms\n"
-                "(Runtimes are provided in milliseconds)\n");
-  timeUnit = BaseTimeUnit::MILLISECONDS;
-  runtimeManager.writeToCSVFile(fileName, header, timeUnit, ConvexHullAlgorithmNames);
-  
   return 0;
 }
+
+// Method that returns the generated point sequence "pointSeq" itself if the orientation policy processes points with
+// "Number" coordinates.
+const PointSequence* getTestedPointSequence(const PointSequence& pointSeq, PointSequence&)
+{
+  return &pointSeq;
+}
+
+// Method that converts the generated point sequence "pointSeq" into the fixed-point sequence "convertedPointSeq" and
+// returns it. If the conversion fails, the method returns nullptr.
+template <typename Integer>
+const std::vector<BasicFixedPoint<Integer>>* getTestedPointSequence(
+  const PointSequence& pointSeq, std::vector<BasicFixedPoint<Integer>>& convertedPointSeq)
+{
+  if (! convertToFixedPointSequence(pointSeq, convertedPointSeq))
+    return nullptr;
+
+  return &convertedPointSeq;
+}
+
+// Method that predicts the points that are generated after the run "j" of the number of points "i", the number of
+// threads "t", and the distribution "d" and stores their parameters in "request". The run is assumed to be followed by
+// another one for the same number of points unless the maximal number of runs is reached, since the adaptive sampling
+// may stop at any run. If the run is the last one of the performance test, the method returns "false".
+bool predictNextPointGeneration(const BenchmarkConfiguration& configuration, const std::vector<size_t>& threadCounts,
+                                size_t d, size_t t, size_t i, size_t j, PointGenerationRequest& request)
+{
+  const SamplingParameters& samplingParameters = configuration.samplingParameters;
+
+  if (j + 1 < samplingParameters.numberOfWarmupRuns + getMaximalNumberOfRuns(samplingParameters))
+    ++j;
+  else
+  {
+    j = 0;
+    if (++i == configuration.numbersOfPoints.size())
+    {
+      i = 0;
+      if (++t == threadCounts.size())
+      {
+        t = 0;
+        if (++d == configuration.distributions.size())
+          return false;
+      }
+    }
+  }
+  // With weak scaling, the numbers of points are per thread.
+  request.numberOfPoints = configuration.numbersOfPoints[i] *
+                           ((configuration.scalingMode == ScalingMode::WEAK) ? threadCounts[t] : 1);
+  request.distribution = configuration.distributions[d];
+  request.seed = configuration.seed + j;
+  return true;
+}
+
+// Method that adds the runs of the checkpoint file "checkpoint" with the point source "pointSource" and the number of
+// threads "numberOfThreads" to the runtime manager "runtimeManager" in the order in which they were measured. Before
+// each run, the manager is asked whether it needs the run, as it was before the run was measured, so that the state
+// of the adaptive sampling is the same as if the runs were measured now.
+void addCheckpointedRuns(const BenchmarkCheckpoint& checkpoint, AlgorithmRuntimeManager& runtimeManager,
+                         const std::string& pointSource, size_t numberOfThreads)
+{
+  for (const CheckpointRecord& record : checkpoint.getRecords())
+  {
+    if (record.pointSource != pointSource || record.numberOfThreads != numberOfThreads ||
+        !runtimeManager.needsMoreRuns(record.algorithmNumber, record.numberOfPoints))
+      continue;
+
+    runtimeManager.addDuration(record.algorithmNumber, record.numberOfPoints,
+                               TimeDuration(std::chrono::nanoseconds(record.durationInNanoseconds)));
+    for (const std::pair<std::string, double>& metric : record.metrics)
+      runtimeManager.addMetric(record.algorithmNumber, record.numberOfPoints, metric.first, metric.second);
+  }
+}
+
+// Method that returns the number of the first run of the tested algorithms "testedAlgorithms" for "numberOfPoints"
+// points after the runs of the checkpoint file "checkpoint" with the point source "pointSource" and the number of
+// threads "numberOfThreads", which were added to the runtime manager "runtimeManager". If the last checkpointed run
+// was not completed by all algorithms that need more runs, it is the first run, and the numbers of the algorithms that
+// completed it are stored in "checkpointedAlgorithmNumbers".
+size_t findFirstRunAfterCheckpoint(const BenchmarkCheckpoint& checkpoint, AlgorithmRuntimeManager& runtimeManager,
+                                   const std::vector<const TestedAlgorithm*>& testedAlgorithms,
+                                   const std::string& pointSource, size_t numberOfThreads, size_t numberOfPoints,
+                                   std::vector<size_t>& checkpointedAlgorithmNumbers)
+{
+  size_t lastRunNumber = 0;
+  bool runsAreCheckpointed = false;
+
+  checkpointedAlgorithmNumbers.clear();
+  for (const CheckpointRecord& record : checkpoint.getRecords())
+    if (record.pointSource == pointSource && record.numberOfThreads == numberOfThreads &&
+        record.numberOfPoints == numberOfPoints)
+    {
+      if (!runsAreCheckpointed || record.runNumber > lastRunNumber)
+        checkpointedAlgorithmNumbers.clear();
+      if (!runsAreCheckpointed || record.runNumber >= lastRunNumber)
+        checkpointedAlgorithmNumbers.push_back(record.algorithmNumber);
+      lastRunNumber = std::max(lastRunNumber, record.runNumber);
+      runsAreCheckpointed = true;
+    }
+  if (!runsAreCheckpointed)
+    return 0;
+
+  for (const TestedAlgorithm* algorithm : testedAlgorithms)
+    if (runtimeManager.needsMoreRuns(algorithm->algorithmNumber, numberOfPoints) &&
+        std::find(checkpointedAlgorithmNumbers.begin(), checkpointedAlgorithmNumbers.end(),
+                  algorithm->algorithmNumber) == checkpointedAlgorithmNumbers.end())
+      return lastRunNumber;
+
+  checkpointedAlgorithmNumbers.clear();
+  return lastRunNumber + 1;
+}
+
+// Method that checks whether any tested convex hull algorithm has to be run again for "numberOfPoints" points.
+bool anyAlgorithmNeedsMoreRuns(AlgorithmRuntimeManager& runtimeManager,
+                               const std::vector<const TestedAlgorithm*>& testedAlgorithms, size_t numberOfPoints)
+{
+  bool needsMoreRuns = false;
+
+  // Check all algorithms so that the stopping reasons of all algorithms are recorded.
+  for (const TestedAlgorithm* algorithm : testedAlgorithms)
+    needsMoreRuns |= runtimeManager.needsMoreRuns(algorithm->algorithmNumber, numberOfPoints);
+
+  return needsMoreRuns;
+}
+
+// Method that adds the available values of the performance counters "counterValues" of the last run of the algorithm
+// with the number "algorithmNumber" as metrics to the runtime manager "runtimeManager".
+void addPerformanceCounterValues(AlgorithmRuntimeManager& runtimeManager, size_t algorithmNumber,
+                                 size_t numberOfPoints, const PerformanceCounterValues& counterValues)
+{
+  for (size_t i = 0; i < NUMBER_OF_PERFORMANCE_COUNTERS; ++i)
+    if (counterValues.isAvailable[i])
+      runtimeManager.addMetric(algorithmNumber, numberOfPoints, convertToString(PerformanceCounter(i)),
+                               counterValues.values[i]);
+}
+
+// Method that adds the memory usage "memoryUsage" of the last run of the algorithm with the number "algorithmNumber"
+// as metrics to the runtime manager "runtimeManager".
+void addMemoryUsage(AlgorithmRuntimeManager& runtimeManager, size_t algorithmNumber, size_t numberOfPoints,
+                    const MemoryUsage& memoryUsage)
+{
+  runtimeManager.addMetric(algorithmNumber, numberOfPoints, "peak heap bytes", double(memoryUsage.peakHeapBytes));
+  runtimeManager.addMetric(algorithmNumber, numberOfPoints, "heap allocations",
+                           double(memoryUsage.numberOfAllocations));
+  runtimeManager.addMetric(algorithmNumber, numberOfPoints, "allocated heap bytes",
+                           double(memoryUsage.allocatedHeapBytes));
+  if (memoryUsage.peakResidentSetSize > 0)
+    runtimeManager.addMetric(algorithmNumber, numberOfPoints, "peak resident set size (KiB)",
+                             double(memoryUsage.peakResidentSetSize));
+}
+
+// Method that adds the hull statistics "hullStatistics" of the last run of the algorithm with the number
+// "algorithmNumber" as metrics to the runtime manager "runtimeManager". Besides the operation counts, the orientation
+// tests per n log2 h are added (n is "numberOfPoints" and h is "numberOfHullPoints"); they should stay about constant
+// if an algorithm behaves like O(n log h). The numbers of sub-problems are added for all size classes up to the size
+// class of n, so that all runs have the same metrics.
+void addHullStatistics(AlgorithmRuntimeManager& runtimeManager, size_t algorithmNumber, size_t numberOfPoints,
+                       size_t numberOfHullPoints, const HullStatistics& hullStatistics)
+{
+  for (size_t i = 0; i < NUMBER_OF_HULL_OPERATIONS; ++i)
+    runtimeManager.addMetric(algorithmNumber, numberOfPoints, convertToString(HullOperation(i)),
+                             double(hullStatistics.operationCounts[i]));
+  runtimeManager.addMetric(algorithmNumber, numberOfPoints, "maximal recursion depth",
+                           double(hullStatistics.maximalRecursionDepth));
+  if (numberOfHullPoints > 1)
+    runtimeManager.addMetric(algorithmNumber, numberOfPoints, "orientation tests per n log2 h",
+                             double(hullStatistics.operationCounts[size_t(HullOperation::ORIENTATION_TESTS)]) /
+                             (double(numberOfPoints) * std::log2(double(numberOfHullPoints))));
+
+  for (size_t k = 0; k <= HullStatistics::getSizeClass(numberOfPoints); ++k)
+  {
+    std::string sizeClass = (k <= 1) ? std::to_string(k) : std::to_string(size_t(1) << (k - 1)) + " to " +
+                                                           std::to_string((size_t(1) << (k - 1)) * 2 - 1);
+    runtimeManager.addMetric(algorithmNumber, numberOfPoints, "sub-problems of size " + sizeClass,
+                             double(hullStatistics.subproblemSizeCounts[k]));
+  }
+}
+
+// Method that fits the median runtimes of the tested algorithms against complexity models and finds their crossovers
+// (see "ComplexityAnalysis.h"). The median numbers of hull points of the runs are the hull sizes of the n log h model.
+// With fewer than two numbers of points, nothing can be fitted, and the method returns an empty report.
+std::string analyzeComplexity(AlgorithmRuntimeManager& runtimeManager,
+                              const std::vector<const TestedAlgorithm*>& testedAlgorithms,
+                              const std::vector<size_t>& numbersOfPoints)
+{
+  std::vector<std::string> algorithmNames;
+  std::vector<std::vector<ComplexitySample>> samplesOfAlgorithms;
+
+  if (numbersOfPoints.size() < 2)
+    return std::string();
+
+  for (const TestedAlgorithm* algorithm : testedAlgorithms)
+  {
+    algorithmNames.push_back(algorithm->description + " (Alg. " + std::to_string(algorithm->algorithmNumber) + ")");
+    samplesOfAlgorithms.emplace_back();
+    for (size_t numberOfPoints : numbersOfPoints)
+      if (runtimeManager.getNumberOfRuns(algorithm->algorithmNumber, numberOfPoints) > 0)
+        samplesOfAlgorithms.back().push_back(
+          {double(numberOfPoints),
+           runtimeManager.calculateMedianOfMetric(algorithm->algorithmNumber, numberOfPoints, "hull points"),
+           double(runtimeManager.calculateMedian(algorithm->algorithmNumber,
+                                                 numberOfPoints).getNanoseconds().count())});
+  }
+
+  return writeComplexityReport(algorithmNames, samplesOfAlgorithms);
+}
+
+// Method that adds the scaling metrics of the tested algorithms to the first runtime manager of "runtimeManagers",
+// which keep the runtimes of the numbers of threads "threadCounts" for the numbers of points
+// "numbersOfPointsOfThreadCounts". The metrics of the number of threads p are its median runtime and its speedup and
+// parallel efficiency relative to the first number of threads p0 (usually 1) with the median runtimes T(p) and T(p0):
+// - strong scaling (same number of points): speedup = T(p0) / T(p), efficiency = speedup * p0 / p;
+// - weak scaling (same number of points per thread): efficiency = T(p0) / T(p), speedup = efficiency * p / p0 (the
+//   scaled speedup).
+// The metrics are added to the first number of points of each row, so that they are written next to its runtimes.
+void addScalingMetrics(std::vector<AlgorithmRuntimeManager>& runtimeManagers,
+                       const std::vector<const TestedAlgorithm*>& testedAlgorithms,
+                       const std::vector<size_t>& threadCounts,
+                       const std::vector<std::vector<size_t>>& numbersOfPointsOfThreadCounts, ScalingMode scalingMode)
+{
+  AlgorithmRuntimeManager& baseline = runtimeManagers.front();
+
+  for (const TestedAlgorithm* algorithm : testedAlgorithms)
+    for (size_t i = 0; i < numbersOfPointsOfThreadCounts.front().size(); ++i)
+    {
+      size_t numberOfPoints = numbersOfPointsOfThreadCounts.front()[i];
+      if (baseline.getNumberOfRuns(algorithm->algorithmNumber, numberOfPoints) == 0)
+        continue;
+      double baselineRuntime = double(baseline.calculateMedian(algorithm->algorithmNumber,
+                                                               numberOfPoints).getNanoseconds().count());
+
+      for (size_t t = 0; t < threadCounts.size(); ++t)
+      {
+        size_t scaledNumberOfPoints = numbersOfPointsOfThreadCounts[t][i];
+        if (runtimeManagers[t].getNumberOfRuns(algorithm->algorithmNumber, scaledNumberOfPoints) == 0)
+          continue;
+        double runtime = double(runtimeManagers[t].calculateMedian(algorithm->algorithmNumber,
+                                                                   scaledNumberOfPoints).getNanoseconds().count());
+        double ratio = (runtime > 0) ? baselineRuntime / runtime : 0;
+        double threadRatio = double(threadCounts[t]) / double(threadCounts.front());
+        std::string suffix = " (" + std::to_string(threadCounts[t]) + " threads)";
+
+        baseline.addMetric(algorithm->algorithmNumber, numberOfPoints, "median runtime in ms" + suffix, runtime / 1e6);
+        baseline.addMetric(algorithm->algorithmNumber, numberOfPoints, "speedup" + suffix,
+                           (scalingMode == ScalingMode::STRONG) ? ratio : ratio * threadRatio);
+        baseline.addMetric(algorithm->algorithmNumber, numberOfPoints, "parallel efficiency" + suffix,
+                           (scalingMode == ScalingMode::STRONG) ? ratio / threadRatio : ratio);
+      }
+    }
+}
+
+// Method that writes the numbers of threads "threadCounts" as a list separated by slashes.
+std::string writeThreadCounts(const std::vector<size_t>& threadCounts)
+{
+  std::string list;
+
+  for (size_t numberOfThreads : threadCounts)
+    list += (list.empty() ? "" : "/") + std::to_string(numberOfThreads);
+
+  return list;
+}
+
+// Method that inserts "-suffix" into the file name "fileName" in front of its extension (e.g., ".csv" or ".json") if
+// it has one. A dot in a directory name or at the beginning of the file name does not start an extension.
+std::string getOutputFileName(const std::string& fileName, const std::string& suffix)
+{
+  size_t beginOfName = fileName.find_last_of('/');
+  beginOfName = (beginOfName == std::string::npos) ? 0 : beginOfName + 1;
+  size_t beginOfExtension = fileName.find_last_of('.');
+
+  if (beginOfExtension == std::string::npos || beginOfExtension <= beginOfName)
+    return fileName + "-" + suffix;
+
+  return fileName.substr(0, beginOfExtension) + "-" + suffix + fileName.substr(beginOfExtension);
+}
+
 void printInplaceQuickhull(PointSequence::iterator it, PointSequence& resultOfInplaceQuickhull)
 {
   for (auto i = resultOfInplaceQuickhull.begin(); i != it; ++i)
@@ -183,18 +768,5 @@ void printInplaceQuickhull(PointSequence::iterator it, PointSequence& resultOfIn
 // Store the generated points to plot the zone configuration.
 void storeGeneratedPointsToFiles(const PointSequence& pointSeq)
 {
-  std::string xPoints = "generatedXPoints.txt";
-  std::string yPoints = "generatedYPoints.txt";
-  std::ofstream pointsX(xPoints);
-  std::ofstream pointsY(yPoints);
-  pointsX << std::fixed << std::setprecision(2) << std::endl;
-  pointsY << std::fixed << std::setprecision(2) << std::endl;
-  for(size_t i = 0 ; i < pointSeq.size(); i++)
-  {
-    pointsX << pointSeq[i].x <<  std::endl;
-    pointsY << pointSeq[i].y <<  std::endl;
-  }
-  pointsX.close();
-  pointsY.close();
-
+  writePointSequenceToTwoFiles(pointSeq, "generatedXPoints.txt", "generatedYPoints.txt");
 }
@@ -0,0 +1,473 @@
+
+// The kernel microbenchmark times the hot kernels of the in place quickhulls (see "InplaceQuickHullKernels.h"), the
+// scan of the point sequence that all algorithms begin with, and the orientation tests of the point handler (see
+// "PointHandler.h") in isolation, so that a change of a kernel can be measured without the noise of the whole
+// algorithm:
+//   KernelMicrobenchmark [--kernels NAMES] [--points SIZES] [--min-time SECONDS] [--seed SEED] [--output FILE]
+// Each kernel runs on uniformly distributed points that are prepared like the in place quickhull prepares them: the
+// leftmost point is the first point, the rightmost point is the last point, and the points between them are
+// partitioned into the lower block followed by the upper block, each with its furthest point at its end. By default,
+// the numbers of points are chosen so that the points fill half of the L1 data cache, half of the L2 cache, half of
+// the last level cache, and four times the last level cache (DRAM). A kernel that reorders the points runs on a copy
+// that is restored before each repetition, outside of the time measurement; the repetitions go on until they took
+// the minimal time and there are at least five of them. The program prints the median time per point and the
+// bandwidth, i.e., the bytes of the points in the range of the kernel divided by the median time.
+
+// Orientation policy of the timed kernels (see "OrientationPredicates.h" and "InplaceQuickhullTest.cpp").
+#define ORIENTATION_POLICY FastOrientationPolicy
+
+#include <algorithm>
+#include <cstdint>
+#include <cstdlib>      // std::strtod, std::strtoull
+#include <fstream>
+#include <functional>
+#include <iomanip>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <vector>
+#include "CacheControl.h"
+#include "FixedPoint.h"
+#include "InplaceQuickHullKernels.h"
+#include "OrientationPredicates.h"
+#include "PointHandler.h"
+#include "TimeMeasurement.h"
+
+//***************************************
+// Constants and constant data structures
+//***************************************
+
+using TestedPointSequence = std::vector<ORIENTATION_POLICY::PointType>;
+using I = TestedPointSequence::iterator;
+
+// Minimal number of repetitions of a kernel for a number of points.
+constexpr size_t MINIMAL_NUMBER_OF_REPETITIONS = 5;
+
+// Type that keeps the points on which the kernels run.
+struct KernelInput
+{
+  // Generated points for the kernels of the point handler and their leftmost and rightmost point.
+  PointSequence points;
+  Point leftMostPoint;
+  Point rightMostPoint;
+  // Prepared points of the orientation policy (see above), the copy on which the kernels run, and the index of the
+  // first point of the upper block.
+  TestedPointSequence original;
+  TestedPointSequence work;
+  size_t middle = 0;
+  // Sum of the results of the kernels of the point handler, so that the compiler cannot drop them.
+  Number sink = 0;
+};
+
+// Type that keeps a kernel. The method "run" runs the kernel once on the points of the input and returns the number
+// of points in its range.
+struct Kernel
+{
+  std::string name;
+  // Flag that indicates whether the kernel reorders the points, so that they are restored before each repetition.
+  bool reordersPoints;
+  std::function<size_t(KernelInput&)> run;
+};
+
+//**************
+// Timed kernels
+//**************
+std::vector<Kernel> getKernels();
+
+//*****************
+// Preparing points
+//*****************
+const PointSequence* getTestedPointSequence(const PointSequence& pointSeq, PointSequence& convertedPointSeq);
+template <typename Integer>
+const std::vector<BasicFixedPoint<Integer>>* getTestedPointSequence(
+  const PointSequence& pointSeq, std::vector<BasicFixedPoint<Integer>>& convertedPointSeq);
+bool prepareKernelInput(size_t numberOfPoints, std::uint64_t seed, KernelInput& input);
+
+//***************
+// Timing kernels
+//***************
+TimeDuration timeKernel(const Kernel& kernel, KernelInput& input, double minimalTimeInSeconds,
+                        size_t& numberOfProcessedPoints, size_t& numberOfRepetitions);
+
+//*************
+// Command line
+//*************
+std::vector<size_t> getDefaultNumbersOfPoints();
+bool parseNumbersOfPoints(const std::string& list, std::vector<size_t>& numbersOfPoints);
+void printUsage(const std::string& programName, const std::vector<Kernel>& kernels);
+
+//*************
+// Main program
+//*************
+
+int main(int argc, char* argv[])
+{
+  const std::vector<Kernel> kernels = getKernels();
+  std::vector<const Kernel*> timedKernels;
+  std::vector<size_t> numbersOfPoints;
+  double minimalTimeInSeconds = 0.2;
+  std::uint64_t seed = 1;
+  std::string outputFileName;
+
+  for (int i = 1; i < argc; ++i)
+  {
+    std::string argument(argv[i]);
+    if (argument == "--help")
+    {
+      printUsage(argv[0], kernels);
+      return 0;
+    }
+    if (i + 1 == argc)
+    {
+      std::cout << "ERROR: Option '" << argument << "' is unknown or lacks a value!" << std::endl;
+      printUsage(argv[0], kernels);
+      return 1;
+    }
+    std::string value(argv[++i]);
+    char* end = nullptr;
+    bool valueIsValid = true;
+    if (argument == "--kernels")
+    {
+      std::istringstream names(value);
+      std::string name;
+      while (valueIsValid && std::getline(names, name, ','))
+      {
+        auto kernel = std::find_if(kernels.begin(), kernels.end(), [&](const Kernel& k) { return k.name == name; });
+        valueIsValid = (kernel != kernels.end());
+        if (valueIsValid)
+          timedKernels.push_back(&*kernel);
+      }
+    }
+    else if (argument == "--points")
+      valueIsValid = parseNumbersOfPoints(value, numbersOfPoints);
+    else if (argument == "--min-time")
+    {
+      minimalTimeInSeconds = std::strtod(value.c_str(), &end);
+      valueIsValid = (*end == '\0' && minimalTimeInSeconds >= 0 && minimalTimeInSeconds < 1e6);
+    }
+    else if (argument == "--seed")
+    {
+      seed = std::strtoull(value.c_str(), &end, 10);
+      valueIsValid = (! value.empty() && *end == '\0');
+    }
+    else if (argument == "--output")
+      outputFileName = value;
+    else
+      valueIsValid = false;
+    if (! valueIsValid)
+    {
+      std::cout << "ERROR: Option '" << argument << "' is unknown or has an invalid value!" << std::endl;
+      printUsage(argv[0], kernels);
+      return 1;
+    }
+  }
+  if (timedKernels.empty())
+    for (const Kernel& kernel : kernels)
+      timedKernels.push_back(&kernel);
+  if (numbersOfPoints.empty())
+    numbersOfPoints = getDefaultNumbersOfPoints();
+
+  std::ostringstream csv;
+  csv << "Kernel,Number of points,Size (KiB),Repetitions,Median (ns),ns/point,GB/s\n";
+  std::cout << std::left << std::setw(28) << "Kernel" << std::right << std::setw(12) << "Points" << std::setw(12)
+            << "Size (KiB)" << std::setw(9) << "Reps" << std::setw(11) << "ns/point" << std::setw(10) << "GB/s"
+            << std::endl;
+  std::cout << std::fixed;
+
+  for (size_t numberOfPoints : numbersOfPoints)
+  {
+    KernelInput input;
+    if (! prepareKernelInput(numberOfPoints, seed, input))
+      return 1;
+    size_t sizeInKiB = numberOfPoints * sizeof(TestedPointSequence::value_type) / 1024;
+
+    for (const Kernel* kernel : timedKernels)
+    {
+      size_t numberOfProcessedPoints = 0, numberOfRepetitions = 0;
+      TimeDuration median = timeKernel(*kernel, input, minimalTimeInSeconds, numberOfProcessedPoints,
+                                       numberOfRepetitions);
+      double nanoseconds = double(median.getNanoseconds().count());
+      double nanosecondsPerPoint = nanoseconds / double(std::max<size_t>(numberOfProcessedPoints, 1));
+      double gigabytesPerSecond = (nanoseconds > 0) ? double(numberOfProcessedPoints) *
+                                  double(sizeof(TestedPointSequence::value_type)) / nanoseconds : 0;
+
+      std::cout << std::left << std::setw(28) << kernel->name << std::right << std::setw(12) << numberOfPoints
+                << std::setw(12) << sizeInKiB << std::setw(9) << numberOfRepetitions << std::setprecision(3)
+                << std::setw(11) << nanosecondsPerPoint << std::setprecision(2) << std::setw(10)
+                << gigabytesPerSecond << std::endl;
+      csv << kernel->name << "," << numberOfPoints << "," << sizeInKiB << "," << numberOfRepetitions << ","
+          << nanoseconds << "," << nanosecondsPerPoint << "," << gigabytesPerSecond << "\n";
+    }
+  }
+
+  if (! outputFileName.empty())
+  {
+    std::ofstream outputFile(outputFileName);
+    if (! (outputFile << csv.str()))
+    {
+      std::cout << "ERROR: The file '" << outputFileName << "' cannot be written!" << std::endl;
+      return 1;
+    }
+  }
+
+  return 0;
+}
+
+//**************
+// Timed kernels
+//**************
+
+// Method that returns the timed kernels. The kernels of the orientation policy run on the prepared points: "lower"
+// is the block [1, middle) and "upper" the block [middle, n - 1), where n is the number of points.
+std::vector<Kernel> getKernels()
+{
+  using Policy = ORIENTATION_POLICY;
+
+  return {
+    {"getOrientation", false, [](KernelInput& input)
+      {
+        int sum = 0;
+        for (const Point& point : input.points)
+          sum += int(getOrientation(input.leftMostPoint, point, input.rightMostPoint));
+        input.sink += Number(sum);
+        return input.points.size();
+      }},
+    {"getOrientationWithArea", false, [](KernelInput& input)
+      {
+        Number area, sum = 0;
+        for (const Point& point : input.points)
+        {
+          getOrientationWithArea(input.leftMostPoint, point, input.rightMostPoint, area);
+          sum += area;
+        }
+        input.sink += sum;
+        return input.points.size();
+      }},
+    {"squaredDistanceToSegment", false, [](KernelInput& input)
+      {
+        Number sum = 0;
+        for (const Point& point : input.points)
+          sum += computeSquaredDistanceFromPointToSegment(point, input.leftMostPoint, input.rightMostPoint);
+        input.sink += sum;
+        return input.points.size();
+      }},
+    // The scan that finds the poles and checks the minimal requirements for all algorithms runs with one thread here
+    // like the other kernels; the algorithms split it over all threads.
+    {"scanPointSequence", false, [](KernelInput& input)
+      {
+        BasicPointSequenceScan<Policy::PointType> scan = scanPointSequence(input.work, 1);
+        input.sink += Number(scan.leftMostIndex + scan.rightMostIndex + size_t(scan.fulfillsMinimalRequirements));
+        return input.work.size();
+      }},
+    {"find_furthest (ours)", false, [](KernelInput& input)
+      {
+        I first = input.work.begin(), last = std::prev(input.work.end());
+        input.sink += Number(std::distance(first, find_furthest<Policy>(std::next(first), last, first, last)));
+        return input.work.size() - 2;
+      }},
+    {"find_furthest (theirs)", false, [](KernelInput& input)
+      {
+        I first = input.work.begin(), last = std::prev(input.work.end());
+        input.sink += Number(std::distance(first, find_furthest<Policy>(first, last, last)));
+        return input.work.size() - 1;
+      }},
+    {"lowerPartition", true, [](KernelInput& input)
+      {
+        I first = input.work.begin(), last = std::prev(input.work.end());
+        I furthest = first + (input.middle - 1), begin = std::next(first), end = std::prev(furthest);
+        lowerPartition<Policy>(begin, end, first, last, furthest);
+        return input.middle - 2;
+      }},
+    {"upperPartition", true, [](KernelInput& input)
+      {
+        I first = input.work.begin(), last = std::prev(input.work.end());
+        I furthest = std::prev(last), begin = first + input.middle, end = std::prev(furthest);
+        upperPartition<Policy>(begin, end, last, first, furthest);
+        return input.work.size() - input.middle - 2;
+      }},
+    {"partition_left_right", true, [](KernelInput& input)
+      {
+        I first = input.work.begin(), last = std::prev(input.work.end());
+        input.sink += Number(std::distance(first, partition_left_right<Policy>(first, last, last)));
+        return input.work.size() - 1;
+      }},
+    {"swap_blocks", true, [](KernelInput& input)
+      {
+        I first = input.work.begin();
+        swap_blocks(first + input.work.size() / 2, input.work.end(), first);
+        return input.work.size() - input.work.size() / 2;
+      }},
+    {"move_away", true, [](KernelInput& input)
+      {
+        I first = input.work.begin();
+        move_away(first, first + input.work.size() / 4, input.work.end());
+        return input.work.size();
+      }}};
+}
+
+//*****************
+// Preparing points
+//*****************
+
+// Method that returns the generated point sequence "pointSeq" as the point sequence of the orientation policy.
+const PointSequence* getTestedPointSequence(const PointSequence& pointSeq, PointSequence&)
+{
+  return &pointSeq;
+}
+
+// Method that converts the generated point sequence "pointSeq" into the fixed-point sequence "convertedPointSeq" and
+// returns it. If the conversion fails, the method returns nullptr.
+template <typename Integer>
+const std::vector<BasicFixedPoint<Integer>>* getTestedPointSequence(
+  const PointSequence& pointSeq, std::vector<BasicFixedPoint<Integer>>& convertedPointSeq)
+{
+  if (! convertToFixedPointSequence(pointSeq, convertedPointSeq))
+    return nullptr;
+
+  return &convertedPointSeq;
+}
+
+// Method that generates "numberOfPoints" uniformly distributed points from the seed "seed" and prepares them for the
+// kernels (see above). It returns "false" if the points cannot be prepared.
+bool prepareKernelInput(size_t numberOfPoints, std::uint64_t seed, KernelInput& input)
+{
+  using Policy = ORIENTATION_POLICY;
+
+  if (numberOfPoints < 8)
+  {
+    std::cout << "ERROR: The kernels need at least 8 points!" << std::endl;
+    return false;
+  }
+  generatePointSequence(input.points, numberOfPoints, PointDistribution::UNIFORM, seed);
+  PointSequenceScan pointScan = scanPointSequence(input.points);
+  input.leftMostPoint = input.points[pointScan.leftMostIndex];
+  input.rightMostPoint = input.points[pointScan.rightMostIndex];
+
+  TestedPointSequence convertedPointSeq;
+  const TestedPointSequence* testedPointSeq = getTestedPointSequence(input.points, convertedPointSeq);
+  if (testedPointSeq == nullptr)
+    return false;
+  input.original = *testedPointSeq;
+
+  // Prepare the points like the in place quickhull does (see "ConvexHullInPlaceQuickHull").
+  TestedPointSequence& points = input.original;
+  BasicPointSequenceScan<Policy::PointType> scan = scanPointSequence(points);
+  if (! scan.fulfillsMinimalRequirements)
+  {
+    std::cout << "ERROR: The generated points are collinear!" << std::endl;
+    return false;
+  }
+  I first = points.begin(), last = std::prev(points.end());
+  parallel_iter_swap(first, last, first + scan.leftMostIndex, first + scan.rightMostIndex);
+  I middle = partition_right_left<Policy>(std::next(first), last, first, last);
+  input.middle = size_t(std::distance(first, middle));
+  if (input.middle < 3 || points.size() - input.middle < 3)
+  {
+    std::cout << "ERROR: The lower or the upper block of the generated points is too small!" << std::endl;
+    return false;
+  }
+  swapPoints(find_furthest<Policy>(std::next(first), middle, first, last), std::prev(middle));
+  swapPoints(find_furthest<Policy>(middle, last, last, first), std::prev(last));
+  input.work = input.original;
+
+  return true;
+}
+
+//***************
+// Timing kernels
+//***************
+
+// Method that times the kernel "kernel" on the points of the input "input" and returns the median time of its
+// repetitions. The points are restored before the first repetition, so that the kernel does not see the order that
+// a previous kernel left. The timer reads the time stamp counter if it is available.
+TimeDuration timeKernel(const Kernel& kernel, KernelInput& input, double minimalTimeInSeconds,
+                        size_t& numberOfProcessedPoints, size_t& numberOfRepetitions)
+{
+  using Policy = ORIENTATION_POLICY;
+
+  Timer timer(getClockCalibration().timeStampCounterIsAvailable ? ClockSource::TIME_STAMP_COUNTER
+                                                                 : ClockSource::STEADY_CLOCK);
+  TimeDurationSeries durations;
+  double totalTimeInSeconds = 0;
+  BasicPointSequenceScan<Policy::PointType> scan = scanPointSequence(input.original);
+  typename Policy::BoundingBoxScope boundingBoxScope(scan.minCorner, scan.maxCorner);
+
+  restorePointSequence(input.original, input.work);
+  numberOfRepetitions = 0;
+  while (numberOfRepetitions < MINIMAL_NUMBER_OF_REPETITIONS || totalTimeInSeconds < minimalTimeInSeconds)
+  {
+    if (kernel.reordersPoints && numberOfRepetitions > 0)
+      restorePointSequence(input.original, input.work);
+    timer.setStartTime();
+    numberOfProcessedPoints = kernel.run(input);
+    timer.setStopTime();
+    TimeDuration duration = timer.getElapsedTime();
+    durations.addDuration(duration);
+    totalTimeInSeconds += double(duration.getNanoseconds().count()) / 1e9;
+    ++numberOfRepetitions;
+  }
+
+  return durations.calculateMedian();
+}
+
+//*************
+// Command line
+//*************
+
+// Method that returns the numbers of points that fill half of the L1 data cache, half of the L2 cache, half of the
+// last level cache, and four times the last level cache. Unknown cache sizes are replaced by 32 KiB, 1 MiB, and
+// 32 MiB.
+std::vector<size_t> getDefaultNumbersOfPoints()
+{
+  const size_t defaultCacheSizes[] = {size_t(32) << 10, size_t(1) << 20, size_t(32) << 20};
+  const double fractionsOfCacheSizes[] = {0.5, 0.5, 0.5, 4};
+  std::vector<size_t> numbersOfPoints;
+
+  for (size_t i = 0; i < 4; ++i)
+  {
+    size_t level = std::min<size_t>(i + 1, 3);
+    size_t cacheSize = getCacheSize(level);
+    if (cacheSize == 0)
+      cacheSize = defaultCacheSizes[level - 1];
+    numbersOfPoints.push_back(std::max<size_t>(size_t(fractionsOfCacheSizes[i] * double(cacheSize)) /
+                                               sizeof(TestedPointSequence::value_type), 8));
+  }
+
+  return numbersOfPoints;
+}
+
+// Method that parses the comma-separated list "list" of numbers of points. It returns "false" if the list is invalid.
+bool parseNumbersOfPoints(const std::string& list, std::vector<size_t>& numbersOfPoints)
+{
+  std::istringstream values(list);
+  std::string value;
+
+  numbersOfPoints.clear();
+  while (std::getline(values, value, ','))
+  {
+    char* end = nullptr;
+    double numberOfPoints = std::strtod(value.c_str(), &end);
+    if (value.empty() || *end != '\0' || !(numberOfPoints >= 8 && numberOfPoints <= 1e10))
+      return false;
+    numbersOfPoints.push_back(size_t(numberOfPoints));
+  }
+
+  return ! numbersOfPoints.empty();
+}
+
+// Method that prints the command line options of the program "programName" and the names of the kernels "kernels".
+void printUsage(const std::string& programName, const std::vector<Kernel>& kernels)
+{
+  std::cout << "Usage: " << programName << " [options]\n"
+            << "  --kernels NAMES     Comma-separated names of the timed kernels (default: all)\n"
+            << "  --points SIZES      Comma-separated numbers of points, e.g., 1000,1e6 (default: half of the L1, L2,\n"
+            << "                      and last level cache and four times the last level cache)\n"
+            << "  --min-time SECONDS  Minimal total time of the repetitions of a kernel (default: 0.2)\n"
+            << "  --seed SEED         Seed of the generated points (default: 1)\n"
+            << "  --output FILE       Write the results as a CSV table to the file FILE\n"
+            << "  --help              Print this text\n"
+            << "Kernels:";
+  for (const Kernel& kernel : kernels)
+    std::cout << " '" << kernel.name << "'";
+  std::cout << std::endl;
+}
@@ -0,0 +1,192 @@
+#ifndef LOWOVERHEADTIMER_H
+#define LOWOVERHEADTIMER_H
+
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#if defined(__x86_64__) || defined(__i386__)
+#include <cpuid.h>
+#include <x86intrin.h>
+#endif
+
+// A low-overhead timer is a value type that neither allocates memory nor calls a library function when it is started
+// or stopped, so that it can also time small point sequences and single phases of the convex hull algorithms. It
+// reads one of two clocks:
+// - STEADY_CLOCK: "std::chrono::steady_clock".
+// - TIME_STAMP_COUNTER: the time stamp counter of the processor. It is read with "rdtsc" at the start and with
+//   "rdtscp" at the stop, fenced such that the timed instructions cannot leave the measured interval. Its frequency is
+//   calibrated once against the steady clock. It is only used if the processor has an invariant time stamp counter,
+//   i.e., one that ticks with a constant frequency in all power states; otherwise, the steady clock is used instead.
+// The overhead of a timer, i.e., the smallest number of ticks measured between a start and an immediately following
+// stop, is measured once per clock and subtracted from all measured durations.
+
+// Type that indicates the clock read by a timer.
+enum class ClockSource {STEADY_CLOCK, TIME_STAMP_COUNTER};
+
+// Type that keeps the calibration of the clocks.
+struct ClockCalibration
+{
+  // Flag that indicates whether the time stamp counter is invariant and can be used.
+  bool timeStampCounterIsAvailable = false;
+  // Length of a tick of the time stamp counter in nanoseconds.
+  double nanosecondsPerTimeStampCounterTick = 1.0;
+  // Overheads of a timer in ticks of the steady clock and of the time stamp counter respectively.
+  std::int64_t steadyClockOverhead = 0;
+  std::int64_t timeStampCounterOverhead = 0;
+};
+
+class LowOverheadTimer
+{
+  public:
+    // Constructor that creates a timer that reads the clock "clockSource". The clocks are calibrated when the first
+    // timer is created (which takes about 20 milliseconds for the time stamp counter).
+    explicit LowOverheadTimer(ClockSource clockSource = ClockSource::STEADY_CLOCK);
+
+    // Method that starts the timer.
+    void start() { running = true; startTicks = readStartTicks(clockSource); }
+
+    // Method that stops the timer.
+    void stop() { stopTicks = readStopTicks(clockSource); running = false; }
+
+    // Method that returns the time elapsed since the last start of the timer minus the timer overhead. The timer can
+    // have stopped or can still be running.
+    std::chrono::nanoseconds getElapsedTime() const;
+
+    // Method that returns the clock that the timer reads (the steady clock if the time stamp counter was requested
+    // but is not available).
+    ClockSource getClockSource() const { return clockSource; }
+
+    // Methods that read the clock "clockSource" at the start and at the stop of a time measurement respectively.
+    static std::uint64_t readStartTicks(ClockSource clockSource);
+    static std::uint64_t readStopTicks(ClockSource clockSource);
+
+  private:
+    ClockSource clockSource;
+    bool running = false;
+    std::uint64_t startTicks = 0;
+    std::uint64_t stopTicks = 0;
+};
+
+// Method that returns the calibration of the clocks. The clocks are calibrated at the first call.
+const ClockCalibration& getClockCalibration();
+
+//++++++++++++++++++++++++
+// Inline implementations
+//++++++++++++++++++++++++
+
+inline std::uint64_t LowOverheadTimer::readStartTicks(ClockSource clockSource)
+{
+#if defined(__x86_64__) || defined(__i386__)
+  if (clockSource == ClockSource::TIME_STAMP_COUNTER)
+  {
+    // The first fence waits for the preceding instructions; the second one keeps the timed instructions from
+    // starting before the counter is read.
+    _mm_lfence();
+    std::uint64_t ticks = __rdtsc();
+    _mm_lfence();
+    return ticks;
+  }
+#endif
+  return std::chrono::duration_cast<std::chrono::nanoseconds>(
+           std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+inline std::uint64_t LowOverheadTimer::readStopTicks(ClockSource clockSource)
+{
+#if defined(__x86_64__) || defined(__i386__)
+  if (clockSource == ClockSource::TIME_STAMP_COUNTER)
+  {
+    // "rdtscp" waits for the timed instructions; the fence keeps the following instructions from starting before the
+    // counter is read.
+    unsigned int processorId;
+    std::uint64_t ticks = __rdtscp(&processorId);
+    _mm_lfence();
+    return ticks;
+  }
+#endif
+  return std::chrono::duration_cast<std::chrono::nanoseconds>(
+           std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+// Method that measures the overhead of a timer that reads the clock "clockSource".
+inline std::int64_t measureTimerOverhead(ClockSource clockSource)
+{
+  const int NUMBER_OF_TRIALS = 1000;
+  std::int64_t overhead = INT64_MAX;
+
+  for (int i = 0; i < NUMBER_OF_TRIALS; ++i)
+  {
+    std::uint64_t startTicks = LowOverheadTimer::readStartTicks(clockSource);
+    std::uint64_t stopTicks = LowOverheadTimer::readStopTicks(clockSource);
+    overhead = std::min(overhead, std::int64_t(stopTicks - startTicks));
+  }
+
+  return overhead;
+}
+
+// Method that calibrates the clocks (see "getClockCalibration").
+inline ClockCalibration calibrateClocks()
+{
+  ClockCalibration calibration;
+
+  calibration.steadyClockOverhead = measureTimerOverhead(ClockSource::STEADY_CLOCK);
+
+#if defined(__x86_64__) || defined(__i386__)
+  // Check for an invariant time stamp counter (CPUID leaf 0x80000007, bit 8 of EDX).
+  unsigned int eax, ebx, ecx, edx;
+  if (__get_cpuid(0x80000007, &eax, &ebx, &ecx, &edx) && (edx & (1u << 8)))
+  {
+    // Count the ticks of the time stamp counter during a spin of 20 milliseconds of the steady clock.
+    std::chrono::steady_clock::time_point steadyStart = std::chrono::steady_clock::now();
+    std::uint64_t startTicks = LowOverheadTimer::readStartTicks(ClockSource::TIME_STAMP_COUNTER);
+    std::chrono::steady_clock::time_point steadyStop;
+    do
+      steadyStop = std::chrono::steady_clock::now();
+    while (steadyStop - steadyStart < std::chrono::milliseconds(20));
+    std::uint64_t stopTicks = LowOverheadTimer::readStopTicks(ClockSource::TIME_STAMP_COUNTER);
+
+    if (stopTicks > startTicks)
+    {
+      calibration.timeStampCounterIsAvailable = true;
+      calibration.nanosecondsPerTimeStampCounterTick =
+        double(std::chrono::duration_cast<std::chrono::nanoseconds>(steadyStop - steadyStart).count()) /
+        double(stopTicks - startTicks);
+      calibration.timeStampCounterOverhead = measureTimerOverhead(ClockSource::TIME_STAMP_COUNTER);
+    }
+  }
+#endif
+
+  return calibration;
+}
+
+inline const ClockCalibration& getClockCalibration()
+{
+  static const ClockCalibration calibration = calibrateClocks();
+
+  return calibration;
+}
+
+inline LowOverheadTimer::LowOverheadTimer(ClockSource clockSource) : clockSource(clockSource)
+{
+  if (clockSource == ClockSource::TIME_STAMP_COUNTER && ! getClockCalibration().timeStampCounterIsAvailable)
+    this->clockSource = ClockSource::STEADY_CLOCK;
+}
+
+inline std::chrono::nanoseconds LowOverheadTimer::getElapsedTime() const
+{
+  const ClockCalibration& calibration = getClockCalibration();
+  std::uint64_t currentTicks = running ? readStopTicks(clockSource) : stopTicks;
+  std::int64_t ticks = std::int64_t(currentTicks - startTicks);
+
+  if (clockSource == ClockSource::TIME_STAMP_COUNTER)
+  {
+    ticks = std::max<std::int64_t>(0, ticks - calibration.timeStampCounterOverhead);
+    return std::chrono::nanoseconds(std::llround(double(ticks) * calibration.nanosecondsPerTimeStampCounterTick));
+  }
+
+  return std::chrono::nanoseconds(std::max<std::int64_t>(0, ticks - calibration.steadyClockOverhead));
+}
+
+#endif // LOWOVERHEADTIMER_H
@@ -0,0 +1,207 @@
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdlib>      // std::malloc, std::aligned_alloc, std::free
+#include <new>
+#if defined(__unix__) || defined(__APPLE__)
+#include <sys/resource.h>
+#endif
+#if defined(__linux__)
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+#include "MemoryAccounting.h"
+#include "PointBuffer.h"
+
+//+++++++++++++++++++++++
+// Local data and methods
+//+++++++++++++++++++++++
+
+// Heap counters of the whole program. They are constant initialized, so that allocations of other static objects
+// during the dynamic initialization are already counted.
+static std::atomic<size_t> heapBytesInUse(0);
+static std::atomic<size_t> peakHeapBytesInUse(0);
+static std::atomic<size_t> numberOfAllocations(0);
+static std::atomic<size_t> allocatedHeapBytes(0);
+
+// Method that counts an allocation of "size" bytes.
+static void countAllocation(size_t size)
+{
+  size_t currentHeapBytes = heapBytesInUse.fetch_add(size, std::memory_order_relaxed) + size;
+  size_t peakHeapBytes = peakHeapBytesInUse.load(std::memory_order_relaxed);
+  while (currentHeapBytes > peakHeapBytes &&
+         !peakHeapBytesInUse.compare_exchange_weak(peakHeapBytes, currentHeapBytes, std::memory_order_relaxed))
+    ;
+  numberOfAllocations.fetch_add(1, std::memory_order_relaxed);
+  allocatedHeapBytes.fetch_add(size, std::memory_order_relaxed);
+}
+
+// Method that counts a release of "size" bytes.
+static void countRelease(size_t size)
+{
+  heapBytesInUse.fetch_sub(size, std::memory_order_relaxed);
+}
+
+// Large point buffers may be mapped instead of allocated on the heap (see "PointBuffer.h"). They are counted like
+// allocations, so that the heap metrics do not depend on the parameters of the point buffers. The constructor of the
+// object sets the hooks before "main" is called.
+static struct MappedPointBufferCounting
+{
+  MappedPointBufferCounting() { setMappedPointBufferHooks(countAllocation, countRelease); }
+} mappedPointBufferCounting;
+
+// Each allocated block starts with a header that keeps the requested size and the offset of the returned memory from
+// the start of the block, so that the size of the released memory is known in "operator delete" without sized
+// deallocation. The header is as large as the alignment of the returned memory, but at least as large as the default
+// alignment.
+constexpr size_t HEADER_SIZE = alignof(std::max_align_t);
+static_assert(HEADER_SIZE >= 2 * sizeof(size_t), "The header cannot keep the size and the offset.");
+
+// Method that allocates "size" bytes aligned to "alignment" and counts them. The method returns nullptr if the memory
+// cannot be allocated.
+static void* allocateCountedMemory(size_t size, size_t alignment)
+{
+  size_t offset = std::max(alignment, HEADER_SIZE);
+  if (size > size_t(-1) - 2 * offset)
+    return nullptr;
+
+  void* block;
+  if (alignment <= HEADER_SIZE)
+    block = std::malloc(offset + size);
+  else // "std::aligned_alloc" requires a size that is a multiple of the alignment
+    block = std::aligned_alloc(alignment, offset + (size + alignment - 1) / alignment * alignment);
+  if (block == nullptr)
+    return nullptr;
+
+  size_t* memory = reinterpret_cast<size_t*>(static_cast<char*>(block) + offset);
+  memory[-1] = size;
+  memory[-2] = offset;
+  countAllocation(size);
+
+  return memory;
+}
+
+// Method that allocates "size" bytes aligned to "alignment" like "operator new": if the memory cannot be allocated,
+// the new handler is called until it can be allocated. If no new handler is installed, "std::bad_alloc" is thrown.
+static void* allocateCountedMemoryOrThrow(size_t size, size_t alignment)
+{
+  void* memory;
+
+  while ((memory = allocateCountedMemory(size, alignment)) == nullptr)
+  {
+    std::new_handler newHandler = std::get_new_handler();
+    if (newHandler == nullptr)
+      throw std::bad_alloc();
+    newHandler();
+  }
+
+  return memory;
+}
+
+// Method that releases the memory "memory" allocated by "allocateCountedMemory".
+static void releaseCountedMemory(void* memory)
+{
+  if (memory == nullptr)
+    return;
+
+  size_t* header = static_cast<size_t*>(memory);
+  countRelease(header[-1]);
+  std::free(static_cast<char*>(memory) - header[-2]);
+}
+
+// Method that resets the peak resident set size of the process to its current resident set size. System calls are
+// used instead of a file stream, so that no heap memory is allocated. The method returns "false" if the kernel does
+// not support it.
+static bool resetPeakResidentSetSize()
+{
+#if defined(__linux__)
+  int fileDescriptor = open("/proc/self/clear_refs", O_WRONLY);
+  if (fileDescriptor < 0)
+    return false;
+
+  bool isReset = (write(fileDescriptor, "5", 1) == 1);
+  close(fileDescriptor);
+  return isReset;
+#else
+  return false;
+#endif
+}
+
+// Method that returns the peak resident set size of the process in kibibytes (0 if it is not available).
+static size_t getPeakResidentSetSize()
+{
+#if defined(__unix__) || defined(__APPLE__)
+  rusage resourceUsage;
+  if (getrusage(RUSAGE_SELF, &resourceUsage) == 0 && resourceUsage.ru_maxrss > 0)
+  #if defined(__APPLE__)
+    return size_t(resourceUsage.ru_maxrss) / 1024; // macOS provides bytes instead of kibibytes
+  #else
+    return size_t(resourceUsage.ru_maxrss);
+  #endif
+#endif
+
+  return 0;
+}
+
+//+++++++++++++++++++++++++++++++++++++
+// Replaced global operators new/delete
+//+++++++++++++++++++++++++++++++++++++
+
+// The basic and the sized operators are replaced; the default array and nothrow versions call them. The sized
+// operators ignore the size, since the header keeps it.
+void* operator new(size_t size)
+{
+  return allocateCountedMemoryOrThrow(size, HEADER_SIZE);
+}
+
+void* operator new(size_t size, std::align_val_t alignment)
+{
+  return allocateCountedMemoryOrThrow(size, size_t(alignment));
+}
+
+void operator delete(void* memory) noexcept
+{
+  releaseCountedMemory(memory);
+}
+
+void operator delete(void* memory, std::align_val_t) noexcept
+{
+  releaseCountedMemory(memory);
+}
+
+void operator delete(void* memory, size_t) noexcept
+{
+  releaseCountedMemory(memory);
+}
+
+void operator delete(void* memory, size_t, std::align_val_t) noexcept
+{
+  releaseCountedMemory(memory);
+}
+
+//++++++++++++++++++
+// Memory accounting
+//++++++++++++++++++
+
+// Method that starts the measured interval.
+void MemoryAccounting::start()
+{
+  resetPeakResidentSetSize();
+
+  heapBytesAtStart = heapBytesInUse.load(std::memory_order_relaxed);
+  peakHeapBytesInUse.store(heapBytesAtStart, std::memory_order_relaxed);
+  numberOfAllocationsAtStart = numberOfAllocations.load(std::memory_order_relaxed);
+  allocatedHeapBytesAtStart = allocatedHeapBytes.load(std::memory_order_relaxed);
+}
+
+// Method that stops the measured interval.
+void MemoryAccounting::stop()
+{
+  size_t peakHeapBytes = peakHeapBytesInUse.load(std::memory_order_relaxed);
+
+  usage.peakHeapBytes = (peakHeapBytes > heapBytesAtStart) ? peakHeapBytes - heapBytesAtStart : 0;
+  usage.numberOfAllocations = numberOfAllocations.load(std::memory_order_relaxed) - numberOfAllocationsAtStart;
+  usage.allocatedHeapBytes = allocatedHeapBytes.load(std::memory_order_relaxed) - allocatedHeapBytesAtStart;
+  usage.peakResidentSetSize = getPeakResidentSetSize();
+}
@@ -0,0 +1,51 @@
+#ifndef MEMORYACCOUNTING_H
+#define MEMORYACCOUNTING_H
+
+
+#include <cstddef>
+
+// The memory accounting measures the auxiliary memory that the convex hull algorithms allocate while they run, so
+// that the space efficiency of the in place algorithms can be compared with the copying ones. "MemoryAccounting.cpp"
+// replaces the global operators new and delete of the program: they keep the number of heap bytes in use, their peak,
+// and the number of allocations in atomic counters (i.e., allocations of all threads are counted). Large point buffers
+// that are mapped instead of allocated (see "PointBuffer.h") are counted like allocations. Memory allocated with
+// "malloc" directly is not counted.
+//
+// In addition, the peak resident set size of the process is read with "getrusage". It includes the memory of the
+// point sequences and is only reset before a measured interval where the Linux kernel supports it (by writing "5" into
+// "/proc/self/clear_refs"); otherwise it is the peak since the program started.
+
+// Type that keeps the memory usage of a measured interval.
+struct MemoryUsage
+{
+  // Peak number of heap bytes in use during the interval beyond the bytes in use at its start.
+  size_t peakHeapBytes = 0;
+  // Number and total size of the heap allocations during the interval.
+  size_t numberOfAllocations = 0;
+  size_t allocatedHeapBytes = 0;
+  // Peak resident set size of the process in kibibytes (0 if it is not available).
+  size_t peakResidentSetSize = 0;
+};
+
+class MemoryAccounting
+{
+  public:
+    // Method that starts the measured interval.
+    void start();
+
+    // Method that stops the measured interval.
+    void stop();
+
+    // Method that returns the memory usage of the measured interval between the last start and stop.
+    MemoryUsage getUsage() const { return usage; }
+
+  private:
+    // Heap counters at the start of the interval.
+    size_t heapBytesAtStart = 0;
+    size_t numberOfAllocationsAtStart = 0;
+    size_t allocatedHeapBytesAtStart = 0;
+
+    MemoryUsage usage;
+};
+
+#endif // MEMORYACCOUNTING_H
@@ -0,0 +1,199 @@
+
+#include <cmath>        // std::fma
+#include "Number.h"
+#include "OrientationPredicates.h"
+#include "PointHandler.h"
+
+//++++++++++++++++++++++++
+// Local data and methods
+//++++++++++++++++++++++++
+
+// An expansion is a sequence of floating-point numbers whose (exact) sum is the represented value. The components are
+// nonoverlapping and sorted by increasing magnitude, so the sign of the value is the sign of the last component.
+
+// Maximal number of components of the expansions below: two cross products of eight exact products with two
+// components each.
+constexpr int MAX_NUMBER_OF_COMPONENTS = 32;
+
+// Method that computes the sum of "a" and "b" as the rounded sum "sum" plus the exact rounding error "error"
+// (Knuth's TwoSum).
+static inline void twoSum(Number a, Number b, Number& sum, Number& error)
+{
+  sum = a + b;
+  Number bVirtual = sum - a;
+  Number aVirtual = sum - bVirtual;
+  error = (a - aVirtual) + (b - bVirtual);
+}
+
+// Method that computes the product of "a" and "b" as the rounded product "product" plus the exact rounding error
+// "error". Without a fast fused multiply-add, Dekker's splitting into halves of 26 bits is used.
+static inline void twoProduct(Number a, Number b, Number& product, Number& error)
+{
+  product = a * b;
+#if defined(FP_FAST_FMA)
+  error = std::fma(a, b, -product);
+#else
+  const Number splitter = 134217729.0; // 2^27 + 1
+  Number c = splitter * a;
+  Number aHigh = c - (c - a);
+  Number aLow = a - aHigh;
+  c = splitter * b;
+  Number bHigh = c - (c - b);
+  Number bLow = b - bHigh;
+  error = aLow * bLow - (((product - aHigh * bHigh) - aLow * bHigh) - aHigh * bLow);
+#endif
+}
+
+// Method that adds the number "b" to the expansion with the "numberOfComponents" components "components" (Shewchuk's
+// Grow-Expansion with zero elimination). The result replaces the expansion and its number of components is returned.
+static int growExpansion(Number* components, int numberOfComponents, Number b)
+{
+  int numberOfNewComponents = 0;
+  Number sum = b, error;
+
+  for (int i = 0; i < numberOfComponents; ++i)
+  {
+    twoSum(sum, components[i], sum, error);
+    if (error != 0)
+      components[numberOfNewComponents++] = error;
+  }
+  if (sum != 0 || numberOfNewComponents == 0)
+    components[numberOfNewComponents++] = sum;
+
+  return numberOfNewComponents;
+}
+
+// Method that adds "factor" times the cross product (b - a) x (d - c) to the expansion with the "numberOfComponents"
+// components "components", where "factor" is 1 or -1. The cross product is expanded into the eight products
+//   b.x * d.y - b.x * c.y - a.x * d.y + a.x * c.y - b.y * d.x + b.y * c.x + a.y * d.x - a.y * c.x,
+// which are computed exactly. The method returns the new number of components.
+static int addCrossProductToExpansion(Number* components, int numberOfComponents, const Point& a, const Point& b,
+                                      const Point& c, const Point& d, Number factor)
+{
+  const Number factors[8][2] = {{b.x, d.y}, {-b.x, c.y}, {-a.x, d.y}, {a.x, c.y},
+                                {-b.y, d.x}, {b.y, c.x}, {a.y, d.x}, {-a.y, c.x}};
+
+  for (const auto& pair : factors)
+  {
+    Number product, error;
+    twoProduct(factor * pair[0], pair[1], product, error);
+    numberOfComponents = growExpansion(components, numberOfComponents, error);
+    numberOfComponents = growExpansion(components, numberOfComponents, product);
+  }
+
+  return numberOfComponents;
+}
+
+// Method that returns the sign (-1, 0, or 1) of the value of an expansion.
+static int getSignOfExpansion(const Number* components, int numberOfComponents)
+{
+  Number value = components[numberOfComponents - 1];
+
+  return (value > 0) - (value < 0);
+}
+
+//******************
+// Exact predicates
+//******************
+
+// Method that for three points p, q, and r finds the orientation of the ordered triplet (p, q, r) exactly by
+// evaluating the cross product (q - p) x (r - p) as an expansion.
+Orientation getExactOrientation(const Point& p, const Point& q, const Point& r)
+{
+  Number components[MAX_NUMBER_OF_COMPONENTS];
+  int numberOfComponents = addCrossProductToExpansion(components, 0, p, q, p, r, 1);
+  int sign = getSignOfExpansion(components, numberOfComponents);
+
+  if (sign == 0)
+    return Orientation::COLLINEAR;
+  else
+    return (sign < 0) ? Orientation::CLOCKWISE : Orientation::COUNTERCLOCKWISE;
+}
+
+// Method that compares the areas of the triangles (p, q, r) and (p, q, s) exactly. The areas are the absolute values
+// of the cross products (q - p) x (r - p) and (q - p) x (s - p), so the cross products are multiplied by their exact
+// signs and the sign of the difference is determined as an expansion.
+int compareAreasExactly(const Point& p, const Point& q, const Point& r, const Point& s)
+{
+  Orientation rOrientation = getExactOrientation(p, q, r), sOrientation = getExactOrientation(p, q, s);
+
+  if (rOrientation == Orientation::COLLINEAR)
+    return (sOrientation == Orientation::COLLINEAR) ? 0 : -1;
+  if (sOrientation == Orientation::COLLINEAR)
+    return 1;
+
+  Number components[MAX_NUMBER_OF_COMPONENTS];
+  int numberOfComponents = addCrossProductToExpansion(components, 0, p, q, p, r,
+                                                      (rOrientation == Orientation::CLOCKWISE) ? -1 : 1);
+  numberOfComponents = addCrossProductToExpansion(components, numberOfComponents, p, q, p, s,
+                                                  (sOrientation == Orientation::CLOCKWISE) ? 1 : -1);
+  return getSignOfExpansion(components, numberOfComponents);
+}
+
+// Method that computes the cross product of the points p, q, and r in floating-point arithmetic together with a
+// bound on its absolute error.
+static inline Number computeCrossProduct(const Point& p, const Point& q, const Point& r, Number& errorBound)
+{
+  Number leftProduct = (q.x - p.x) * (r.y - p.y);
+  Number rightProduct = (q.y - p.y) * (r.x - p.x);
+
+  errorBound = ORIENTATION_ERROR_BOUND * (std::fabs(leftProduct) + std::fabs(rightProduct));
+  return leftProduct - rightProduct;
+}
+
+//**************************
+// Adaptive orientation policy
+//**************************
+
+// Constructor: Sets the static error bound for the points of the bounding box with the corners "minCorner" and
+// "maxCorner". For points of the bounding box, the absolute values of the coordinate differences are at most its
+// (rounded) width and height, so the sum of the absolute values of the two products of the cross product is at most
+// twice the product of width and height (with a small allowance for the rounding errors of this computation).
+AdaptiveOrientationPolicy::BoundingBoxScope::BoundingBoxScope(const Point& minCorner, const Point& maxCorner)
+  : previousStaticErrorBound(staticErrorBound)
+{
+  Number width = maxCorner.x - minCorner.x, height = maxCorner.y - minCorner.y;
+  Number errorBound = ORIENTATION_ERROR_BOUND * 2.0 * width * height *
+                      (1.0 + 8.0 * std::numeric_limits<Number>::epsilon());
+
+  // A bounding box with infinite or NaN extent (or an invalid one) does not yield a usable bound.
+  if (errorBound >= 0)
+    staticErrorBound = errorBound;
+  else
+    staticErrorBound = std::numeric_limits<Number>::infinity();
+}
+
+// Destructor: Restores the static error bound that was valid before the constructor was called.
+AdaptiveOrientationPolicy::BoundingBoxScope::~BoundingBoxScope()
+{
+  staticErrorBound = previousStaticErrorBound;
+}
+
+// Method that determines the orientation of the ordered triplet (p, q, r) if the static error bound does not suffice.
+Orientation AdaptiveOrientationPolicy::orientationOfUncertainCase(const Point& p, const Point& q, const Point& r)
+{
+  Number errorBound, value = computeCrossProduct(p, q, r, errorBound);
+
+  if (value > errorBound)
+    return Orientation::COUNTERCLOCKWISE;
+  if (value < -errorBound)
+    return Orientation::CLOCKWISE;
+  return getExactOrientation(p, q, r);
+}
+
+// Method that compares the areas of the triangles (p, q, r) and (p, q, s) if the static error bound does not suffice.
+int AdaptiveOrientationPolicy::compareAreasOfUncertainCase(const Point& p, const Point& q, const Point& r,
+                                                           Number rArea, const Point& s, Number sArea)
+{
+  Number rErrorBound, sErrorBound;
+  computeCrossProduct(p, q, r, rErrorBound);
+  computeCrossProduct(p, q, s, sErrorBound);
+
+  Number difference = rArea - sArea;
+  Number errorBound = (rErrorBound + sErrorBound) * (1.0 + 4.0 * std::numeric_limits<Number>::epsilon());
+  if (difference > errorBound)
+    return 1;
+  if (difference < -errorBound)
+    return -1;
+  return compareAreasExactly(p, q, r, s);
+}
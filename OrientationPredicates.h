@@ -0,0 +1,208 @@
+#ifndef ORIENTATIONPREDICATES_H
+#define ORIENTATIONPREDICATES_H
+
+
+#include <cmath>
+#include <limits>
+#include "FixedPoint.h"
+#include "HullStatistics.h"
+#include "Number.h"
+#include "PointHandler.h"
+
+// The convex hull algorithms decide all geometric questions by the orientation of ordered triplets of points and by
+// the distances of points from lines. They obtain these from an orientation policy, i.e., a type with the types
+// "PointType" (the type of the points), "Area", and "BoundingBoxScope" and the static methods
+//   Orientation orientation(const PointType& p, const PointType& q, const PointType& r);
+//   Area area(const PointType& p, const PointType& q, const PointType& r);
+//   int compareAreas(const PointType& p, const PointType& q, const PointType& r, Area rArea, const PointType& s,
+//                    Area sArea);
+// The method "orientation" has the same meaning as the method "getOrientation" (see "PointHandler.h"). The method
+// "area" returns the absolute value of the cross product, i.e., twice the area of the triangle (p, q, r), which is
+// proportional to the distance of r from the line through p and q. The method "compareAreas" compares the areas
+// "rArea" and "sArea" of the triangles (p, q, r) and (p, q, s) as returned by "area" and returns a positive value if
+// the first one is larger, a negative value if it is smaller, and 0 if they are equal. An algorithm creates a
+// "BoundingBoxScope" object with the bounding box of its points before it calls the other methods; the policy may use
+// it to speed them up until the object is destroyed. The methods "orientation" and "area" count their calls as
+// orientation tests and distance evaluations if hull statistics are enabled (see "HullStatistics.h").
+//
+// - "FastOrientationPolicy" only evaluates the cross products in floating-point arithmetic. If the points are almost
+//   collinear, the rounding errors can lead to wrong or inconsistent results.
+// - "AdaptiveOrientationPolicy" evaluates the cross products in floating-point arithmetic, too, but only accepts a
+//   result if it is certain. Within a bounding box scope, it first checks a static error bound that holds for all
+//   points of the bounding box, so that the common case costs a single comparison more than the fast policy. Otherwise
+//   or if this check fails, it computes the error bound of the particular cross product (Shewchuk's filter for the
+//   2D orientation test) and, only if this check fails, too, it determines the result by exact expansion arithmetic.
+//   The results are always exact (unless products of coordinates overflow or underflow).
+// - "FixedPointOrientationPolicy" is the policy for fixed-point points (see "FixedPoint.h"). It computes the cross
+//   products exactly in integer arithmetic.
+
+// Relative error bound of the floating-point cross product as computed by the orientation policies. If the absolute
+// value of the cross product exceeds this bound times the sum of the absolute values of its two products, its sign is
+// correct.
+constexpr Number ORIENTATION_ERROR_BOUND = (3.0 + 16.0 * (std::numeric_limits<Number>::epsilon() / 2)) *
+                                           (std::numeric_limits<Number>::epsilon() / 2);
+
+// Method that for three points p, q, and r finds the orientation of the ordered triplet (p, q, r) exactly by
+// evaluating the cross product with expansion arithmetic. This is much slower than the floating-point evaluation.
+Orientation getExactOrientation(const Point& p, const Point& q, const Point& r);
+
+// Method that compares the areas (i.e., the absolute values of the cross products) of the triangles (p, q, r) and
+// (p, q, s) exactly. It returns a positive value if the first area is larger, a negative value if it is smaller, and
+// 0 if the areas are equal.
+int compareAreasExactly(const Point& p, const Point& q, const Point& r, const Point& s);
+
+// Orientation policy that evaluates the cross products in floating-point arithmetic only.
+struct FastOrientationPolicy
+{
+  using PointType = Point;
+  using Area = Number;
+
+  // Type that does nothing since the fast orientation policy does not use bounding boxes.
+  struct BoundingBoxScope
+  {
+    BoundingBoxScope(const Point&, const Point&) {}
+  };
+
+  static Orientation orientation(const Point& p, const Point& q, const Point& r)
+  {
+    COUNT_HULL_OPERATION(ORIENTATION_TESTS);
+    Number value = (q.x - p.x) * (r.y - p.y) - (q.y - p.y) * (r.x - p.x);
+
+    if (value == 0)
+      return Orientation::COLLINEAR;
+    else
+      return (value < 0) ? Orientation::CLOCKWISE : Orientation::COUNTERCLOCKWISE;
+  }
+
+  static Number area(const Point& p, const Point& q, const Point& r)
+  {
+    COUNT_HULL_OPERATION(DISTANCE_EVALUATIONS);
+    return std::fabs((q.x - p.x) * (r.y - p.y) - (q.y - p.y) * (r.x - p.x));
+  }
+
+  static int compareAreas(const Point&, const Point&, const Point&, Number rArea, const Point&, Number sArea)
+  {
+    return (rArea > sArea) - (rArea < sArea);
+  }
+};
+
+// Orientation policy that evaluates the cross products in floating-point arithmetic with error bounds and falls back
+// to exact arithmetic if a result is uncertain.
+class AdaptiveOrientationPolicy
+{
+  public:
+  using PointType = Point;
+  using Area = Number;
+
+  // Type whose objects set the static error bound for the points of a bounding box while they exist. The objects of
+  // a thread must be destroyed in the reverse order of their creation.
+  class BoundingBoxScope
+  {
+    public:
+    BoundingBoxScope(const Point& minCorner, const Point& maxCorner);
+    ~BoundingBoxScope();
+
+    BoundingBoxScope(const BoundingBoxScope&) = delete;
+    BoundingBoxScope& operator = (const BoundingBoxScope&) = delete;
+
+    private:
+    Number previousStaticErrorBound;
+  };
+
+  static Orientation orientation(const Point& p, const Point& q, const Point& r)
+  {
+    COUNT_HULL_OPERATION(ORIENTATION_TESTS);
+    Number value = (q.x - p.x) * (r.y - p.y) - (q.y - p.y) * (r.x - p.x);
+
+    if (__builtin_expect(std::fabs(value) > staticErrorBound, 1))
+      return (value < 0) ? Orientation::CLOCKWISE : Orientation::COUNTERCLOCKWISE;
+    return orientationOfUncertainCase(p, q, r);
+  }
+
+  static Number area(const Point& p, const Point& q, const Point& r)
+  {
+    COUNT_HULL_OPERATION(DISTANCE_EVALUATIONS);
+    return std::fabs((q.x - p.x) * (r.y - p.y) - (q.y - p.y) * (r.x - p.x));
+  }
+
+  static int compareAreas(const Point& p, const Point& q, const Point& r, Number rArea, const Point& s, Number sArea)
+  {
+    // Both areas have an absolute error of at most the static error bound, and the subtraction adds a rounding error
+    // of at most one unit in the last place of the difference.
+    Number difference = rArea - sArea;
+
+    if (__builtin_expect(std::fabs(difference) > 2.0 * (1.0 + 4.0 * std::numeric_limits<Number>::epsilon()) *
+                                                 staticErrorBound, 1))
+      return (difference < 0) ? -1 : 1;
+    return compareAreasOfUncertainCase(p, q, r, rArea, s, sArea);
+  }
+
+  private:
+  // Bound on the absolute error of the floating-point cross product of three points of the bounding box of the current
+  // bounding box scope of the thread (infinity outside of a scope). The variable is constant-initialized so that it
+  // can be accessed without a call.
+  static inline thread_local Number staticErrorBound = std::numeric_limits<Number>::infinity();
+
+  // Methods that are called if the static error bound does not suffice. They check the error bound of the particular
+  // cross products first and use exact arithmetic only if this does not suffice either. They are rarely called and
+  // therefore never inlined.
+  __attribute__((cold, noinline)) static Orientation orientationOfUncertainCase(const Point& p, const Point& q,
+                                                                              const Point& r);
+  __attribute__((cold, noinline)) static int compareAreasOfUncertainCase(const Point& p, const Point& q,
+                                                                       const Point& r, Number rArea, const Point& s,
+                                                                       Number sArea);
+};
+
+// Orientation policy for fixed-point points with coordinates of type "Integer". As long as the absolute values of the
+// coordinates do not exceed "BasicFixedPoint<Integer>::MAX_COORDINATE", the cross products are computed exactly in
+// the integer type "BasicFixedPoint<Integer>::Product", so no filter is needed.
+template <typename Integer>
+class FixedPointOrientationPolicy
+{
+  public:
+  using PointType = BasicFixedPoint<Integer>;
+  using Area = typename PointType::Product;
+
+  // Type that does nothing since the cross products are always exact.
+  struct BoundingBoxScope
+  {
+    BoundingBoxScope(const PointType&, const PointType&) {}
+  };
+
+  static Orientation orientation(const PointType& p, const PointType& q, const PointType& r)
+  {
+    COUNT_HULL_OPERATION(ORIENTATION_TESTS);
+    Area value = computeCrossProduct(p, q, r);
+
+    if (value == 0)
+      return Orientation::COLLINEAR;
+    else
+      return (value < 0) ? Orientation::CLOCKWISE : Orientation::COUNTERCLOCKWISE;
+  }
+
+  static Area area(const PointType& p, const PointType& q, const PointType& r)
+  {
+    COUNT_HULL_OPERATION(DISTANCE_EVALUATIONS);
+    Area value = computeCrossProduct(p, q, r);
+
+    return (value < 0) ? -value : value;
+  }
+
+  static int compareAreas(const PointType&, const PointType&, const PointType&, Area rArea, const PointType&,
+                          Area sArea)
+  {
+    return (rArea > sArea) - (rArea < sArea);
+  }
+
+  private:
+  // Method that computes the cross product (q - p) x (r - p) exactly.
+  static Area computeCrossProduct(const PointType& p, const PointType& q, const PointType& r)
+  {
+    using Difference = typename PointType::Difference;
+
+    return Area(Difference(q.x) - p.x) * (Difference(r.y) - p.y) -
+           Area(Difference(q.y) - p.y) * (Difference(r.x) - p.x);
+  }
+};
+
+#endif // ORIENTATIONPREDICATES_H
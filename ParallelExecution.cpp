@@ -0,0 +1,185 @@
+
+#include <atomic>
+#include <exception>
+#include <mutex>
+#include <thread>
+#include <vector>
+#if defined(__linux__)
+#include <pthread.h>
+#include <sched.h>
+#endif
+#include "ParallelExecution.h"
+#include "TraceRecorder.h"
+
+// Number of threads used by parallel methods that are called with a number of threads equal to 0. The value 0 means
+// that the number of hardware threads is used.
+static std::atomic<size_t> defaultNumberOfThreads(0);
+
+// Processors that the threads are pinned to in the order of the thread indexes; empty if pinning is disabled. It is
+// only changed by "setThreadPinning", i.e., outside of parallel calls.
+static std::vector<int> pinnedProcessors;
+
+//++++++++++++++
+// Local methods
+//++++++++++++++
+
+// Method that pins the calling thread to the processor of the thread index "threadIndex" if pinning is enabled.
+static void pinCurrentThread(size_t threadIndex)
+{
+  #if defined(__linux__)
+  if (pinnedProcessors.empty())
+    return;
+
+  cpu_set_t processors;
+  CPU_ZERO(&processors);
+  CPU_SET(pinnedProcessors[threadIndex % pinnedProcessors.size()], &processors);
+  pthread_setaffinity_np(pthread_self(), sizeof(processors), &processors);
+  #else
+  (void) threadIndex;
+  #endif
+}
+
+//+++++++++++++++++++
+// Parallel execution
+//+++++++++++++++++++
+
+// Method that returns the number of threads that is used by parallel methods if they are called with a number of
+// threads equal to 0. Initially, this is the number of hardware threads reported by the system (at least 1).
+size_t getDefaultNumberOfThreads()
+{
+  size_t numberOfThreads = defaultNumberOfThreads.load(std::memory_order_relaxed);
+
+  // The number of hardware threads is only asked for once, since the system call costs more than scanning a small
+  // point sequence (e.g., of a batch, see "ConvexHullBatch.h").
+  static const size_t numberOfHardwareThreads = std::thread::hardware_concurrency();
+  if (numberOfThreads == 0)
+    numberOfThreads = numberOfHardwareThreads;
+
+  return (numberOfThreads == 0) ? 1 : numberOfThreads;
+}
+
+// Method that sets the number of threads that is used by parallel methods if they are called with a number of threads
+// equal to 0. A value of 0 restores the number of hardware threads.
+void setDefaultNumberOfThreads(size_t numberOfThreads)
+{
+  defaultNumberOfThreads.store(numberOfThreads, std::memory_order_relaxed);
+}
+
+// Method that returns "numberOfThreads" if it is positive and the default number of threads otherwise.
+size_t resolveNumberOfThreads(size_t numberOfThreads)
+{
+  return (numberOfThreads > 0) ? numberOfThreads : getDefaultNumberOfThreads();
+}
+
+// Method that enables or disables the pinning of threads.
+bool setThreadPinning(bool pinningIsEnabled)
+{
+  #if defined(__linux__)
+  static cpu_set_t allowedProcessors;
+
+  if (pinningIsEnabled == !pinnedProcessors.empty())
+    return true;
+  if (!pinningIsEnabled)
+  {
+    pinnedProcessors.clear();
+    return pthread_setaffinity_np(pthread_self(), sizeof(allowedProcessors), &allowedProcessors) == 0;
+  }
+
+  // The processors that the process may run on are taken from the calling thread before it is pinned.
+  if (pthread_getaffinity_np(pthread_self(), sizeof(allowedProcessors), &allowedProcessors) != 0)
+    return false;
+  for (int processor = 0; processor < CPU_SETSIZE; ++processor)
+    if (CPU_ISSET(processor, &allowedProcessors))
+      pinnedProcessors.push_back(processor);
+  if (pinnedProcessors.empty())
+    return false;
+  pinCurrentThread(0);
+  return true;
+  #else
+  return !pinningIsEnabled;
+  #endif
+}
+
+// Method that returns the number of processors that the process may run on.
+size_t getNumberOfAvailableProcessors()
+{
+  #if defined(__linux__)
+  cpu_set_t allowedProcessors;
+  if (sched_getaffinity(0, sizeof(allowedProcessors), &allowedProcessors) == 0 && CPU_COUNT(&allowedProcessors) > 0)
+    return size_t(CPU_COUNT(&allowedProcessors));
+  #endif
+  size_t numberOfProcessors = std::thread::hardware_concurrency();
+
+  return (numberOfProcessors == 0) ? 1 : numberOfProcessors;
+}
+
+// Method that pins the calling thread to the processors that the threads of "runInParallel" with up to
+// "numberOfThreads" threads are not pinned to.
+bool pinCurrentThreadToSpareProcessors(size_t numberOfThreads)
+{
+  #if defined(__linux__)
+  if (pinnedProcessors.size() <= numberOfThreads)
+    return false;
+
+  cpu_set_t processors;
+  CPU_ZERO(&processors);
+  for (size_t i = numberOfThreads; i < pinnedProcessors.size(); ++i)
+    CPU_SET(pinnedProcessors[i], &processors);
+  return pthread_setaffinity_np(pthread_self(), sizeof(processors), &processors) == 0;
+  #else
+  (void) numberOfThreads;
+  return false;
+  #endif
+}
+
+// Method that executes "task(threadIndex)" for all thread indexes 0, ..., numberOfThreads - 1 concurrently and waits
+// until all tasks are completed. The calling thread executes the task with thread index 0 itself so that no thread is
+// created if "numberOfThreads" is 1. If tasks throw exceptions, the first one is rethrown after all tasks are joined.
+void runInParallel(size_t numberOfThreads, const std::function<void(size_t threadIndex)>& task)
+{
+  if (numberOfThreads <= 1)
+  {
+    task(0);
+    return;
+  }
+
+  std::exception_ptr firstException;
+  std::mutex exceptionMutex;
+  auto guardedTask = [&](size_t threadIndex)
+  {
+    TRACE_SPAN("parallel task");
+    if (threadIndex > 0)
+      pinCurrentThread(threadIndex);
+    try
+    {
+      task(threadIndex);
+    }
+    catch (...)
+    {
+      std::lock_guard<std::mutex> lock(exceptionMutex);
+      if (!firstException)
+        firstException = std::current_exception();
+    }
+  };
+
+  std::vector<std::thread> threads;
+  threads.reserve(numberOfThreads - 1);
+  for (size_t threadIndex = 1; threadIndex < numberOfThreads; ++threadIndex)
+    threads.emplace_back(guardedTask, threadIndex);
+  guardedTask(0);
+  for (std::thread& thread : threads)
+    thread.join();
+
+  if (firstException)
+    std::rethrow_exception(firstException);
+}
+
+// Method that splits the index range [0, numberOfElements) into "numberOfParts" consecutive parts whose sizes differ
+// by at most one and returns the first index of the part with number "part". For part == numberOfParts, it returns
+// "numberOfElements".
+size_t getPartBegin(size_t numberOfElements, size_t numberOfParts, size_t part)
+{
+  size_t partSize = numberOfElements / numberOfParts, remainder = numberOfElements % numberOfParts;
+
+  return part * partSize + ((part < remainder) ? part : remainder);
+}
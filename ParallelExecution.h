@@ -0,0 +1,44 @@
+#ifndef PARALLELEXECUTION_H
+#define PARALLELEXECUTION_H
+
+
+#include <cstddef>
+#include <functional>
+
+// Method that returns the number of threads that is used by parallel methods if they are called with a number of
+// threads equal to 0. Initially, this is the number of hardware threads reported by the system (at least 1).
+size_t getDefaultNumberOfThreads();
+
+// Method that sets the number of threads that is used by parallel methods if they are called with a number of threads
+// equal to 0. A value of 0 restores the number of hardware threads.
+void setDefaultNumberOfThreads(size_t numberOfThreads);
+
+// Method that returns "numberOfThreads" if it is positive and the default number of threads otherwise.
+size_t resolveNumberOfThreads(size_t numberOfThreads);
+
+// Method that enables or disables the pinning of threads. While pinning is enabled, the calling thread is pinned to
+// the first processor that the process may run on and the thread with index i of "runInParallel" to the i-th one
+// (modulo the number of processors), so that the threads of consecutive parallel calls run on the same processors.
+// Disabling the pinning allows the calling thread to run on all processors again. The method returns "false" if the
+// system does not support pinning (only Linux does); the threads then stay unpinned.
+bool setThreadPinning(bool pinningIsEnabled);
+
+// Method that returns the number of processors that the process may run on (at least 1).
+size_t getNumberOfAvailableProcessors();
+
+// Method that pins the calling thread to the processors that the threads of "runInParallel" with up to
+// "numberOfThreads" threads are not pinned to, so that a background thread does not run on the processors of a
+// measurement. It returns "false" if pinning is disabled or not supported or if there are no such processors.
+bool pinCurrentThreadToSpareProcessors(size_t numberOfThreads);
+
+// Method that executes "task(threadIndex)" for all thread indexes 0, ..., numberOfThreads - 1 concurrently and waits
+// until all tasks are completed. The calling thread executes the task with thread index 0 itself so that no thread is
+// created if "numberOfThreads" is 1. If tasks throw exceptions, the first one is rethrown after all tasks are joined.
+void runInParallel(size_t numberOfThreads, const std::function<void(size_t threadIndex)>& task);
+
+// Method that splits the index range [0, numberOfElements) into "numberOfParts" consecutive parts whose sizes differ
+// by at most one and returns the first index of the part with number "part". For part == numberOfParts, it returns
+// "numberOfElements".
+size_t getPartBegin(size_t numberOfElements, size_t numberOfParts, size_t part);
+
+#endif // PARALLELEXECUTION_H
@@ -0,0 +1,166 @@
+
+#include <array>
+#include <cstdint>
+#include <cstring>      // std::memset
+#include <string>
+#if defined(__linux__)
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+#include "PerformanceCounters.h"
+
+//++++++++++++++
+// Local methods
+//++++++++++++++
+
+#if defined(__linux__)
+// Method that opens the performance counter "counter" for the calling thread and the threads that it creates. The
+// counter is stopped. The method returns -1 if the counter is not available.
+static int openPerformanceCounter(PerformanceCounter counter)
+{
+  perf_event_attr attributes;
+  std::memset(&attributes, 0, sizeof(attributes));
+  attributes.size = sizeof(attributes);
+
+  // Cache events are encoded as cache | (operation << 8) | (result << 16).
+  auto getCacheEvent = [](std::uint64_t cache) {
+    return cache | (std::uint64_t(PERF_COUNT_HW_CACHE_OP_READ) << 8) |
+           (std::uint64_t(PERF_COUNT_HW_CACHE_RESULT_MISS) << 16);
+  };
+  switch (counter)
+  {
+    case PerformanceCounter::CYCLES :
+      attributes.type = PERF_TYPE_HARDWARE;
+      attributes.config = PERF_COUNT_HW_CPU_CYCLES;
+      break;
+    case PerformanceCounter::INSTRUCTIONS :
+      attributes.type = PERF_TYPE_HARDWARE;
+      attributes.config = PERF_COUNT_HW_INSTRUCTIONS;
+      break;
+    case PerformanceCounter::BRANCH_MISSES :
+      attributes.type = PERF_TYPE_HARDWARE;
+      attributes.config = PERF_COUNT_HW_BRANCH_MISSES;
+      break;
+    case PerformanceCounter::L1_DATA_CACHE_MISSES :
+      attributes.type = PERF_TYPE_HW_CACHE;
+      attributes.config = getCacheEvent(PERF_COUNT_HW_CACHE_L1D);
+      break;
+    case PerformanceCounter::LAST_LEVEL_CACHE_MISSES :
+      attributes.type = PERF_TYPE_HW_CACHE;
+      attributes.config = getCacheEvent(PERF_COUNT_HW_CACHE_LL);
+      break;
+    case PerformanceCounter::DATA_TLB_MISSES :
+      attributes.type = PERF_TYPE_HW_CACHE;
+      attributes.config = getCacheEvent(PERF_COUNT_HW_CACHE_DTLB);
+      break;
+  }
+  attributes.disabled = 1;
+  attributes.inherit = 1;
+  attributes.exclude_kernel = 1;
+  attributes.exclude_hv = 1;
+  attributes.read_format = PERF_FORMAT_TOTAL_TIME_ENABLED | PERF_FORMAT_TOTAL_TIME_RUNNING;
+
+  return int(syscall(SYS_perf_event_open, &attributes, 0, -1, -1, 0));
+}
+#endif
+
+//+++++++++++++++++++++
+// Performance counters
+//+++++++++++++++++++++
+
+// Method that converts a performance counter into a string
+std::string convertToString(PerformanceCounter counter)
+{
+  switch (counter)
+  {
+    case PerformanceCounter::CYCLES                  : return "cycles";
+    case PerformanceCounter::INSTRUCTIONS            : return "instructions";
+    case PerformanceCounter::BRANCH_MISSES           : return "branch misses";
+    case PerformanceCounter::L1_DATA_CACHE_MISSES    : return "L1 data cache misses";
+    case PerformanceCounter::LAST_LEVEL_CACHE_MISSES : return "last level cache misses";
+    case PerformanceCounter::DATA_TLB_MISSES         : return "data TLB misses";
+  }
+
+  return std::string();
+}
+
+// Constructor that opens all performance counters that are available.
+PerformanceCounters::PerformanceCounters()
+{
+  fileDescriptors.fill(-1);
+#if defined(__linux__)
+  for (size_t i = 0; i < NUMBER_OF_PERFORMANCE_COUNTERS; ++i)
+    fileDescriptors[i] = openPerformanceCounter(PerformanceCounter(i));
+#endif
+}
+
+// Destructor that closes the performance counters.
+PerformanceCounters::~PerformanceCounters()
+{
+#if defined(__linux__)
+  for (int fileDescriptor : fileDescriptors)
+    if (fileDescriptor >= 0)
+      close(fileDescriptor);
+#endif
+}
+
+// Method that checks whether at least one performance counter is available.
+bool PerformanceCounters::isAvailable() const
+{
+  for (int fileDescriptor : fileDescriptors)
+    if (fileDescriptor >= 0)
+      return true;
+
+  return false;
+}
+
+// Method that resets and starts all available performance counters.
+void PerformanceCounters::start()
+{
+#if defined(__linux__)
+  for (int fileDescriptor : fileDescriptors)
+    if (fileDescriptor >= 0)
+    {
+      ioctl(fileDescriptor, PERF_EVENT_IOC_RESET, 0);
+      ioctl(fileDescriptor, PERF_EVENT_IOC_ENABLE, 0);
+    }
+#endif
+}
+
+// Method that stops all available performance counters.
+void PerformanceCounters::stop()
+{
+#if defined(__linux__)
+  for (int fileDescriptor : fileDescriptors)
+    if (fileDescriptor >= 0)
+      ioctl(fileDescriptor, PERF_EVENT_IOC_DISABLE, 0);
+#endif
+}
+
+// Method that returns the values counted between the last start and stop. A counter that the kernel multiplexed with
+// other counters only counted while it was running; its value is scaled by the ratio of the time it was enabled to
+// the time it was running. A counter that never ran is marked as not available.
+PerformanceCounterValues PerformanceCounters::getValues() const
+{
+  PerformanceCounterValues counterValues;
+
+#if defined(__linux__)
+  for (size_t i = 0; i < NUMBER_OF_PERFORMANCE_COUNTERS; ++i)
+  {
+    // Value, time enabled, and time running (see "read_format" above).
+    std::uint64_t data[3];
+    if (fileDescriptors[i] < 0 || read(fileDescriptors[i], data, sizeof(data)) != ssize_t(sizeof(data)) ||
+        data[2] == 0)
+      continue;
+
+    counterValues.isAvailable[i] = true;
+    counterValues.values[i] = double(data[0]);
+    if (data[2] < data[1])
+      counterValues.values[i] *= double(data[1]) / double(data[2]);
+  }
+#endif
+
+  return counterValues;
+}
@@ -0,0 +1,68 @@
+#ifndef PERFORMANCECOUNTERS_H
+#define PERFORMANCECOUNTERS_H
+
+
+#include <array>
+#include <cstddef>
+#include <string>
+
+// Performance counters count hardware events of the processor, such as cycles, instructions, and cache misses, while
+// the convex hull algorithms run. They explain why an algorithm is faster than another one (e.g., fewer cache misses)
+// where the runtimes only show that it is faster. The counters are read with the Linux system call
+// "perf_event_open" for the calling thread and all threads that it creates (e.g., by "runInParallel"); only events
+// in user space are counted. Each counter is opened separately, so that a counter that the processor or the kernel
+// does not support does not affect the other ones. If the processor has fewer counter registers than counters, the
+// kernel multiplexes them and the counted values are scaled to the whole measured interval.
+//
+// If the counters are not available (e.g., on other operating systems, in virtual machines without a virtual PMU, in
+// restricted containers, or if "/proc/sys/kernel/perf_event_paranoid" forbids them), the counters quietly measure
+// nothing and all values are marked as not available.
+
+// Type that indicates a performance counter.
+enum class PerformanceCounter {CYCLES, INSTRUCTIONS, BRANCH_MISSES, L1_DATA_CACHE_MISSES, LAST_LEVEL_CACHE_MISSES,
+                               DATA_TLB_MISSES};
+
+constexpr size_t NUMBER_OF_PERFORMANCE_COUNTERS = 6;
+
+// Method that converts a performance counter into a string
+std::string convertToString(PerformanceCounter counter);
+
+// Type that keeps the values of the performance counters for a measured interval.
+struct PerformanceCounterValues
+{
+  // Flags that indicate whether a counter has counted during the interval.
+  std::array<bool, NUMBER_OF_PERFORMANCE_COUNTERS> isAvailable {};
+  // Counted (and possibly scaled) values, indexed by the performance counters.
+  std::array<double, NUMBER_OF_PERFORMANCE_COUNTERS> values {};
+};
+
+class PerformanceCounters
+{
+  public:
+    // Constructor that opens all performance counters that are available. The counters are stopped.
+    PerformanceCounters();
+
+    // Destructor that closes the performance counters.
+    ~PerformanceCounters();
+
+    PerformanceCounters(const PerformanceCounters&) = delete;
+    PerformanceCounters& operator = (const PerformanceCounters&) = delete;
+
+    // Method that checks whether at least one performance counter is available.
+    bool isAvailable() const;
+
+    // Method that resets and starts all available performance counters.
+    void start();
+
+    // Method that stops all available performance counters.
+    void stop();
+
+    // Method that returns the values counted between the last start and stop.
+    PerformanceCounterValues getValues() const;
+
+  private:
+    // File descriptors of the performance counters (-1 if a counter is not available).
+    std::array<int, NUMBER_OF_PERFORMANCE_COUNTERS> fileDescriptors;
+};
+
+#endif // PERFORMANCECOUNTERS_H
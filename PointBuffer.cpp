@@ -0,0 +1,280 @@
+
+#include <algorithm>
+#include <cstdint>
+#include <fstream>
+#include <iostream>
+#include <mutex>
+#include <sstream>
+#include <string>
+#include <vector>
+#if defined(__unix__) || defined(__APPLE__)
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
+#if defined(__linux__)
+#include <sys/syscall.h>
+#endif
+#include "ParallelExecution.h"
+#include "PointBuffer.h"
+
+//+++++++++++++++++++++++
+// Local data and methods
+//+++++++++++++++++++++++
+
+// Type that keeps a mapped point buffer.
+struct MappedPointBuffer
+{
+  void* buffer;
+  size_t numberOfBytes;
+  size_t mappedSize;
+};
+
+// Size of a huge page and the alignment of the mapped buffers.
+constexpr size_t HUGE_PAGE_SIZE = size_t(1) << 21;
+
+// Memory policy "interleave" of the system call "mbind" (see "linux/mempolicy.h").
+constexpr int MEMORY_POLICY_INTERLEAVE = 3;
+
+// Parameters, hooks, and the mapped buffers. The mapped buffers are few and large, so a list suffices.
+static std::mutex pointBufferMutex;
+static PointBufferParameters pointBufferParameters;
+static MappedPointBufferHook mappedPointBufferMapHook = nullptr;
+static MappedPointBufferHook mappedPointBufferUnmapHook = nullptr;
+static std::vector<MappedPointBuffer> mappedPointBuffers;
+
+// Method that returns the numbers of the online NUMA nodes as a bit mask (at most 64 nodes); 1 if they are unknown.
+static std::uint64_t getNodeMask()
+{
+  std::ifstream file("/sys/devices/system/node/online");
+  std::string ranges, range;
+  std::uint64_t nodeMask = 0;
+
+  // The file lists ranges of node numbers, e.g., "0-3,5".
+  if (std::getline(file, ranges))
+  {
+    std::istringstream stream(ranges);
+    while (std::getline(stream, range, ','))
+    {
+      size_t first = 0, last = 0, dash = range.find('-');
+      try
+      {
+        first = last = std::stoul(range);
+        if (dash != std::string::npos)
+          last = std::stoul(range.substr(dash + 1));
+      }
+      catch (...)
+      {
+        return 1;
+      }
+      for (size_t node = first; node <= last && node < 64; ++node)
+        nodeMask |= std::uint64_t(1) << node;
+    }
+  }
+
+  return (nodeMask == 0) ? 1 : nodeMask;
+}
+
+// Method that maps "size" bytes aligned to a huge page; "size" is a multiple of the huge page size. The method returns
+// nullptr if the memory cannot be mapped.
+static void* mapAlignedMemory(size_t size)
+{
+  #if defined(__unix__) || defined(__APPLE__)
+  // Map one huge page more than needed and unmap the unaligned beginning and the rest of the end.
+  void* memory = mmap(nullptr, size + HUGE_PAGE_SIZE, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+  if (memory == MAP_FAILED)
+    return nullptr;
+
+  char* begin = static_cast<char*>(memory);
+  char* alignedBegin = begin + (HUGE_PAGE_SIZE - reinterpret_cast<std::uintptr_t>(begin) % HUGE_PAGE_SIZE) %
+                               HUGE_PAGE_SIZE;
+  if (alignedBegin > begin)
+    munmap(begin, size_t(alignedBegin - begin));
+  if (begin + size + HUGE_PAGE_SIZE > alignedBegin + size)
+    munmap(alignedBegin + size, size_t(begin + size + HUGE_PAGE_SIZE - (alignedBegin + size)));
+  return alignedBegin;
+  #else
+  (void) size;
+  return nullptr;
+  #endif
+}
+
+// Method that maps "size" bytes from the reserved huge pages; "size" is a multiple of the huge page size. The method
+// returns nullptr if there are not enough huge pages or the system does not support them.
+static void* mapExplicitHugePages(size_t size)
+{
+  #if defined(MAP_HUGETLB)
+  void* memory = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB, -1, 0);
+  return (memory == MAP_FAILED) ? nullptr : memory;
+  #else
+  (void) size;
+  return nullptr;
+  #endif
+}
+
+// Method that writes one byte of each page of the "size" bytes starting at "memory" in parallel, so that each thread
+// faults in the pages of its part.
+static void touchPagesInParallel(void* memory, size_t size)
+{
+  #if defined(__unix__) || defined(__APPLE__)
+  size_t pageSize = size_t(sysconf(_SC_PAGESIZE));
+  #else
+  size_t pageSize = 4096;
+  #endif
+  size_t numberOfPages = size / pageSize;
+  size_t numberOfThreads = std::min(resolveNumberOfThreads(0), std::max<size_t>(numberOfPages, 1));
+
+  runInParallel(numberOfThreads, [&](size_t threadIndex)
+  {
+    volatile char* pages = static_cast<volatile char*>(memory);
+    size_t end = getPartBegin(numberOfPages, numberOfThreads, threadIndex + 1);
+    for (size_t page = getPartBegin(numberOfPages, numberOfThreads, threadIndex); page < end; ++page)
+      pages[page * pageSize] = 0;
+  });
+}
+
+//+++++++++++++
+// Point buffer
+//+++++++++++++
+
+// Method that converts a huge page mode into its name.
+std::string convertToString(HugePageMode hugePageMode)
+{
+  switch (hugePageMode)
+  {
+    case HugePageMode::NONE        : return "none";
+    case HugePageMode::TRANSPARENT : return "transparent";
+    case HugePageMode::EXPLICIT    : return "explicit";
+  }
+
+  return std::string();
+}
+
+// Method that converts a name into a huge page mode.
+bool convertToHugePageMode(const std::string& name, HugePageMode& hugePageMode)
+{
+  for (HugePageMode candidate : {HugePageMode::NONE, HugePageMode::TRANSPARENT, HugePageMode::EXPLICIT})
+    if (convertToString(candidate) == name)
+    {
+      hugePageMode = candidate;
+      return true;
+    }
+
+  return false;
+}
+
+// Method that converts a page placement into its name.
+std::string convertToString(PagePlacement pagePlacement)
+{
+  switch (pagePlacement)
+  {
+    case PagePlacement::FIRST_TOUCH : return "first-touch";
+    case PagePlacement::PARALLEL    : return "parallel";
+    case PagePlacement::INTERLEAVED : return "interleaved";
+  }
+
+  return std::string();
+}
+
+// Method that converts a name into a page placement.
+bool convertToPagePlacement(const std::string& name, PagePlacement& pagePlacement)
+{
+  for (PagePlacement candidate : {PagePlacement::FIRST_TOUCH, PagePlacement::PARALLEL, PagePlacement::INTERLEAVED})
+    if (convertToString(candidate) == name)
+    {
+      pagePlacement = candidate;
+      return true;
+    }
+
+  return false;
+}
+
+// Method that sets the parameters of the allocation of large point buffers.
+void setPointBufferParameters(const PointBufferParameters& parameters)
+{
+  std::lock_guard<std::mutex> lock(pointBufferMutex);
+  pointBufferParameters = parameters;
+}
+
+// Method that returns the parameters of the allocation of large point buffers.
+PointBufferParameters getPointBufferParameters()
+{
+  std::lock_guard<std::mutex> lock(pointBufferMutex);
+  return pointBufferParameters;
+}
+
+// Method that sets the methods that are called when a point buffer is mapped and unmapped.
+void setMappedPointBufferHooks(MappedPointBufferHook mapHook, MappedPointBufferHook unmapHook)
+{
+  std::lock_guard<std::mutex> lock(pointBufferMutex);
+  mappedPointBufferMapHook = mapHook;
+  mappedPointBufferUnmapHook = unmapHook;
+}
+
+// Method that maps a buffer of "numberOfBytes" bytes according to the parameters and returns it.
+void* mapPointBuffer(size_t numberOfBytes)
+{
+  PointBufferParameters parameters = getPointBufferParameters();
+  if (parameters.hugePageMode == HugePageMode::NONE && parameters.pagePlacement == PagePlacement::FIRST_TOUCH)
+    return nullptr;
+  if (numberOfBytes > size_t(-1) - 2 * HUGE_PAGE_SIZE)
+    return nullptr;
+
+  size_t mappedSize = (numberOfBytes + HUGE_PAGE_SIZE - 1) / HUGE_PAGE_SIZE * HUGE_PAGE_SIZE;
+  void* buffer = nullptr;
+  if (parameters.hugePageMode == HugePageMode::EXPLICIT)
+  {
+    buffer = mapExplicitHugePages(mappedSize);
+    static bool fallbackIsReported = false;
+    if (buffer == nullptr && !fallbackIsReported)
+    {
+      std::cout << "Explicit huge pages are not available; transparent huge pages are requested instead."
+                << std::endl;
+      fallbackIsReported = true;
+    }
+  }
+  if (buffer == nullptr)
+  {
+    buffer = mapAlignedMemory(mappedSize);
+    if (buffer == nullptr)
+      return nullptr;
+    #if defined(MADV_HUGEPAGE)
+    if (parameters.hugePageMode != HugePageMode::NONE)
+      madvise(buffer, mappedSize, MADV_HUGEPAGE);
+    #endif
+  }
+
+  #if defined(__linux__)
+  if (parameters.pagePlacement == PagePlacement::INTERLEAVED)
+  {
+    std::uint64_t nodeMask = getNodeMask();
+    syscall(SYS_mbind, buffer, mappedSize, MEMORY_POLICY_INTERLEAVE, &nodeMask, 64, 0);
+  }
+  #endif
+  if (parameters.pagePlacement != PagePlacement::FIRST_TOUCH)
+    touchPagesInParallel(buffer, mappedSize);
+
+  std::lock_guard<std::mutex> lock(pointBufferMutex);
+  mappedPointBuffers.push_back({buffer, numberOfBytes, mappedSize});
+  if (mappedPointBufferMapHook != nullptr)
+    mappedPointBufferMapHook(numberOfBytes);
+  return buffer;
+}
+
+// Method that unmaps the buffer "buffer" if it was mapped by "mapPointBuffer".
+bool unmapPointBuffer(void* buffer)
+{
+  std::lock_guard<std::mutex> lock(pointBufferMutex);
+  std::vector<MappedPointBuffer>::iterator it =
+    std::find_if(mappedPointBuffers.begin(), mappedPointBuffers.end(),
+                 [&](const MappedPointBuffer& mappedBuffer) { return mappedBuffer.buffer == buffer; });
+  if (it == mappedPointBuffers.end())
+    return false;
+
+  if (mappedPointBufferUnmapHook != nullptr)
+    mappedPointBufferUnmapHook(it->numberOfBytes);
+  #if defined(__unix__) || defined(__APPLE__)
+  munmap(it->buffer, it->mappedSize);
+  #endif
+  mappedPointBuffers.erase(it);
+  return true;
+}
@@ -0,0 +1,124 @@
+#ifndef POINTBUFFER_H
+#define POINTBUFFER_H
+
+
+#include <cstddef>
+#include <memory>
+#include <string>
+#include <vector>
+
+// Point buffers are the vectors that keep the inputs of the convex hull algorithms in the performance tests (see
+// "PointBufferOf" in "ConvexHullQuickHull.h"). Their allocator places large buffers, such as the input of 100000000
+// points, so that the random accesses of the partitions cause fewer TLB misses and the pages are spread over the
+// memory of the NUMA nodes:
+// - Huge pages: TRANSPARENT maps the buffer aligned to 2 MiB and advises the kernel to back it with transparent huge
+//   pages (madvise MADV_HUGEPAGE); EXPLICIT maps it from the reserved huge pages (mmap MAP_HUGETLB, see
+//   "/proc/sys/vm/nr_hugepages") and falls back to TRANSPARENT if there are not enough of them.
+// - Page placement: FIRST_TOUCH leaves the placement to the thread that writes a page first (usually the thread that
+//   fills the buffer); PARALLEL writes the pages of the buffer once by the threads of "runInParallel" (see
+//   "ParallelExecution.h"), so that each thread's part of the buffer is placed on its NUMA node; INTERLEAVED spreads
+//   the pages round robin over all NUMA nodes (mbind MPOL_INTERLEAVE) before they are written in parallel.
+//
+// The point buffers are allocated by the performance tests outside of the time measurement, so that the mapping and
+// the placement, which writes all pages, are not measured. The point sequences of the interfaces (see "PointSequence"
+// in "PointHandler.h"), the results, and the memory that the algorithms allocate themselves use the standard
+// allocator; the algorithms accept point sequences with either allocator. With the default parameters (NONE and
+// FIRST_TOUCH), and for all buffers smaller than 2 MiB, the allocator of the point buffers is the standard allocator.
+// Huge pages and the placement are only supported on Linux; elsewhere, large buffers are mapped with the default page
+// size. Mapped buffers bypass the heap; hooks report their sizes instead, so that the heap metrics count them like
+// allocations (see "MemoryAccounting.h"). The effect on the TLB misses is shown by the performance counters (see
+// "PerformanceCounters.h").
+
+// Type that indicates which huge pages back large point buffers.
+enum class HugePageMode {NONE, TRANSPARENT, EXPLICIT};
+
+// Type that indicates how the pages of large point buffers are placed on the NUMA nodes.
+enum class PagePlacement {FIRST_TOUCH, PARALLEL, INTERLEAVED};
+
+// Type that keeps the parameters of the allocation of large point buffers.
+struct PointBufferParameters
+{
+  HugePageMode hugePageMode = HugePageMode::NONE;
+  PagePlacement pagePlacement = PagePlacement::FIRST_TOUCH;
+};
+
+// Minimal size of a point buffer in bytes that is mapped according to the parameters (the size of a huge page).
+constexpr size_t MINIMAL_SIZE_OF_MAPPED_POINT_BUFFER = size_t(1) << 21;
+
+// Methods that convert a huge page mode and a page placement into their names and names into them. The latter methods
+// return "false" if the name is unknown.
+std::string convertToString(HugePageMode hugePageMode);
+bool convertToHugePageMode(const std::string& name, HugePageMode& hugePageMode);
+std::string convertToString(PagePlacement pagePlacement);
+bool convertToPagePlacement(const std::string& name, PagePlacement& pagePlacement);
+
+// Methods that set and return the parameters of the allocation of large point buffers. The parameters apply to the
+// buffers allocated afterwards; buffers allocated before are freed correctly nevertheless.
+void setPointBufferParameters(const PointBufferParameters& parameters);
+PointBufferParameters getPointBufferParameters();
+
+// Type of the methods that are called with the number of bytes of a point buffer after it is mapped and before it is
+// unmapped.
+using MappedPointBufferHook = void (*)(size_t numberOfBytes);
+
+// Method that sets the methods that are called when a point buffer is mapped and unmapped (nullptr calls none).
+void setMappedPointBufferHooks(MappedPointBufferHook mapHook, MappedPointBufferHook unmapHook);
+
+// Method that maps a buffer of "numberOfBytes" bytes according to the parameters and returns it. It returns nullptr
+// if the parameters are the default ones or the buffer cannot be mapped, so that the caller allocates it otherwise.
+void* mapPointBuffer(size_t numberOfBytes);
+
+// Method that unmaps the buffer "buffer" if it was mapped by "mapPointBuffer". It returns "false" otherwise.
+bool unmapPointBuffer(void* buffer);
+
+//++++++++++++++++++++++++++++++++++++
+// Class template PointBufferAllocator
+//++++++++++++++++++++++++++++++++++++
+
+// Allocator of point buffers. It is stateless; all its objects are equal.
+template <typename T>
+class PointBufferAllocator
+{
+  public:
+    using value_type = T;
+
+    PointBufferAllocator() noexcept = default;
+
+    template <typename U>
+    PointBufferAllocator(const PointBufferAllocator<U>&) noexcept {}
+
+    // Method that allocates memory for "numberOfElements" elements; large buffers are mapped (see above).
+    T* allocate(size_t numberOfElements)
+    {
+      if (numberOfElements >= MINIMAL_SIZE_OF_MAPPED_POINT_BUFFER / sizeof(T))
+        if (void* buffer = mapPointBuffer(numberOfElements * sizeof(T)))
+          return static_cast<T*>(buffer);
+
+      return std::allocator<T>().allocate(numberOfElements);
+    }
+
+    // Method that frees the memory "elements" of "numberOfElements" elements.
+    void deallocate(T* elements, size_t numberOfElements)
+    {
+      if (numberOfElements < MINIMAL_SIZE_OF_MAPPED_POINT_BUFFER / sizeof(T) || !unmapPointBuffer(elements))
+        std::allocator<T>().deallocate(elements, numberOfElements);
+    }
+};
+
+template <typename T, typename U>
+bool operator == (const PointBufferAllocator<T>&, const PointBufferAllocator<U>&)
+{
+  return true;
+}
+
+template <typename T, typename U>
+bool operator != (const PointBufferAllocator<T>&, const PointBufferAllocator<U>&)
+{
+  return false;
+}
+
+// Type of a point buffer with elements of the type "T".
+template <typename T>
+using PointBuffer = std::vector<T, PointBufferAllocator<T>>;
+
+#endif // POINTBUFFER_H
@@ -0,0 +1,168 @@
+
+#include <utility>
+#include <vector>
+#include "ParallelExecution.h"
+#include "PointGenerationPipeline.h"
+
+//+++++++++++++++++++++++++
+// Point generation request
+//+++++++++++++++++++++++++
+
+// Method that checks whether two requests describe the same point sequence.
+bool PointGenerationRequest::operator == (const PointGenerationRequest& rhs) const
+{
+  return numberOfPoints == rhs.numberOfPoints && distribution == rhs.distribution && seed == rhs.seed;
+}
+
+//++++++++++++++++++++++++++
+// Point generation pipeline
+//++++++++++++++++++++++++++
+
+// Constructor that creates a pipeline.
+PointGenerationPipeline::PointGenerationPipeline(bool isPipelined, size_t maximalNumberOfPoints,
+                                                 const std::vector<PointDistribution>& distributions,
+                                                 size_t numberOfMeasuredThreads)
+  : maximalNumberOfPoints(maximalNumberOfPoints)
+{
+  if (!isPipelined)
+    return;
+
+  generatedPointSeq.reserve(maximalNumberOfPoints);
+  for (PointDistribution distribution : distributions)
+    reservePointGenerationScratch(generationScratch, maximalNumberOfPoints, distribution);
+  generationScratch.pause = waitWhileGenerationIsPaused;
+  generationScratch.pauseContext = this;
+  backgroundThread = std::thread([this, numberOfMeasuredThreads]() { runBackgroundThread(numberOfMeasuredThreads); });
+}
+
+// Destructor that waits for the background thread to finish.
+PointGenerationPipeline::~PointGenerationPipeline()
+{
+  if (!backgroundThread.joinable())
+    return;
+
+  {
+    std::lock_guard<std::mutex> lock(mutex);
+    isStopped = true;
+  }
+  condition.notify_all();
+  backgroundThread.join();
+}
+
+// Method that checks whether the point sequences are generated in the background.
+bool PointGenerationPipeline::isPipelined() const
+{
+  return backgroundThread.joinable();
+}
+
+// Method that requests the point sequence of "request" to be generated in the background.
+void PointGenerationPipeline::prefetch(const PointGenerationRequest& request)
+{
+  if (!isPipelined())
+    return;
+
+  {
+    std::lock_guard<std::mutex> lock(mutex);
+    if ((generationIsRunning && runningRequest == request) || (pointSequenceIsReady && readyRequest == request))
+      return;
+    pendingRequest = request;
+    requestIsPending = true;
+  }
+  condition.notify_all();
+}
+
+// Method that provides the point sequence of "request" in "pointSeq".
+void PointGenerationPipeline::generate(const PointGenerationRequest& request, PointSequence& pointSeq)
+{
+  if (isPipelined())
+  {
+    // The point sequence handed to the background thread must not be reallocated there.
+    pointSeq.reserve(maximalNumberOfPoints);
+
+    std::unique_lock<std::mutex> lock(mutex);
+    // A request that has not been started yet is generated here instead of waiting for the background thread.
+    if (requestIsPending && pendingRequest == request)
+      requestIsPending = false;
+    condition.wait(lock, [&]() { return !(generationIsRunning && runningRequest == request); });
+    if (pointSequenceIsReady && readyRequest == request)
+    {
+      pointSeq.swap(generatedPointSeq);
+      pointSequenceIsReady = false;
+      lock.unlock();
+      condition.notify_all();
+      return;
+    }
+  }
+
+  generatePointSequence(pointSeq, request.numberOfPoints, request.distribution, request.seed);
+}
+
+// Method that pauses the generation in the background.
+void PointGenerationPipeline::pause()
+{
+  if (!isPipelined())
+    return;
+
+  std::unique_lock<std::mutex> lock(mutex);
+  generationIsPaused = true;
+  condition.wait(lock, [&]() { return !generationIsRunning || generationIsWaiting; });
+}
+
+// Method that resumes the generation in the background.
+void PointGenerationPipeline::resume()
+{
+  if (!isPipelined())
+    return;
+
+  {
+    std::lock_guard<std::mutex> lock(mutex);
+    generationIsPaused = false;
+  }
+  condition.notify_all();
+}
+
+// Method that waits while the generation of the pipeline "pipeline" is paused.
+void PointGenerationPipeline::waitWhileGenerationIsPaused(void* pipeline)
+{
+  PointGenerationPipeline& self = *static_cast<PointGenerationPipeline*>(pipeline);
+  std::unique_lock<std::mutex> lock(self.mutex);
+  if (!self.generationIsPaused)
+    return;
+
+  self.generationIsWaiting = true;
+  self.condition.notify_all();
+  // A generation that is stopped by the destructor is completed without pausing.
+  self.condition.wait(lock, [&]() { return self.isStopped || !self.generationIsPaused; });
+  self.generationIsWaiting = false;
+}
+
+// Method that generates the requested point sequences until the pipeline is destroyed.
+void PointGenerationPipeline::runBackgroundThread(size_t numberOfMeasuredThreads)
+{
+  pinCurrentThreadToSpareProcessors(numberOfMeasuredThreads);
+
+  std::unique_lock<std::mutex> lock(mutex);
+  while (true)
+  {
+    // No generation is started while the generation is paused.
+    condition.wait(lock, [&]() { return isStopped || (requestIsPending && !generationIsPaused); });
+    if (isStopped)
+      return;
+
+    runningRequest = pendingRequest;
+    requestIsPending = false;
+    generationIsRunning = true;
+    // A point sequence that is ready but was not taken is overwritten.
+    pointSequenceIsReady = false;
+    lock.unlock();
+
+    generatePointSequence(generatedPointSeq, runningRequest.numberOfPoints, runningRequest.distribution,
+                          runningRequest.seed, &generationScratch);
+
+    lock.lock();
+    generationIsRunning = false;
+    readyRequest = runningRequest;
+    pointSequenceIsReady = true;
+    condition.notify_all();
+  }
+}
@@ -0,0 +1,100 @@
+#ifndef POINTGENERATIONPIPELINE_H
+#define POINTGENERATIONPIPELINE_H
+
+
+#include <condition_variable>
+#include <cstdint>
+#include <mutex>
+#include <thread>
+#include <vector>
+#include "PointHandler.h"
+
+// The point generation pipeline generates the point sequence of the next run of the performance test in a background
+// thread between the measured runs, so that the generation of the points, which takes longer than the runs of the
+// algorithms, is mostly hidden behind the copying of the points and the preparation of the caches instead of being
+// added to the wall-clock time of the test. The generated points are the same as without the pipeline, since they
+// only depend on the number of points, the distribution, and the seed.
+//
+// The generation is paused while a run is measured (see "pause" and "resume"): the generators stop after the chunk of
+// points that they are generating (see "POINT_GENERATION_CHUNK_SIZE" in "PointHandler.h"), and "pause" waits for
+// that, so that the background thread neither competes with the measured threads for the memory bandwidth and the
+// last level cache nor evicts the points of the run from the caches. It is pinned to the processors that the
+// measured threads are not pinned to (see "pinCurrentThreadToSpareProcessors" in "ParallelExecution.h").
+//
+// The background thread keeps its own point sequence, which is swapped with the point sequence of the test when it
+// is taken, so that the test needs twice the memory of the largest point sequence. Its point sequence and the scratch
+// of the generators are reserved by the calling thread in advance, so that the background thread allocates no memory;
+// otherwise, its allocations would be counted for the algorithm (see "MemoryAccounting.h"). If the next run was not
+// predicted correctly (e.g., adaptive sampling stopped earlier), the points are generated by the calling thread as
+// without the pipeline.
+
+// Type that keeps the parameters of a generated point sequence.
+struct PointGenerationRequest
+{
+  size_t numberOfPoints = 0;
+  PointDistribution distribution = PointDistribution::UNIFORM;
+  std::uint64_t seed = 0;
+
+  bool operator == (const PointGenerationRequest& rhs) const;
+};
+
+class PointGenerationPipeline
+{
+  public:
+    // Constructor that creates a pipeline. If "isPipelined" is "false", no background thread is started and all point
+    // sequences are generated by the calling thread. Otherwise, the point sequences and the scratch of the generators
+    // are reserved for "maximalNumberOfPoints" points with the distributions "distributions" by the calling thread,
+    // so that the background thread never allocates memory, and the background thread does not use the processors of
+    // "numberOfMeasuredThreads" threads.
+    PointGenerationPipeline(bool isPipelined, size_t maximalNumberOfPoints,
+                            const std::vector<PointDistribution>& distributions, size_t numberOfMeasuredThreads);
+
+    // Destructor that waits for the background thread to finish.
+    ~PointGenerationPipeline();
+
+    PointGenerationPipeline(const PointGenerationPipeline&) = delete;
+    PointGenerationPipeline& operator = (const PointGenerationPipeline&) = delete;
+
+    // Method that checks whether the point sequences are generated in the background.
+    bool isPipelined() const;
+
+    // Method that requests the point sequence of "request" to be generated in the background. A request that has not
+    // been started yet is replaced. Without a background thread, the method does nothing.
+    void prefetch(const PointGenerationRequest& request);
+
+    // Method that provides the point sequence of "request" in "pointSeq". If it was prefetched, the method waits for
+    // its generation and takes it; otherwise, it generates it itself.
+    void generate(const PointGenerationRequest& request, PointSequence& pointSeq);
+
+    // Method that pauses the generation in the background. It waits until the background thread has stopped after the
+    // chunk of points that it is generating, so that the background thread is idle when the method returns. Without a
+    // background thread, the method does nothing.
+    void pause();
+
+    // Method that resumes the generation in the background that was paused by "pause".
+    void resume();
+
+  private:
+    // Method that generates the requested point sequences until the pipeline is destroyed.
+    void runBackgroundThread(size_t numberOfMeasuredThreads);
+
+    // Method that is called by the generators in the background thread between two chunks of points (see "pause" in
+    // "PointGenerationScratch") and waits while the generation of the pipeline "pipeline" is paused.
+    static void waitWhileGenerationIsPaused(void* pipeline);
+
+    std::mutex mutex;
+    std::condition_variable condition;
+    // Requested point sequence that has not been started yet, the point sequence that is being generated, and the
+    // point sequence that is ready in "generatedPointSeq".
+    bool requestIsPending = false, generationIsRunning = false, pointSequenceIsReady = false;
+    // Flags that indicate whether the generation is paused and whether the background thread waits because of it.
+    bool generationIsPaused = false, generationIsWaiting = false;
+    PointGenerationRequest pendingRequest, runningRequest, readyRequest;
+    PointSequence generatedPointSeq;
+    PointGenerationScratch generationScratch;
+    size_t maximalNumberOfPoints;
+    bool isStopped = false;
+    std::thread backgroundThread;
+};
+
+#endif // POINTGENERATIONPIPELINE_H
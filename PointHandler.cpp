@@ -1,13 +1,27 @@
 
 #include <algorithm>    // std::sort
+#include <cmath>        // std::sqrt
+#include <cstdint>
 #include <iomanip>
 #include <iostream>
 #include <ostream>
 #include <random>
 #include <string>    // to be deleted later
+#include <type_traits>
 #include <vector>
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#elif defined(__aarch64__) && defined(__ARM_NEON)
+#include <arm_neon.h>
+#endif
+#include "FixedPoint.h"
 #include "Number.h"
+#include "OrientationPredicates.h"
+#include "ParallelExecution.h"
+#include "PointBuffer.h"
 #include "PointHandler.h"
+#include "PointSequenceDuplicates.h"
+#include "TraceRecorder.h"
 
 //
 // Constructors and destructor
@@ -123,22 +137,64 @@ CompareDistance compareDistance(const Point& p, const Point& q, const Point& r)
     return CompareDistance::EQUALDISTANCE;
 }
 
+// Ranges of the integer parts of the coordinates of uniformly distributed points and of the radii of points in the
+// shape of a circle relative to the number of points.
+static const size_t UNIFORM_RANGE_MULTIPLIER = 10;
+static const size_t CIRCLE_RANGE_MULTIPLIER = 100;
+
+// Method that calls the function "pause" of the scratch "scratch" (if any) before the first point and after every
+// chunk of "POINT_GENERATION_CHUNK_SIZE" generated points, whose number is "numberOfGeneratedPoints".
+static inline void pauseGenerationAfterChunk(PointGenerationScratch* scratch, size_t numberOfGeneratedPoints)
+{
+  if (scratch != nullptr && scratch->pause != nullptr && numberOfGeneratedPoints % POINT_GENERATION_CHUNK_SIZE == 0)
+    scratch->pause(scratch->pauseContext);
+}
+
+// Method that resizes the flags "visited" to "numberOfFlags" flags that are "false". With a function "pause" of the
+// scratch "scratch", the flags are cleared in chunks and the function is called before each chunk, since clearing
+// them takes as long as generating many points.
+static void clearVisitedFlags(std::vector<bool>& visited, size_t numberOfFlags, PointGenerationScratch* scratch)
+{
+  if (scratch == nullptr || scratch->pause == nullptr)
+  {
+    visited.assign(numberOfFlags, false);
+    return;
+  }
+
+  const size_t chunkSize = 64 * POINT_GENERATION_CHUNK_SIZE;
+  visited.clear();
+  for (size_t i = 0; i < numberOfFlags; i += chunkSize)
+  {
+    scratch->pause(scratch->pauseContext);
+    visited.resize(std::min(numberOfFlags, i + chunkSize), false);
+  }
+}
+
 // Method that randomly generates "numberOfPoints" points without duplicates and stores them as a point sequence. 
 void generateRandomPoints(PointSequence& pointSeq, size_t numberOfPoints)
+{
+  generateRandomPoints(pointSeq, numberOfPoints, std::random_device{}());
+}
+
+// Method that randomly generates "numberOfPoints" points without duplicates from the seed "seed" and stores them as a
+// point sequence.
+void generateRandomPoints(PointSequence& pointSeq, size_t numberOfPoints, std::uint64_t seed,
+                          PointGenerationScratch* scratch)
 {
   constexpr size_t NoOfDecimalPlacesMultiplier = 100; // Implies two decimal places.
-  constexpr size_t RangeMultiplier = 10;
+  constexpr size_t RangeMultiplier = UNIFORM_RANGE_MULTIPLIER;
   size_t upperBound = numberOfPoints * RangeMultiplier,
          generatedIntegerForXCoord, generatedIntegerForYCoord;
-  std::vector<bool> visited(upperBound + 1, false); // Stores whether integer number has already been generated.
+  PointGenerationScratch ownScratch;
+  // Stores whether integer number has already been generated.
+  std::vector<bool>& visited = ((scratch != nullptr) ? *scratch : ownScratch).visited;
+  clearVisitedFlags(visited, upperBound + 1, scratch);
 
   // Clear point sequence
   pointSeq.clear();
 
-  // Seed generator
-  std::random_device rd;
-  // Generator initialized with seed from rd
-  std::mt19937_64 generator{rd()};
+  // Generator initialized with seed "seed"
+  std::mt19937_64 generator{seed};
   // Create distribution
   std::uniform_int_distribution<size_t> integerNumber(0, upperBound - 1);
   std::uniform_int_distribution<size_t> decimalPlaces(0, 99);
@@ -148,6 +204,7 @@ void generateRandomPoints(PointSequence& pointSeq, size_t numberOfPoints)
   Point randomPoint;
   for(size_t i = 0 ; i < numberOfPoints ; i++ ) 
   {
+    pauseGenerationAfterChunk(scratch, i);
     // Generate two random numbers for the x-coordinate and the y-coordinate of the point "randomPoint".
     generatedIntegerForXCoord = integerNumber(generator);
     generatedIntegerForYCoord = integerNumber(generator);
@@ -180,25 +237,32 @@ void generateRandomPoints(PointSequence& pointSeq, size_t numberOfPoints)
 // Method that randomly generates "numberOfPoints" points without duplicates and stores them as a point sequence. 
 // The points are randomly planced in a shape of a Circle. 
 void generateCircledPointSequence(PointSequence& points, size_t numberOfPoints)
+{
+  generateCircledPointSequence(points, numberOfPoints, std::random_device{}());
+}
+
+// Method that randomly generates "numberOfPoints" points without duplicates in a shape of a Circle from the seed
+// "seed" and stores them as a point sequence.
+void generateCircledPointSequence(PointSequence& points, size_t numberOfPoints, std::uint64_t seed,
+                                  PointGenerationScratch* scratch)
 {
   const double PI = 3.14159265;
 
   constexpr size_t NoOfDecimalPlacesMultiplier = 100; // Implies two decimal places.
-  constexpr size_t RangeMultiplier = 100;
+  constexpr size_t RangeMultiplier = CIRCLE_RANGE_MULTIPLIER;
   size_t upperBound = numberOfPoints * RangeMultiplier,
          generatedIntegerForRadius;
-  std::vector<bool> visited(upperBound + 1, false);
+  PointGenerationScratch ownScratch;
+  std::vector<bool>& visited = ((scratch != nullptr) ? *scratch : ownScratch).visited;
+  clearVisitedFlags(visited, upperBound + 1, scratch);
 
   std::uniform_int_distribution<size_t> integerNumber(0, upperBound / 2);
   std::uniform_int_distribution<size_t> decimalPlaces(0, 99);
 
   points.clear();
-  std::vector<Number> radius;
   int midX = upperBound/2, midY = upperBound/2;
-  // Seed generator
-  std::random_device rd;
-  // Generator initialized with seed from rd
-  std::mt19937_64 generator{rd()};
+  // Generator initialized with seed "seed"
+  std::mt19937_64 generator{seed};
 
   // it will determine the thickness of the circle by the radius of generated points. 
   // 
@@ -208,8 +272,6 @@ void generateCircledPointSequence(PointSequence& points, size_t numberOfPoints)
   // if we give 1, it will be like points interior circle. Calls it "Disk".
   const int circleThickness = 1; 
 
-  std::vector<Number> angles;
-
   // the way of Random number generate uing C++11
   std::uniform_real_distribution<Number> dist(0,360);
   // std::uniform_real_distribution<CoordinateType> radiuss(midX - midX/circleThickness, midX);
@@ -225,11 +287,13 @@ void generateCircledPointSequence(PointSequence& points, size_t numberOfPoints)
 
 
   std::mt19937 rngAngle, rngRadius;
-  rngAngle.seed(std::random_device{}());
+  rngAngle.seed(std::mt19937::result_type(generator()));
   // rngRadius.seed(std::random_device{}());
 
+  // Each point is computed as soon as its angle and radius are drawn, so that they need not be stored.
   for(int i = 0 ; i < (numberOfPoints); i ++)
   {
+    pauseGenerationAfterChunk(scratch, i);
     // angles.push_back(realRand());
     // radius.push_back(realRadius());
     // radius.push_back(distribution(generator));
@@ -240,21 +304,112 @@ void generateCircledPointSequence(PointSequence& points, size_t numberOfPoints)
     }
     visited[generatedIntegerForRadius] = true;
 
-    angles.push_back(dist(rngAngle));
-    radius.push_back(double(generatedIntegerForRadius) + double(decimalPlaces(generator)) / 100);
+    Number angle = dist(rngAngle);
+    Number radius = double(generatedIntegerForRadius) + double(decimalPlaces(generator)) / 100;
     // radius.push_back(radiuss(rngRadius));
-  }
 
-  for(int i = 0 ; i < angles.size(); i++)
-  {
     Point point;
 
-    point.x = (radius[i] * cos(angles.at(i) * (PI/180))) + midX; //convert degree to radian
-    point.y = (radius[i] * sin(angles.at(i) * (PI/180))) + midY;
+    point.x = (radius * cos(angle * (PI/180))) + midX; //convert degree to radian
+    point.y = (radius * sin(angle * (PI/180))) + midY;
     points.push_back(point);
   }
 }
 
+// Method that randomly generates "numberOfPoints" points with many duplicates and long collinear runs and stores them
+// as a point sequence. All points have integer coordinates on a coarse grid: a quarter of the points lie on the
+// boundary of the grid square (i.e., on the edges of the convex hull), a quarter lie on a few diagonal lines, and the
+// rest are spread over the grid. Additionally, every tenth point is an exact copy of an earlier point. This
+// distribution is used to stress the convex hull algorithms with degenerate inputs.
+void generateDegeneratePointSequence(PointSequence& pointSeq, size_t numberOfPoints)
+{
+  generateDegeneratePointSequence(pointSeq, numberOfPoints, std::random_device{}());
+}
+
+// Method that randomly generates "numberOfPoints" points with many duplicates and long collinear runs from the seed
+// "seed" and stores them as a point sequence.
+void generateDegeneratePointSequence(PointSequence& pointSeq, size_t numberOfPoints, std::uint64_t seed,
+                                     PointGenerationScratch* scratch)
+{
+  constexpr size_t NumberOfDiagonals = 4;
+  // The grid has about 16 points per grid position, so that duplicates are frequent also without explicit copies.
+  size_t gridSize = size_t(std::sqrt(double(numberOfPoints)) / 4) + 2;
+
+  // Clear point sequence
+  pointSeq.clear();
+  pointSeq.reserve(numberOfPoints);
+
+  // Generator initialized with seed "seed"
+  std::mt19937_64 generator{seed};
+  std::uniform_int_distribution<size_t> gridCoordinate(0, gridSize);
+  std::uniform_int_distribution<size_t> kind(0, 3);
+  std::uniform_int_distribution<size_t> side(0, 3);
+  std::uniform_int_distribution<size_t> diagonal(0, NumberOfDiagonals - 1);
+
+  for (size_t i = 0; i < numberOfPoints; ++i)
+  {
+    pauseGenerationAfterChunk(scratch, i);
+    // Every tenth point is a copy of a randomly chosen earlier point.
+    if (i % 10 == 9)
+    {
+      pointSeq.push_back(pointSeq[std::uniform_int_distribution<size_t>(0, i - 1)(generator)]);
+      continue;
+    }
+
+    Number t = Number(gridCoordinate(generator)), size = Number(gridSize);
+    switch (kind(generator))
+    {
+      case 0 : // Point on the boundary of the grid square.
+        switch (side(generator))
+        {
+          case 0  : pointSeq.push_back(Point(t, 0));           break;
+          case 1  : pointSeq.push_back(Point(size, t));        break;
+          case 2  : pointSeq.push_back(Point(size - t, size)); break;
+          default : pointSeq.push_back(Point(0, size - t));    break;
+        }
+        break;
+      case 1 : // Point on one of the diagonal lines y = x + offset.
+      {
+        Number offset = Number(diagonal(generator) * gridSize / (2 * NumberOfDiagonals));
+        pointSeq.push_back(Point(t, (t + offset <= size) ? t + offset : t + offset - size));
+        break;
+      }
+      default : // Point anywhere on the grid.
+        pointSeq.push_back(Point(t, Number(gridCoordinate(generator))));
+        break;
+    }
+  }
+}
+
+// Method that randomly generates "numberOfPoints" points with the distribution "distribution" from the seed "seed" and
+// stores them as a point sequence.
+void generatePointSequence(PointSequence& pointSeq, size_t numberOfPoints, PointDistribution distribution,
+                           std::uint64_t seed, PointGenerationScratch* scratch)
+{
+  switch (distribution)
+  {
+    case PointDistribution::UNIFORM    : generateRandomPoints(pointSeq, numberOfPoints, seed, scratch);
+                                         break;
+    case PointDistribution::CIRCLE     : generateCircledPointSequence(pointSeq, numberOfPoints, seed, scratch);
+                                         break;
+    case PointDistribution::DEGENERATE : generateDegeneratePointSequence(pointSeq, numberOfPoints, seed, scratch);
+                                         break;
+  }
+}
+
+// Method that reserves the scratch of the generators for "numberOfPoints" points with the distribution
+// "distribution".
+void reservePointGenerationScratch(PointGenerationScratch& scratch, size_t numberOfPoints,
+                                   PointDistribution distribution)
+{
+  switch (distribution)
+  {
+    case PointDistribution::UNIFORM    : scratch.visited.reserve(numberOfPoints * UNIFORM_RANGE_MULTIPLIER + 1); break;
+    case PointDistribution::CIRCLE     : scratch.visited.reserve(numberOfPoints * CIRCLE_RANGE_MULTIPLIER + 1);  break;
+    case PointDistribution::DEGENERATE : break;
+  }
+}
+
 // Method that returns the (minmal) squared distance of a point "r" from a segment whose end points are given by the
 // points "p" and "q".
 Number computeSquaredDistanceFromPointToSegment(const Point& r, const Point& p, const Point& q)
@@ -297,34 +452,16 @@ Number computeSquaredDistanceFromPointToSegment(const Point& r, const Point& p,
   return diffX * diffX + diffY * diffY;
 }
 
-// Method that checks whether a point sequence contains duplicates.
+// Method that checks whether a point sequence contains duplicates. The check is done by the parallel hash-based
+// duplicate search, which neither copies nor sorts the point sequence.
 bool PointSequenceContainsDuplicates(const PointSequence& pointSeq)
 {
-  bool duplicateFound = false;
-  size_t index = 1, numberOfPoints = pointSeq.size();
-  PointSequence pointSeqCopy(pointSeq);
-
-  // Sort all points in the point sequence "pointSeqCopy" in order to enable the identifation of duplicates.
-  std::sort(pointSeqCopy.begin(), pointSeqCopy.end());
-
-  while (index < numberOfPoints && !duplicateFound)
-  {
-    if (pointSeqCopy[index] != pointSeqCopy[index-1])
-      ++index;
-    else
-    {
-      duplicateFound = true;
-      std::cout << "pointSeqCopy[" << index-1 << "] = " << pointSeqCopy[index-1] << ", "
-                << "pointSeqCopy[" << index   << "] = " << pointSeqCopy[index] << std::endl;
-    }
-  }
-
-  return duplicateFound;
+  return PointSequenceContainsDuplicatesInParallel(pointSeq);
 }
 
 // Method that checks whether a point sequence fulfills some minimal requirements for computing the convex hull from
 // it. These requirements include that the point sequence contains at least three points and that it is not the case
-// that all points are collinear.
+// that all points are collinear. Duplicates are allowed; they count as one point.
 bool PointSequenceFulfillsMinimalRequirements(const PointSequence& pointSeq)
 {
   // Check if there are at least three points.
@@ -332,12 +469,21 @@ bool PointSequenceFulfillsMinimalRequirements(const PointSequence& pointSeq)
     // There is no convex hull.
     return false;
 
+  // Find the first point that differs from the point "pointSeq[0]". If there is none, all points are duplicates of
+  // the same point and there is no convex hull.
+  size_t i = 1;
+  while (i < pointSeq.size() && pointSeq[i] == pointSeq[0])
+    ++i;
+  if (i == pointSeq.size())
+    return false;
+
   // Check the extremely rare case that all points are collinear. Then there is no convex hull. Return "false".
+  const Point& secondPoint = pointSeq[i];
   bool allPointsAreCollinear = true; // Assumption
-  size_t i = 2;
+  ++i;
   while (allPointsAreCollinear && i < pointSeq.size())
   {
-    allPointsAreCollinear = (getOrientation(pointSeq[0], pointSeq[1], pointSeq[i]) == Orientation::COLLINEAR);
+    allPointsAreCollinear = (getOrientation(pointSeq[0], secondPoint, pointSeq[i]) == Orientation::COLLINEAR);
     ++i;
   }
   if (allPointsAreCollinear)
@@ -347,6 +493,286 @@ bool PointSequenceFulfillsMinimalRequirements(const PointSequence& pointSeq)
   return true;
 }
 
+// Number of points whose bounding box is computed at once by the method "scanPointSequence". Only blocks whose
+// bounding box reaches the current leftmost or rightmost x-coordinate are compared lexicographically point by point.
+static const size_t SCAN_BLOCK_SIZE = 256;
+
+// Minimal number of points that a thread scans in the method "scanPointSequence". Smaller point sequences are scanned
+// by fewer threads since creating a thread costs more than scanning them.
+static const size_t MINIMAL_NUMBER_OF_POINTS_PER_SCAN_THREAD = size_t(1) << 16;
+
+// Type that keeps the result of the scan of a consecutive part (chunk) of a point sequence.
+template <typename PointType>
+struct PointSequenceChunkScan
+{
+  size_t leftMostIndex = 0;
+  size_t rightMostIndex = 0;
+  // Index of the first point of the chunk that differs from the point "pointSeq[0]" (the end of the chunk if none).
+  size_t secondIndex = 0;
+  // Index of the first point of the chunk after "secondIndex" that is not collinear with the points "pointSeq[0]" and
+  // "pointSeq[secondIndex]" (the end of the chunk if none).
+  size_t witnessIndex = 0;
+  PointType minCorner;
+  PointType maxCorner;
+};
+
+// Method that computes the bounding box of the "numberOfPoints" > 0 points starting at "points". The loop has no
+// dependencies between the coordinates so that the compiler can vectorize it (e.g., for fixed-point points).
+template <typename PointType>
+static void computeBoundingBoxOfBlock(const PointType* points, size_t numberOfPoints, PointType& minCorner,
+                                      PointType& maxCorner)
+{
+  minCorner = maxCorner = points[0];
+  for (size_t i = 1; i < numberOfPoints; ++i)
+  {
+    minCorner.x = std::min(minCorner.x, points[i].x);
+    minCorner.y = std::min(minCorner.y, points[i].y);
+    maxCorner.x = std::max(maxCorner.x, points[i].x);
+    maxCorner.y = std::max(maxCorner.y, points[i].y);
+  }
+}
+
+// Method that computes the bounding box of the "numberOfPoints" > 0 points starting at "points". The points are
+// processed as pairs of coordinates with two independent SIMD accumulators if SSE2 or NEON is available.
+static void computeBoundingBoxOfBlock(const Point* points, size_t numberOfPoints, Point& minCorner, Point& maxCorner)
+{
+#if defined(__SSE2__) || (defined(__aarch64__) && defined(__ARM_NEON))
+  static_assert(std::is_same<Number, double>::value && std::is_standard_layout<Point>::value &&
+                sizeof(Point) == 2 * sizeof(double), "A point must consist of two adjacent doubles.");
+  const double* coordinates = &points[0].x;
+  double minimum[2], maximum[2];
+  size_t i = 1;
+#endif
+
+#if defined(__SSE2__)
+  __m128d minimum0 = _mm_loadu_pd(coordinates), maximum0 = minimum0, minimum1 = minimum0, maximum1 = minimum0;
+  for (; i + 1 < numberOfPoints; i += 2)
+  {
+    __m128d point0 = _mm_loadu_pd(coordinates + 2 * i), point1 = _mm_loadu_pd(coordinates + 2 * i + 2);
+    minimum0 = _mm_min_pd(minimum0, point0);
+    maximum0 = _mm_max_pd(maximum0, point0);
+    minimum1 = _mm_min_pd(minimum1, point1);
+    maximum1 = _mm_max_pd(maximum1, point1);
+  }
+  if (i < numberOfPoints)
+  {
+    __m128d point0 = _mm_loadu_pd(coordinates + 2 * i);
+    minimum0 = _mm_min_pd(minimum0, point0);
+    maximum0 = _mm_max_pd(maximum0, point0);
+  }
+  _mm_storeu_pd(minimum, _mm_min_pd(minimum0, minimum1));
+  _mm_storeu_pd(maximum, _mm_max_pd(maximum0, maximum1));
+  minCorner = Point(minimum[0], minimum[1]);
+  maxCorner = Point(maximum[0], maximum[1]);
+#elif defined(__aarch64__) && defined(__ARM_NEON)
+  float64x2_t minimum0 = vld1q_f64(coordinates), maximum0 = minimum0, minimum1 = minimum0, maximum1 = minimum0;
+  for (; i + 1 < numberOfPoints; i += 2)
+  {
+    float64x2_t point0 = vld1q_f64(coordinates + 2 * i), point1 = vld1q_f64(coordinates + 2 * i + 2);
+    minimum0 = vminq_f64(minimum0, point0);
+    maximum0 = vmaxq_f64(maximum0, point0);
+    minimum1 = vminq_f64(minimum1, point1);
+    maximum1 = vmaxq_f64(maximum1, point1);
+  }
+  if (i < numberOfPoints)
+  {
+    float64x2_t point0 = vld1q_f64(coordinates + 2 * i);
+    minimum0 = vminq_f64(minimum0, point0);
+    maximum0 = vmaxq_f64(maximum0, point0);
+  }
+  vst1q_f64(minimum, vminq_f64(minimum0, minimum1));
+  vst1q_f64(maximum, vmaxq_f64(maximum0, maximum1));
+  minCorner = Point(minimum[0], minimum[1]);
+  maxCorner = Point(maximum[0], maximum[1]);
+#else
+  computeBoundingBoxOfBlock<Point>(points, numberOfPoints, minCorner, maxCorner);
+#endif
+}
+
+// Method that scans the points "pointSeq[begin]", ..., "pointSeq[end - 1]" (begin < end) block by block. For each
+// block, it updates the bounding box, compares the points of the block with the current leftmost and rightmost point
+// if the bounding box of the block allows a new one, and advances the search for the second point and the witness
+// while the block is in the cache. The collinearity tests are made with the exact orientation policy
+// "ExactOrientationPolicy" for the type of the points.
+template <typename ExactOrientationPolicy, typename Allocator>
+static PointSequenceChunkScan<typename ExactOrientationPolicy::PointType>
+scanPointSequenceChunk(const std::vector<typename ExactOrientationPolicy::PointType, Allocator>& pointSeq, size_t begin,
+                       size_t end)
+{
+  using PointType = typename ExactOrientationPolicy::PointType;
+  PointSequenceChunkScan<PointType> chunkScan;
+  const PointType& firstPoint = pointSeq[0];
+  const PointType* points = pointSeq.data();
+
+  chunkScan.leftMostIndex = chunkScan.rightMostIndex = begin;
+  chunkScan.minCorner = chunkScan.maxCorner = points[begin];
+  chunkScan.secondIndex = chunkScan.witnessIndex = end;
+  bool witnessSearchIsFinished = false;
+
+  for (size_t blockBegin = begin; blockBegin < end; blockBegin += SCAN_BLOCK_SIZE)
+  {
+    size_t blockEnd = std::min(blockBegin + SCAN_BLOCK_SIZE, end);
+    PointType blockMinCorner, blockMaxCorner;
+    computeBoundingBoxOfBlock(points + blockBegin, blockEnd - blockBegin, blockMinCorner, blockMaxCorner);
+
+    // Find the first lexicographically smallest and the last lexicographically largest point. A block can only
+    // contain such a point if its x-range reaches the x-coordinate of the current one.
+    if (blockMinCorner.x <= points[chunkScan.leftMostIndex].x)
+      for (size_t i = blockBegin; i < blockEnd; ++i)
+        if (points[i] < points[chunkScan.leftMostIndex])
+          chunkScan.leftMostIndex = i;
+    if (blockMaxCorner.x >= points[chunkScan.rightMostIndex].x)
+      for (size_t i = blockBegin; i < blockEnd; ++i)
+        if (! (points[i] < points[chunkScan.rightMostIndex]))
+          chunkScan.rightMostIndex = i;
+
+    chunkScan.minCorner.x = std::min(chunkScan.minCorner.x, blockMinCorner.x);
+    chunkScan.minCorner.y = std::min(chunkScan.minCorner.y, blockMinCorner.y);
+    chunkScan.maxCorner.x = std::max(chunkScan.maxCorner.x, blockMaxCorner.x);
+    chunkScan.maxCorner.y = std::max(chunkScan.maxCorner.y, blockMaxCorner.y);
+
+    // Search the first point that differs from the point "pointSeq[0]" and then the first point that is not
+    // collinear with both. For almost all point sequences, the search ends within the first block.
+    for (size_t i = blockBegin; ! witnessSearchIsFinished && i < blockEnd; ++i)
+      if (chunkScan.secondIndex == end)
+      {
+        if (points[i] != firstPoint)
+          chunkScan.secondIndex = i;
+      }
+      else if (ExactOrientationPolicy::orientation(firstPoint, points[chunkScan.secondIndex], points[i]) !=
+               Orientation::COLLINEAR)
+      {
+        chunkScan.witnessIndex = i;
+        witnessSearchIsFinished = true;
+      }
+  }
+
+  return chunkScan;
+}
+
+// Method that scans a point sequence once and determines all information that the convex hull algorithms need before
+// they start: whether the minimal requirements are fulfilled, the leftmost and the rightmost point, a non-degeneracy
+// witness, and the bounding box. Each thread scans a consecutive chunk of the point sequence; the results of the
+// chunks are combined in the order of the chunks so that the result does not depend on the number of threads. The
+// collinearity tests are exact so that the witness is valid for every orientation policy.
+template <typename ExactOrientationPolicy, typename Allocator>
+static BasicPointSequenceScan<typename ExactOrientationPolicy::PointType>
+scanPointSequenceExactly(const std::vector<typename ExactOrientationPolicy::PointType, Allocator>& pointSeq,
+                         size_t numberOfThreads)
+{
+  using PointType = typename ExactOrientationPolicy::PointType;
+  BasicPointSequenceScan<PointType> scan;
+  size_t numberOfPoints = pointSeq.size();
+  TRACE_SIZED_SPAN("scan", numberOfPoints);
+
+  if (numberOfPoints == 0)
+    return scan;
+
+  numberOfThreads = std::min(resolveNumberOfThreads(numberOfThreads),
+                             std::max<size_t>(1, numberOfPoints / MINIMAL_NUMBER_OF_POINTS_PER_SCAN_THREAD));
+  std::vector<PointSequenceChunkScan<PointType>> chunkScans(numberOfThreads);
+  runInParallel(numberOfThreads, [&](size_t threadIndex)
+  {
+    size_t begin = getPartBegin(numberOfPoints, numberOfThreads, threadIndex);
+    size_t end = getPartBegin(numberOfPoints, numberOfThreads, threadIndex + 1);
+    chunkScans[threadIndex] = scanPointSequenceChunk<ExactOrientationPolicy>(pointSeq, begin, end);
+  });
+
+  // Combine the poles and the bounding boxes of the chunks.
+  scan.leftMostIndex = chunkScans[0].leftMostIndex;
+  scan.rightMostIndex = chunkScans[0].rightMostIndex;
+  scan.minCorner = chunkScans[0].minCorner;
+  scan.maxCorner = chunkScans[0].maxCorner;
+  for (size_t k = 1; k < numberOfThreads; ++k)
+  {
+    if (pointSeq[chunkScans[k].leftMostIndex] < pointSeq[scan.leftMostIndex])
+      scan.leftMostIndex = chunkScans[k].leftMostIndex;
+    if (! (pointSeq[chunkScans[k].rightMostIndex] < pointSeq[scan.rightMostIndex]))
+      scan.rightMostIndex = chunkScans[k].rightMostIndex;
+    scan.minCorner.x = std::min(scan.minCorner.x, chunkScans[k].minCorner.x);
+    scan.minCorner.y = std::min(scan.minCorner.y, chunkScans[k].minCorner.y);
+    scan.maxCorner.x = std::max(scan.maxCorner.x, chunkScans[k].maxCorner.x);
+    scan.maxCorner.y = std::max(scan.maxCorner.y, chunkScans[k].maxCorner.y);
+  }
+
+  // Check the minimal requirements (see "PointSequenceFulfillsMinimalRequirements"): there must be at least three
+  // points, a second point that differs from the point "pointSeq[0]", and a witness that is not collinear with both.
+  // The second point is the one of the first chunk that has one. If a chunk contains a point that is not collinear
+  // with these two points, then its own second point or its own witness is not collinear with them either.
+  if (numberOfPoints < 3)
+    return scan;
+  size_t k = 0;
+  while (k < numberOfThreads && chunkScans[k].secondIndex == getPartBegin(numberOfPoints, numberOfThreads, k + 1))
+    ++k;
+  if (k == numberOfThreads)
+    return scan;
+  size_t secondIndex = chunkScans[k].secondIndex;
+  const PointType& firstPoint = pointSeq[0];
+  const PointType& secondPoint = pointSeq[secondIndex];
+  size_t witnessIndex = numberOfPoints;
+  for (; witnessIndex == numberOfPoints && k < numberOfThreads; ++k)
+  {
+    size_t chunkEnd = getPartBegin(numberOfPoints, numberOfThreads, k + 1);
+    for (size_t candidateIndex : {chunkScans[k].secondIndex, chunkScans[k].witnessIndex})
+      if (witnessIndex == numberOfPoints && candidateIndex < chunkEnd &&
+          ExactOrientationPolicy::orientation(firstPoint, secondPoint, pointSeq[candidateIndex]) !=
+          Orientation::COLLINEAR)
+        witnessIndex = candidateIndex;
+  }
+  if (witnessIndex == numberOfPoints)
+    return scan;
+
+  // The algorithms need a witness that is not collinear with the leftmost and the rightmost point. One of the three
+  // points that are not collinear is such a witness.
+  const PointType& leftMostPoint = pointSeq[scan.leftMostIndex];
+  const PointType& rightMostPoint = pointSeq[scan.rightMostIndex];
+  for (size_t candidateIndex : {size_t(0), secondIndex, witnessIndex})
+    if (! scan.fulfillsMinimalRequirements &&
+        ExactOrientationPolicy::orientation(leftMostPoint, rightMostPoint, pointSeq[candidateIndex]) !=
+        Orientation::COLLINEAR)
+    {
+      scan.witnessIndex = candidateIndex;
+      scan.fulfillsMinimalRequirements = true;
+    }
+
+  return scan;
+}
+
+// Method that scans a point sequence once (see above). Without a bounding box scope, the adaptive orientation policy
+// is exact.
+template <typename Allocator>
+PointSequenceScan scanPointSequence(const std::vector<Point, Allocator>& pointSeq, size_t numberOfThreads)
+{
+  return scanPointSequenceExactly<AdaptiveOrientationPolicy>(pointSeq, numberOfThreads);
+}
+
+// Methods that scan a fixed-point sequence once (see "FixedPoint.h").
+template <typename Allocator>
+BasicPointSequenceScan<FixedPoint> scanPointSequence(const std::vector<FixedPoint, Allocator>& pointSeq,
+                                                     size_t numberOfThreads)
+{
+  return scanPointSequenceExactly<FixedPointOrientationPolicy<std::int32_t>>(pointSeq, numberOfThreads);
+}
+
+template <typename Allocator>
+BasicPointSequenceScan<WideFixedPoint> scanPointSequence(const std::vector<WideFixedPoint, Allocator>& pointSeq,
+                                                         size_t numberOfThreads)
+{
+  return scanPointSequenceExactly<FixedPointOrientationPolicy<std::int64_t>>(pointSeq, numberOfThreads);
+}
+
+// Explicit instantiations for the point sequences and the point buffers.
+template PointSequenceScan scanPointSequence(const PointSequence& pointSeq, size_t numberOfThreads);
+template PointSequenceScan scanPointSequence(const PointBuffer<Point>& pointSeq, size_t numberOfThreads);
+template BasicPointSequenceScan<FixedPoint> scanPointSequence(const FixedPointSequence& pointSeq,
+                                                              size_t numberOfThreads);
+template BasicPointSequenceScan<FixedPoint> scanPointSequence(const PointBuffer<FixedPoint>& pointSeq,
+                                                              size_t numberOfThreads);
+template BasicPointSequenceScan<WideFixedPoint> scanPointSequence(const WideFixedPointSequence& pointSeq,
+                                                                  size_t numberOfThreads);
+template BasicPointSequenceScan<WideFixedPoint> scanPointSequence(const PointBuffer<WideFixedPoint>& pointSeq,
+                                                                  size_t numberOfThreads);
+
 // HELP FUNCTIONS (to be removed later)
 
 void printPointSequence(const std::string& str1, const std::string& str2, const std::vector<Point>& pointSeq)
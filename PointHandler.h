@@ -2,6 +2,7 @@
 #define POINTHANDLER_H
 
 
+#include <cstdint>
 #include <ostream>
 #include <string>    // to be deleted later
 #include <vector>
@@ -76,18 +77,98 @@ void generateRandomPoints(PointSequence& pointSeq, size_t numberOfPoints);
 // The points are randomly planced in a shape of a Circle. 
 void generateCircledPointSequence(PointSequence& points, size_t numberOfPoints);
 
+// Method that randomly generates "numberOfPoints" points with many duplicates and long collinear runs and stores them
+// as a point sequence. All points have integer coordinates on a coarse grid: a quarter of the points lie on the
+// boundary of the grid square (i.e., on the edges of the convex hull), a quarter lie on a few diagonal lines, and the
+// rest are spread over the grid. Additionally, every tenth point is an exact copy of an earlier point. This
+// distribution is used to stress the convex hull algorithms with degenerate inputs.
+void generateDegeneratePointSequence(PointSequence& pointSeq, size_t numberOfPoints);
+
+// Type that indicates the distribution of randomly generated points: uniformly distributed points without duplicates
+// (see "generateRandomPoints"), points in the shape of a circle (see "generateCircledPointSequence"), and points with
+// many duplicates and collinear runs (see "generateDegeneratePointSequence").
+enum class PointDistribution {UNIFORM, CIRCLE, DEGENERATE};
+
+// Type that keeps the memory that the generators need besides the point sequence, i.e., the flags of the integer
+// parts of the coordinates or radii that have been generated already. If the scratch and the point sequence are
+// reserved for the generated points (see "reservePointGenerationScratch"), the generators allocate no memory.
+// Additionally, the generators call the function "pause" (if any) with "pauseContext" before they start and after
+// every "POINT_GENERATION_CHUNK_SIZE" points, so that a generation in a background thread can be held while a run is
+// measured (see "PointGenerationPipeline.h").
+struct PointGenerationScratch
+{
+  std::vector<bool> visited;
+  void (*pause)(void*) = nullptr;
+  void* pauseContext = nullptr;
+};
+
+// Number of points that are generated between two calls of the function "pause" of a scratch.
+constexpr size_t POINT_GENERATION_CHUNK_SIZE = 16384;
+
+// Method that reserves the scratch "scratch" for generating "numberOfPoints" points with the distribution
+// "distribution".
+void reservePointGenerationScratch(PointGenerationScratch& scratch, size_t numberOfPoints,
+                                   PointDistribution distribution);
+
+// Methods that generate point sequences like the methods above, but draw the random numbers from a generator that is
+// initialized with the seed "seed", so that the same seed always yields the same point sequence. Without a scratch
+// "scratch", the methods allocate their own one.
+void generateRandomPoints(PointSequence& pointSeq, size_t numberOfPoints, std::uint64_t seed,
+                          PointGenerationScratch* scratch = nullptr);
+void generateCircledPointSequence(PointSequence& points, size_t numberOfPoints, std::uint64_t seed,
+                                  PointGenerationScratch* scratch = nullptr);
+void generateDegeneratePointSequence(PointSequence& pointSeq, size_t numberOfPoints, std::uint64_t seed,
+                                     PointGenerationScratch* scratch = nullptr);
+
+// Method that randomly generates "numberOfPoints" points with the distribution "distribution" from the seed "seed" and
+// stores them as a point sequence. Without a scratch "scratch", the method allocates its own one.
+void generatePointSequence(PointSequence& pointSeq, size_t numberOfPoints, PointDistribution distribution,
+                           std::uint64_t seed, PointGenerationScratch* scratch = nullptr);
+
 // Method that returns the (minmal) squared distance of a point "r" from a segment whose end points are given by the
 // points "p" and "q".
 Number computeSquaredDistanceFromPointToSegment(const Point& r, const Point& p, const Point& q);
 
-// Method that checks whether a point sequence contains duplicates.
+// Method that checks whether a point sequence contains duplicates (see also "PointSequenceDuplicates.h").
 bool PointSequenceContainsDuplicates(const PointSequence& pointSeq);
 
 // Method that checks whether a point sequence fulfills some minimal requirements for computing the convex hull from
 // it. These requirements include that the point sequence contains at least three points and that it is not the case
-// that all points are collinear.
+// that all points are collinear. Duplicates are allowed; they count as one point.
 bool PointSequenceFulfillsMinimalRequirements(const PointSequence& pointSeq);
 
+// Type that keeps the result of a scan of a point sequence by the method "scanPointSequence". The indexes and the
+// bounding box are only valid for non-empty point sequences. The template parameter "PointType" is the type of the
+// points (see also "FixedPoint.h").
+template <typename PointType>
+struct BasicPointSequenceScan
+{
+  // Flag that indicates whether the point sequence fulfills the minimal requirements for computing the convex hull
+  // from it (see "PointSequenceFulfillsMinimalRequirements").
+  bool fulfillsMinimalRequirements = false;
+  // Index of the first lexicographically smallest point (the leftmost point or west pole).
+  size_t leftMostIndex = 0;
+  // Index of the last lexicographically largest point (the rightmost point or east pole).
+  size_t rightMostIndex = 0;
+  // Index of a point that is not collinear with the leftmost and the rightmost point. It witnesses that not all points
+  // are collinear and is only valid if the minimal requirements are fulfilled.
+  size_t witnessIndex = 0;
+  // Corners of the axis-parallel bounding box of all points.
+  PointType minCorner;
+  PointType maxCorner;
+};
+
+using PointSequenceScan = BasicPointSequenceScan<Point>;
+
+// Method that scans a point sequence once and determines all information that the convex hull algorithms need before
+// they start: whether the minimal requirements are fulfilled, the leftmost and the rightmost point, a non-degeneracy
+// witness, and the bounding box. The scan processes the points in blocks whose bounding boxes are computed with SIMD
+// instructions; the lexicographic comparisons are only made for blocks that may contain a new pole. Large point
+// sequences are scanned by "numberOfThreads" threads (0 means the default number of threads). Besides point sequences,
+// the method accepts the point buffers of the performance tests (see "PointBuffer.h").
+template <typename Allocator>
+PointSequenceScan scanPointSequence(const std::vector<Point, Allocator>& pointSeq, size_t numberOfThreads = 0);
+
 // HELP FUNCTIONS (to be removed later)
 
 void printPointSequence(const std::string& str1, const std::string& str2, const std::vector<Point>& pointSeq);
@@ -0,0 +1,470 @@
+
+#include <charconv>    // std::from_chars, std::to_chars
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>     // std::memchr
+#include <fstream>
+#include <iostream>
+#include <string>
+#include <vector>
+#include <fcntl.h>     // open
+#include <sys/mman.h>  // mmap, madvise, munmap
+#include <sys/stat.h>  // fstat
+#include <unistd.h>    // close
+#include "Number.h"
+#include "ParallelExecution.h"
+#include "PointHandler.h"
+#include "PointIO.h"
+
+//++++++++++++++++++++++++
+// Local data and methods
+//++++++++++++++++++++++++
+
+// Minimal number of bytes of a chunk that is parsed by its own thread. Smaller files are parsed by fewer threads.
+constexpr size_t MIN_BYTES_PER_CHUNK = size_t(1) << 20;
+
+// Size of the output buffer of the writers.
+constexpr size_t OUTPUT_BUFFER_SIZE = size_t(1) << 22;
+
+// Maximal number of characters of a formatted coordinate that the writers reserve in the output buffer (the largest
+// double has 309 integral digits).
+constexpr size_t MAX_CHARACTERS_PER_INTEGRAL_PART = 330;
+
+// Type that indicates which coordinates a line of a text file keeps.
+enum class RecordLayout {X_COORDINATE, Y_COORDINATE, X_AND_Y_COORDINATES};
+
+// Read-only memory mapping of a file. The mapping is released by the destructor.
+class MappedFile
+{
+  public:
+    const char* data = nullptr;
+    size_t size = 0;
+
+    MappedFile() = default;
+    MappedFile(const MappedFile&) = delete;
+    MappedFile& operator = (const MappedFile&) = delete;
+
+    ~MappedFile()
+    {
+      if (mapping != nullptr)
+        munmap(mapping, size);
+    }
+
+    // Method that maps the file "fileName" into memory. It returns "false" if the file cannot be opened or mapped.
+    bool open(const std::string& fileName)
+    {
+      int fileDescriptor = ::open(fileName.c_str(), O_RDONLY);
+      if (fileDescriptor < 0)
+        return false;
+
+      struct stat fileStatus;
+      if (fstat(fileDescriptor, &fileStatus) != 0)
+      {
+        ::close(fileDescriptor);
+        return false;
+      }
+
+      size = size_t(fileStatus.st_size);
+      if (size > 0)
+      {
+        // A file of size 0 cannot be mapped but is a valid (empty) input.
+        mapping = mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fileDescriptor, 0);
+        if (mapping == MAP_FAILED)
+        {
+          mapping = nullptr;
+          ::close(fileDescriptor);
+          return false;
+        }
+        madvise(mapping, size, MADV_SEQUENTIAL);
+        data = static_cast<const char*>(mapping);
+      }
+
+      ::close(fileDescriptor);
+      return true;
+    }
+
+  private:
+    void* mapping = nullptr;
+};
+
+// Method that checks whether the character "c" is a blank that may surround a coordinate.
+static inline bool isBlank(char c)
+{
+  return c == ' ' || c == '\t' || c == '\r';
+}
+
+// Method that returns a pointer to the first character in [first, last) that is not a blank.
+static inline const char* skipBlanks(const char* first, const char* last)
+{
+  while (first != last && isBlank(*first))
+    ++first;
+  return first;
+}
+
+// Method that returns a pointer to the end of the line that starts at "first" (i.e., to the newline or to "last").
+static inline const char* findLineEnd(const char* first, const char* last)
+{
+  const char* lineEnd = static_cast<const char*>(std::memchr(first, '\n', last - first));
+  return (lineEnd != nullptr) ? lineEnd : last;
+}
+
+// Method that parses a number at the beginning of [first, last) into "value". It returns a pointer to the first
+// character after the number or nullptr if there is no number.
+static inline const char* parseNumber(const char* first, const char* last, Number& value)
+{
+  // std::from_chars does not accept a leading plus sign.
+  if (first != last && *first == '+')
+    ++first;
+
+  #if defined(__cpp_lib_to_chars)
+  std::from_chars_result result = std::from_chars(first, last, value);
+  return (result.ec == std::errc()) ? result.ptr : nullptr;
+  #else
+  // Standard libraries without floating-point std::from_chars: std::strtod needs a null-terminated string.
+  char token[64];
+  size_t length = 0;
+  while (first + length != last && length < sizeof(token) - 1 && !isBlank(first[length]) && first[length] != ','
+         && first[length] != '\n')
+  {
+    token[length] = first[length];
+    ++length;
+  }
+  token[length] = '\0';
+  char* tokenEnd;
+  value = std::strtod(token, &tokenEnd);
+  return (tokenEnd != token) ? first + (tokenEnd - token) : nullptr;
+  #endif
+}
+
+// Method that counts the lines in [first, last) that contain at least one non-blank character.
+static size_t countRecords(const char* first, const char* last)
+{
+  size_t numberOfRecords = 0;
+
+  while (first != last)
+  {
+    const char* lineEnd = findLineEnd(first, last);
+    if (skipBlanks(first, lineEnd) != lineEnd)
+      ++numberOfRecords;
+    first = (lineEnd == last) ? last : lineEnd + 1;
+  }
+
+  return numberOfRecords;
+}
+
+// Method that parses the non-empty lines in [first, last) according to "layout" and stores the coordinates into the
+// consecutive points beginning at "target". It returns nullptr on success and otherwise a pointer to the beginning of
+// the first malformed line.
+static const char* parseRecords(const char* first, const char* last, RecordLayout layout, Point* target)
+{
+  while (first != last)
+  {
+    const char* lineEnd = findLineEnd(first, last);
+    const char* current = skipBlanks(first, lineEnd);
+
+    if (current != lineEnd)
+    {
+      Number value;
+      current = parseNumber(current, lineEnd, value);
+      if (current == nullptr)
+        return first;
+
+      switch (layout)
+      {
+        case RecordLayout::X_COORDINATE : target->x = value; break;
+        case RecordLayout::Y_COORDINATE : target->y = value; break;
+        case RecordLayout::X_AND_Y_COORDINATES :
+          target->x = value;
+          current = skipBlanks(current, lineEnd);
+          if (current == lineEnd || *current != ',')
+            return first;
+          current = parseNumber(skipBlanks(current + 1, lineEnd), lineEnd, target->y);
+          if (current == nullptr)
+            return first;
+          break;
+      }
+
+      if (skipBlanks(current, lineEnd) != lineEnd)
+        return first;
+      ++target;
+    }
+
+    first = (lineEnd == last) ? last : lineEnd + 1;
+  }
+
+  return nullptr;
+}
+
+// Method that splits [begin, size) of "data" into at most "numberOfChunks" chunks whose borders are placed directly
+// behind newlines. It returns the chunk borders including "begin" and "size".
+static std::vector<size_t> findChunkBorders(const char* data, size_t begin, size_t size, size_t numberOfChunks)
+{
+  std::vector<size_t> borders(1, begin);
+
+  for (size_t chunk = 1; chunk < numberOfChunks; ++chunk)
+  {
+    size_t border = begin + getPartBegin(size - begin, numberOfChunks, chunk);
+    if (border <= borders.back())
+      continue;
+    border = findLineEnd(data + border - 1, data + size) - data;
+    border = (border < size) ? border + 1 : size;
+    if (border > borders.back() && border < size)
+      borders.push_back(border);
+  }
+  borders.push_back(size);
+
+  return borders;
+}
+
+// Method that returns the number of records of the mapped file "file" (beginning at byte "begin") and, for each chunk,
+// the index of the first record of the chunk. The chunk borders are stored in "borders".
+static size_t indexChunks(const MappedFile& file, size_t begin, size_t numberOfThreads, std::vector<size_t>& borders,
+                          std::vector<size_t>& firstRecords)
+{
+  size_t numberOfChunks = (file.size - begin) / MIN_BYTES_PER_CHUNK + 1;
+  if (numberOfChunks > numberOfThreads)
+    numberOfChunks = numberOfThreads;
+
+  borders = findChunkBorders(file.data, begin, file.size, numberOfChunks);
+  numberOfChunks = borders.size() - 1;
+
+  firstRecords.assign(numberOfChunks + 1, 0);
+  runInParallel(numberOfChunks, [&](size_t chunk)
+  {
+    firstRecords[chunk + 1] = countRecords(file.data + borders[chunk], file.data + borders[chunk + 1]);
+  });
+  for (size_t chunk = 1; chunk <= numberOfChunks; ++chunk)
+    firstRecords[chunk] += firstRecords[chunk - 1];
+
+  return firstRecords[numberOfChunks];
+}
+
+// Method that parses the mapped file "file" (beginning at byte "begin") chunk by chunk in parallel into "pointSeq"
+// according to "layout". The point sequence must already have the size of the number of records.
+static bool parseChunks(const MappedFile& file, const std::string& fileName, RecordLayout layout,
+                        const std::vector<size_t>& borders, const std::vector<size_t>& firstRecords,
+                        PointSequence& pointSeq)
+{
+  size_t numberOfChunks = borders.size() - 1;
+  std::vector<const char*> malformedLines(numberOfChunks, nullptr);
+
+  runInParallel(numberOfChunks, [&](size_t chunk)
+  {
+    malformedLines[chunk] = parseRecords(file.data + borders[chunk], file.data + borders[chunk + 1], layout,
+                                         pointSeq.data() + firstRecords[chunk]);
+  });
+
+  for (const char* malformedLine : malformedLines)
+    if (malformedLine != nullptr)
+    {
+      std::cout << "ERROR: Malformed line at byte offset " << (malformedLine - file.data) << " of file '"
+                << fileName << "'!" << std::endl;
+      return false;
+    }
+
+  return true;
+}
+
+// Method that opens the file "fileName" as a mapped file and prints an error message if this fails.
+static bool openMappedFile(MappedFile& file, const std::string& fileName)
+{
+  if (file.open(fileName))
+    return true;
+
+  std::cout << "ERROR: File '" << fileName << "' cannot be read!" << std::endl;
+  return false;
+}
+
+// Method that appends the coordinate "value" with "decimalPlaces" decimal places to "position" and returns the new
+// end of the buffer contents. It is assumed that the buffer is large enough.
+static inline char* formatNumber(char* position, char* bufferEnd, Number value, int decimalPlaces)
+{
+  #if defined(__cpp_lib_to_chars)
+  std::to_chars_result result = (decimalPlaces < 0)
+                                ? std::to_chars(position, bufferEnd, value)
+                                : std::to_chars(position, bufferEnd, value, std::chars_format::fixed, decimalPlaces);
+  return result.ptr;
+  #else
+  int length = (decimalPlaces < 0) ? std::snprintf(position, bufferEnd - position, "%.17g", value)
+                                   : std::snprintf(position, bufferEnd - position, "%.*f", decimalPlaces, value);
+  return position + length;
+  #endif
+}
+
+// Output file with a large buffer that is only written if it is (almost) full or if the file is closed.
+class BufferedOutputFile
+{
+  public:
+    BufferedOutputFile(const std::string& fileName, size_t reservePerRecord)
+      : fileName(fileName), out(fileName, std::ios::binary), buffer(OUTPUT_BUFFER_SIZE + reservePerRecord),
+        position(buffer.data())
+    {
+      if (!out)
+        std::cout << "ERROR: File '" << fileName << "' cannot be written!" << std::endl;
+    }
+
+    bool isOpen() const { return bool(out); }
+
+    // Method that returns the position where the next record is formatted. Before, the buffer contents are written
+    // if the buffer is full.
+    char* reserve()
+    {
+      if (size_t(position - buffer.data()) >= OUTPUT_BUFFER_SIZE)
+        flush();
+      return position;
+    }
+
+    // Method that marks the characters up to "recordEnd" as part of the buffer contents.
+    void commit(char* recordEnd) { position = recordEnd; }
+
+    char* end() { return buffer.data() + buffer.size(); }
+
+    // Method that writes the remaining buffer contents and closes the file. It returns "false" if writing failed.
+    bool close()
+    {
+      flush();
+      out.close();
+      if (!out)
+      {
+        std::cout << "ERROR: File '" << fileName << "' cannot be written!" << std::endl;
+        return false;
+      }
+      return true;
+    }
+
+  private:
+    std::string fileName;
+    std::ofstream out;
+    std::vector<char> buffer;
+    char* position;
+
+    void flush()
+    {
+      out.write(buffer.data(), position - buffer.data());
+      position = buffer.data();
+    }
+};
+
+// Method that returns the number of characters that has to be reserved for a formatted coordinate.
+static inline size_t getReservePerCoordinate(int decimalPlaces)
+{
+  return MAX_CHARACTERS_PER_INTEGRAL_PART + ((decimalPlaces > 0) ? size_t(decimalPlaces) : 0);
+}
+
+//+++++++++++++++
+// Public methods
+//+++++++++++++++
+
+// Method that reads a point sequence stored in the two-file layout from the files "xFileName" and "yFileName".
+bool readPointSequenceFromTwoFiles(const std::string& xFileName, const std::string& yFileName, PointSequence& pointSeq,
+                                   size_t numberOfThreads)
+{
+  MappedFile xFile, yFile;
+  std::vector<size_t> xBorders, yBorders, xFirstRecords, yFirstRecords;
+
+  pointSeq.clear();
+  if (!openMappedFile(xFile, xFileName) || !openMappedFile(yFile, yFileName))
+    return false;
+
+  numberOfThreads = resolveNumberOfThreads(numberOfThreads);
+  size_t numberOfPoints = indexChunks(xFile, 0, numberOfThreads, xBorders, xFirstRecords);
+  if (indexChunks(yFile, 0, numberOfThreads, yBorders, yFirstRecords) != numberOfPoints)
+  {
+    std::cout << "ERROR: Files '" << xFileName << "' and '" << yFileName
+              << "' contain different numbers of coordinates!" << std::endl;
+    return false;
+  }
+
+  pointSeq.resize(numberOfPoints);
+  if (!parseChunks(xFile, xFileName, RecordLayout::X_COORDINATE, xBorders, xFirstRecords, pointSeq) ||
+      !parseChunks(yFile, yFileName, RecordLayout::Y_COORDINATE, yBorders, yFirstRecords, pointSeq))
+  {
+    pointSeq.clear();
+    return false;
+  }
+
+  return true;
+}
+
+// Method that reads a point sequence stored in the CSV layout from the file "fileName".
+bool readPointSequenceFromCSVFile(const std::string& fileName, PointSequence& pointSeq, size_t numberOfThreads)
+{
+  MappedFile file;
+  std::vector<size_t> borders, firstRecords;
+
+  pointSeq.clear();
+  if (!openMappedFile(file, fileName))
+    return false;
+
+  // Skip a header line, i.e., a first non-empty line that does not start with a number.
+  size_t begin = 0;
+  const char* last = file.data + file.size;
+  const char* current = file.data;
+  while (current != last && (isBlank(*current) || *current == '\n'))
+    ++current;
+  if (current != last && !((*current >= '0' && *current <= '9') || *current == '-' || *current == '+' ||
+                           *current == '.'))
+  {
+    const char* lineEnd = findLineEnd(current, last);
+    begin = (lineEnd == last) ? file.size : size_t(lineEnd - file.data) + 1;
+  }
+
+  numberOfThreads = resolveNumberOfThreads(numberOfThreads);
+  pointSeq.resize(indexChunks(file, begin, numberOfThreads, borders, firstRecords));
+  if (!parseChunks(file, fileName, RecordLayout::X_AND_Y_COORDINATES, borders, firstRecords, pointSeq))
+  {
+    pointSeq.clear();
+    return false;
+  }
+
+  return true;
+}
+
+// Method that writes a point sequence in the two-file layout into the files "xFileName" and "yFileName". Each
+// coordinate is written with "decimalPlaces" decimal places. A negative value of "decimalPlaces" selects the shortest
+// representation that is read back as the same value.
+bool writePointSequenceToTwoFiles(const PointSequence& pointSeq, const std::string& xFileName,
+                                  const std::string& yFileName, int decimalPlaces)
+{
+  size_t reservePerRecord = getReservePerCoordinate(decimalPlaces) + 1;
+  BufferedOutputFile xFile(xFileName, reservePerRecord), yFile(yFileName, reservePerRecord);
+
+  if (!xFile.isOpen() || !yFile.isOpen())
+    return false;
+
+  for (const Point& point : pointSeq)
+  {
+    char* position = formatNumber(xFile.reserve(), xFile.end(), point.x, decimalPlaces);
+    *position++ = '\n';
+    xFile.commit(position);
+
+    position = formatNumber(yFile.reserve(), yFile.end(), point.y, decimalPlaces);
+    *position++ = '\n';
+    yFile.commit(position);
+  }
+
+  bool xFileIsWritten = xFile.close();
+  bool yFileIsWritten = yFile.close();
+  return xFileIsWritten && yFileIsWritten;
+}
+
+// Method that writes a point sequence in the CSV layout into the file "fileName". Each coordinate is written with
+// "decimalPlaces" decimal places (see above).
+bool writePointSequenceToCSVFile(const PointSequence& pointSeq, const std::string& fileName, int decimalPlaces)
+{
+  BufferedOutputFile file(fileName, 2 * getReservePerCoordinate(decimalPlaces) + 2);
+
+  if (!file.isOpen())
+    return false;
+
+  for (const Point& point : pointSeq)
+  {
+    char* position = formatNumber(file.reserve(), file.end(), point.x, decimalPlaces);
+    *position++ = ',';
+    position = formatNumber(position, file.end(), point.y, decimalPlaces);
+    *position++ = '\n';
+    file.commit(position);
+  }
+
+  return file.close();
+}
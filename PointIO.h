@@ -0,0 +1,36 @@
+#ifndef POINTIO_H
+#define POINTIO_H
+
+
+#include <string>
+#include "PointHandler.h"
+
+// Two text layouts of point sequences are supported:
+// - The two-file layout (as written by "storeGeneratedPointsToFiles"): one file keeps the x-coordinates and another
+//   file keeps the y-coordinates, each with one coordinate per line. The i-th coordinates of both files form the i-th
+//   point.
+// - The CSV layout: a single file keeps one point per line as "x,y". An optional first line that does not start with
+//   a number (e.g., "x,y") is treated as a header and skipped.
+// In both layouts, empty lines and surrounding blanks are ignored. The readers map the input files into memory, split
+// them into newline-aligned chunks, and parse the chunks in parallel with "numberOfThreads" threads (0 means the
+// default number of threads). The writers format the coordinates into a large buffer and never flush per line. All
+// methods return "false" and print an error message if a file cannot be read or written or is malformed.
+
+// Method that reads a point sequence stored in the two-file layout from the files "xFileName" and "yFileName".
+bool readPointSequenceFromTwoFiles(const std::string& xFileName, const std::string& yFileName, PointSequence& pointSeq,
+                                   size_t numberOfThreads = 0);
+
+// Method that reads a point sequence stored in the CSV layout from the file "fileName".
+bool readPointSequenceFromCSVFile(const std::string& fileName, PointSequence& pointSeq, size_t numberOfThreads = 0);
+
+// Method that writes a point sequence in the two-file layout into the files "xFileName" and "yFileName". Each
+// coordinate is written with "decimalPlaces" decimal places. A negative value of "decimalPlaces" selects the shortest
+// representation that is read back as the same value.
+bool writePointSequenceToTwoFiles(const PointSequence& pointSeq, const std::string& xFileName,
+                                  const std::string& yFileName, int decimalPlaces = 2);
+
+// Method that writes a point sequence in the CSV layout into the file "fileName". Each coordinate is written with
+// "decimalPlaces" decimal places (see above).
+bool writePointSequenceToCSVFile(const PointSequence& pointSeq, const std::string& fileName, int decimalPlaces = 2);
+
+#endif // POINTIO_H
@@ -0,0 +1,303 @@
+
+#include <algorithm>    // std::min, std::max
+#include <atomic>
+#include <cstdint>
+#include <cstring>      // std::memcpy
+#include <limits>
+#include <vector>
+#include "Number.h"
+#include "ParallelExecution.h"
+#include "PointHandler.h"
+#include "PointSequenceDuplicates.h"
+
+//++++++++++++++++++++++++
+// Local data and methods
+//++++++++++++++++++++++++
+
+// Minimal number of points per thread. Smaller point sequences are searched by fewer threads.
+constexpr size_t MIN_POINTS_PER_THREAD = size_t(1) << 14;
+
+// Average number of points per bucket that the choice of the number of buckets aims at.
+constexpr size_t TARGET_POINTS_PER_BUCKET = size_t(1) << 10;
+
+// Bounds for the number of bits of a bucket number and for the number of histogram entries (buckets times threads).
+constexpr unsigned MIN_BUCKET_BITS = 4;
+constexpr unsigned MAX_BUCKET_BITS = 20;
+constexpr size_t MAX_HISTOGRAM_ENTRIES = size_t(1) << 22;
+
+// Number of buckets that a thread takes at once when buckets are processed.
+constexpr size_t BUCKETS_PER_GRAB = 16;
+
+static_assert(sizeof(Number) <= sizeof(uint64_t), "Coordinates must fit into 64 bits to be hashed.");
+
+// Method that returns the bit pattern of a coordinate. The value -0.0 is mapped to the bit pattern of 0.0 since both
+// values are equal.
+static inline uint64_t getBitPattern(Number coordinate)
+{
+  uint64_t bits = 0;
+
+  if (coordinate == 0)
+    coordinate = 0;
+  std::memcpy(&bits, &coordinate, sizeof(Number));
+  return bits;
+}
+
+// Method that returns a 64-bit hash value of the coordinates of point "p". The leading bits select the bucket and the
+// trailing bits the slot in the hash table of the bucket.
+static inline uint64_t hashPoint(const Point& p)
+{
+  uint64_t hash = getBitPattern(p.x) * 0x9E3779B97F4A7C15ULL ^ getBitPattern(p.y);
+
+  // Finalizer of SplitMix64.
+  hash = (hash ^ (hash >> 30)) * 0xBF58476D1CE4E5B9ULL;
+  hash = (hash ^ (hash >> 27)) * 0x94D049BB133111EBULL;
+  return hash ^ (hash >> 31);
+}
+
+// Method that returns the smallest power of two that is larger than or equal to "value".
+static size_t getCeilingPowerOfTwo(size_t value)
+{
+  size_t power = 1;
+
+  while (power < value)
+    power <<= 1;
+  return power;
+}
+
+// Method that searches duplicates in the point sequence "pointSeq" with the index type "Index". If "duplicateBits" is
+// not nullptr, the bit of each point that is equal to a point with a smaller index is set there. If
+// "stopAtFirstDuplicate" is true, the search stops as soon as a duplicate is found. It returns the number of found
+// duplicates.
+template <typename Index>
+static size_t searchDuplicates(const PointSequence& pointSeq, std::vector<std::atomic<uint64_t>>* duplicateBits,
+                               bool stopAtFirstDuplicate, DuplicateSearchStatistics& statistics, size_t memoryLimit,
+                               size_t numberOfThreads)
+{
+  constexpr Index EMPTY_SLOT = std::numeric_limits<Index>::max();
+  size_t numberOfPoints = pointSeq.size();
+
+  // Determine the number of threads and the number of buckets.
+  numberOfThreads = std::min(resolveNumberOfThreads(numberOfThreads),
+                             std::max(size_t(1), numberOfPoints / MIN_POINTS_PER_THREAD));
+  unsigned bucketBits = MIN_BUCKET_BITS;
+  while (bucketBits < MAX_BUCKET_BITS && (size_t(1) << bucketBits) * TARGET_POINTS_PER_BUCKET < numberOfPoints &&
+         (size_t(2) << bucketBits) * numberOfThreads <= MAX_HISTOGRAM_ENTRIES)
+    ++bucketBits;
+  size_t numberOfBuckets = size_t(1) << bucketBits;
+
+  // Determine the number of passes. Only the memory for the point indexes depends on the number of passes. The other
+  // auxiliary memory (histograms, bucket borders, hash tables, and duplicate bits) is estimated as fixed memory.
+  size_t expectedTableSize = 2 * getCeilingPowerOfTwo(2 * TARGET_POINTS_PER_BUCKET);
+  size_t fixedMemory = (numberOfThreads + 1) * numberOfBuckets * sizeof(size_t) +
+                       numberOfThreads * expectedTableSize * sizeof(Index) +
+                       ((duplicateBits != nullptr) ? duplicateBits->size() * sizeof(uint64_t) : 0);
+  size_t indexMemory = numberOfPoints * sizeof(Index);
+  size_t numberOfPasses = 1;
+  if (memoryLimit > 0 && fixedMemory + indexMemory > memoryLimit)
+  {
+    size_t availableMemory = (memoryLimit > fixedMemory) ? memoryLimit - fixedMemory : 1;
+    numberOfPasses = std::min(numberOfBuckets, (indexMemory + availableMemory - 1) / availableMemory);
+  }
+  size_t bucketsPerPass = (numberOfBuckets + numberOfPasses - 1) / numberOfPasses;
+  numberOfPasses = (numberOfBuckets + bucketsPerPass - 1) / bucketsPerPass;
+
+  std::atomic<size_t> numberOfDuplicates(0);
+  std::atomic<bool> stopSearch(false);
+  std::vector<size_t> tableMemory(numberOfThreads, 0);
+  size_t peakAuxiliaryMemory = 0, pass = 0;
+
+  for (; pass < numberOfPasses && !stopSearch.load(); ++pass)
+  {
+    size_t firstBucket = pass * bucketsPerPass;
+    size_t numberOfPassBuckets = std::min(bucketsPerPass, numberOfBuckets - firstBucket);
+
+    // Step 1: Each thread counts the points of its part of the point sequence per bucket of this pass. The counts
+    // are stored bucket by bucket and, within a bucket, thread by thread.
+    std::vector<size_t> counts(numberOfPassBuckets * numberOfThreads + 1, 0);
+    runInParallel(numberOfThreads, [&](size_t thread)
+    {
+      std::vector<size_t> localCounts(numberOfPassBuckets, 0);
+      size_t last = getPartBegin(numberOfPoints, numberOfThreads, thread + 1);
+      for (size_t i = getPartBegin(numberOfPoints, numberOfThreads, thread); i < last; ++i)
+      {
+        size_t bucket = size_t(hashPoint(pointSeq[i]) >> (64 - bucketBits)) - firstBucket;
+        if (bucket < numberOfPassBuckets)
+          ++localCounts[bucket];
+      }
+      for (size_t bucket = 0; bucket < numberOfPassBuckets; ++bucket)
+        counts[bucket * numberOfThreads + thread] = localCounts[bucket];
+    });
+
+    // Step 2: Turn the counts into the positions where the threads store the indexes of their points. Since the
+    // threads process consecutive parts of the point sequence, the indexes within each bucket are increasing.
+    size_t position = 0;
+    for (size_t& count : counts)
+    {
+      size_t numberOfIndexes = count;
+      count = position;
+      position += numberOfIndexes;
+    }
+    std::vector<Index> indexes(position);
+
+    runInParallel(numberOfThreads, [&](size_t thread)
+    {
+      std::vector<size_t> positions(numberOfPassBuckets);
+      for (size_t bucket = 0; bucket < numberOfPassBuckets; ++bucket)
+        positions[bucket] = counts[bucket * numberOfThreads + thread];
+      size_t last = getPartBegin(numberOfPoints, numberOfThreads, thread + 1);
+      for (size_t i = getPartBegin(numberOfPoints, numberOfThreads, thread); i < last; ++i)
+      {
+        size_t bucket = size_t(hashPoint(pointSeq[i]) >> (64 - bucketBits)) - firstBucket;
+        if (bucket < numberOfPassBuckets)
+          indexes[positions[bucket]++] = Index(i);
+      }
+    });
+
+    // Step 3: The threads take buckets and insert their points into a hash table. A point that is equal to a point
+    // already in the table is a duplicate. Since the indexes within a bucket are increasing, the first occurrence of
+    // each point is never marked as a duplicate.
+    std::atomic<size_t> nextBucket(0);
+    runInParallel(numberOfThreads, [&](size_t thread)
+    {
+      std::vector<Index> table;
+      size_t localNumberOfDuplicates = 0;
+
+      while (!stopSearch.load(std::memory_order_relaxed))
+      {
+        size_t bucket = nextBucket.fetch_add(BUCKETS_PER_GRAB), pastBucket = bucket + BUCKETS_PER_GRAB;
+        if (bucket >= numberOfPassBuckets)
+          break;
+        if (pastBucket > numberOfPassBuckets)
+          pastBucket = numberOfPassBuckets;
+
+        for (; bucket < pastBucket; ++bucket)
+        {
+          size_t first = counts[bucket * numberOfThreads], past = counts[(bucket + 1) * numberOfThreads];
+          if (past - first < 2)
+            continue;
+
+          size_t tableSize = getCeilingPowerOfTwo(2 * (past - first)), mask = tableSize - 1;
+          table.assign(tableSize, EMPTY_SLOT);
+          for (size_t k = first; k < past; ++k)
+          {
+            const Point& point = pointSeq[indexes[k]];
+            size_t slot = size_t(hashPoint(point)) & mask;
+            while (table[slot] != EMPTY_SLOT && pointSeq[table[slot]] != point)
+              slot = (slot + 1) & mask;
+
+            if (table[slot] == EMPTY_SLOT)
+              table[slot] = indexes[k];
+            else
+            {
+              ++localNumberOfDuplicates;
+              if (duplicateBits != nullptr)
+                (*duplicateBits)[indexes[k] / 64].fetch_or(uint64_t(1) << (indexes[k] % 64),
+                                                           std::memory_order_relaxed);
+              if (stopAtFirstDuplicate)
+              {
+                stopSearch.store(true, std::memory_order_relaxed);
+                break;
+              }
+            }
+          }
+          if (stopSearch.load(std::memory_order_relaxed))
+            break;
+        }
+      }
+
+      numberOfDuplicates.fetch_add(localNumberOfDuplicates);
+      tableMemory[thread] = std::max(tableMemory[thread], table.capacity() * sizeof(Index));
+    });
+
+    // Account the auxiliary memory of this pass.
+    size_t passMemory = counts.capacity() * sizeof(size_t) + indexes.capacity() * sizeof(Index) +
+                        numberOfThreads * numberOfPassBuckets * sizeof(size_t) +
+                        ((duplicateBits != nullptr) ? duplicateBits->size() * sizeof(uint64_t) : 0);
+    for (size_t memory : tableMemory)
+      passMemory += memory;
+    peakAuxiliaryMemory = std::max(peakAuxiliaryMemory, passMemory);
+  }
+
+  statistics.numberOfPoints = numberOfPoints;
+  statistics.numberOfDuplicates = numberOfDuplicates.load();
+  statistics.numberOfPasses = pass;
+  statistics.peakAuxiliaryMemory = peakAuxiliaryMemory;
+  return statistics.numberOfDuplicates;
+}
+
+// Method that dispatches the duplicate search to the smallest index type that can index all points of "pointSeq".
+static size_t searchDuplicates(const PointSequence& pointSeq, std::vector<std::atomic<uint64_t>>* duplicateBits,
+                               bool stopAtFirstDuplicate, DuplicateSearchStatistics& statistics, size_t memoryLimit,
+                               size_t numberOfThreads)
+{
+  if (pointSeq.size() < std::numeric_limits<uint32_t>::max())
+    return searchDuplicates<uint32_t>(pointSeq, duplicateBits, stopAtFirstDuplicate, statistics, memoryLimit,
+                                      numberOfThreads);
+  else
+    return searchDuplicates<uint64_t>(pointSeq, duplicateBits, stopAtFirstDuplicate, statistics, memoryLimit,
+                                      numberOfThreads);
+}
+
+//+++++++++++++++
+// Public methods
+//+++++++++++++++
+
+// Method that checks whether a point sequence contains duplicates using "numberOfThreads" threads (0 means the default
+// number of threads). If "memoryLimit" is positive, the auxiliary memory is kept below "memoryLimit" bytes as far as
+// possible. If "statistics" is not nullptr, the statistics of the search are stored there.
+bool PointSequenceContainsDuplicatesInParallel(const PointSequence& pointSeq, DuplicateSearchStatistics* statistics,
+                                               size_t memoryLimit, size_t numberOfThreads)
+{
+  DuplicateSearchStatistics localStatistics;
+
+  if (statistics == nullptr)
+    statistics = &localStatistics;
+
+  return searchDuplicates(pointSeq, nullptr, true, *statistics, memoryLimit, numberOfThreads) > 0;
+}
+
+// Method that removes all duplicates from a point sequence in place. The first occurrence of each point is kept and
+// the relative order of the kept points is preserved. The method returns the number of removed points. The parameters
+// "statistics", "memoryLimit", and "numberOfThreads" have the same meaning as above.
+size_t removeDuplicatesFromPointSequence(PointSequence& pointSeq, DuplicateSearchStatistics* statistics,
+                                         size_t memoryLimit, size_t numberOfThreads)
+{
+  DuplicateSearchStatistics localStatistics;
+  size_t numberOfPoints = pointSeq.size();
+  std::vector<std::atomic<uint64_t>> duplicateBits((numberOfPoints + 63) / 64);
+
+  if (statistics == nullptr)
+    statistics = &localStatistics;
+
+  for (std::atomic<uint64_t>& bits : duplicateBits)
+    bits.store(0, std::memory_order_relaxed);
+  if (searchDuplicates(pointSeq, &duplicateBits, false, *statistics, memoryLimit, numberOfThreads) == 0)
+    return 0;
+
+  // Each thread moves the kept points of its part of the point sequence to the beginning of its part. Afterwards, the
+  // parts are moved together one after the other.
+  numberOfThreads = std::min(resolveNumberOfThreads(numberOfThreads),
+                             std::max(size_t(1), numberOfPoints / MIN_POINTS_PER_THREAD));
+  std::vector<size_t> numberOfKeptPoints(numberOfThreads);
+  runInParallel(numberOfThreads, [&](size_t thread)
+  {
+    size_t first = getPartBegin(numberOfPoints, numberOfThreads, thread);
+    size_t last = getPartBegin(numberOfPoints, numberOfThreads, thread + 1);
+    size_t target = first;
+    for (size_t i = first; i < last; ++i)
+      if ((duplicateBits[i / 64].load(std::memory_order_relaxed) & (uint64_t(1) << (i % 64))) == 0)
+        pointSeq[target++] = pointSeq[i];
+    numberOfKeptPoints[thread] = target - first;
+  });
+
+  size_t target = numberOfKeptPoints[0];
+  for (size_t thread = 1; thread < numberOfThreads; ++thread)
+  {
+    PointSequence::iterator first = pointSeq.begin() + getPartBegin(numberOfPoints, numberOfThreads, thread);
+    std::move(first, first + numberOfKeptPoints[thread], pointSeq.begin() + target);
+    target += numberOfKeptPoints[thread];
+  }
+  pointSeq.resize(target);
+
+  return numberOfPoints - target;
+}
@@ -0,0 +1,47 @@
+#ifndef POINTSEQUENCEDUPLICATES_H
+#define POINTSEQUENCEDUPLICATES_H
+
+
+#include <cstddef>
+#include "PointHandler.h"
+
+// The methods of this file find duplicates in a point sequence without sorting or copying it. Each point is hashed
+// by the bit patterns of its coordinates (with -0.0 treated as 0.0). In a radix pass, the threads distribute the
+// indexes of the points into buckets by the leading bits of their hash values. Then each thread processes whole
+// buckets with a small open addressing hash table and compares the points of equal hash values coordinate-wise, so
+// hash collisions never lead to wrong results. Points with NaN coordinates are never duplicates since they are not
+// equal to any point.
+//
+// The auxiliary memory consists of one index (4 bytes for less than 2^32 points, 8 bytes otherwise) per point, the
+// bucket histograms, and one hash table per thread; the deduplicator additionally needs one bit per point. If a
+// memory limit is given, the hash value range is split into several passes such that only the indexes of the points
+// of one pass are kept at a time (the input is read once per pass).
+
+// Type that keeps the statistics of a duplicate search.
+struct DuplicateSearchStatistics
+{
+  // Number of points of the searched point sequence.
+  size_t numberOfPoints = 0;
+  // Number of points that are equal to a point with a smaller index. The detector stops at the first duplicate found
+  // and then only reports a lower bound.
+  size_t numberOfDuplicates = 0;
+  // Number of passes over the point sequence.
+  size_t numberOfPasses = 0;
+  // Peak number of bytes of auxiliary memory allocated by the search.
+  size_t peakAuxiliaryMemory = 0;
+};
+
+// Method that checks whether a point sequence contains duplicates using "numberOfThreads" threads (0 means the default
+// number of threads). If "memoryLimit" is positive, the auxiliary memory is kept below "memoryLimit" bytes as far as
+// possible. If "statistics" is not nullptr, the statistics of the search are stored there.
+bool PointSequenceContainsDuplicatesInParallel(const PointSequence& pointSeq,
+                                               DuplicateSearchStatistics* statistics = nullptr,
+                                               size_t memoryLimit = 0, size_t numberOfThreads = 0);
+
+// Method that removes all duplicates from a point sequence in place. The first occurrence of each point is kept and
+// the relative order of the kept points is preserved. The method returns the number of removed points. The parameters
+// "statistics", "memoryLimit", and "numberOfThreads" have the same meaning as above.
+size_t removeDuplicatesFromPointSequence(PointSequence& pointSeq, DuplicateSearchStatistics* statistics = nullptr,
+                                         size_t memoryLimit = 0, size_t numberOfThreads = 0);
+
+#endif // POINTSEQUENCEDUPLICATES_H
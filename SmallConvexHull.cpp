@@ -0,0 +1,23 @@
+
+#include <algorithm>
+#include <atomic>
+#include "SmallConvexHull.h"
+
+// Number of points up to which the convex hull algorithms call the small convex hull kernels.
+static std::atomic<size_t> smallConvexHullThreshold(DEFAULT_SMALL_CONVEX_HULL_THRESHOLD);
+
+//+++++++++++++++++++++++++++++++
+// Threshold of the small kernels
+//+++++++++++++++++++++++++++++++
+
+// Method that returns the number of points up to which the convex hull algorithms call the kernels.
+size_t getSmallConvexHullThreshold()
+{
+  return smallConvexHullThreshold.load(std::memory_order_relaxed);
+}
+
+// Method that sets the number of points up to which the convex hull algorithms call the kernels.
+void setSmallConvexHullThreshold(size_t threshold)
+{
+  smallConvexHullThreshold.store(std::min(threshold, MAXIMAL_SIZE_OF_SMALL_CONVEX_HULL), std::memory_order_relaxed);
+}
@@ -0,0 +1,217 @@
+#ifndef SMALLCONVEXHULL_H
+#define SMALLCONVEXHULL_H
+
+
+#include <algorithm>
+#include <cstddef>
+#include <iterator>
+#include <utility>
+#include <vector>
+#include "HullStatistics.h"
+#include "OrientationPredicates.h"
+
+// The small convex hull kernels compute the convex hull of a point sequence with at most 64 points. For such point
+// sequences, the general algorithms spend more time on their machinery (the scan of the point sequence, the
+// recursion, and the partitions) than on the geometry. The kernels keep the indexes of the points in buffers on the
+// stack and allocate nothing: they drop the points inside of the quadrilateral of the four extreme points, split the
+// others into the points below and above the line through the lexicographically smallest and largest point, sort
+// both parts by insertion sort, and compute the lower and the upper hull by Andrew's monotone chain. The size of the
+// buffers is a template parameter; the kernels are instantiated for the size classes 8, 16, 32, and 64, so that a
+// small point sequence uses buffers that fit its size.
+//
+// The result fulfills the contract of the algorithms (see "ConvexHullQuickHull.h"): the orientation tests that drop
+// duplicates and collinear boundary points are made with the orientation policy within the bounding box of the
+// points, so that the exact orientation policies give exact results. All convex hull algorithms call the kernels
+// automatically for point sequences with at most "getSmallConvexHullThreshold()" points.
+
+// Maximal number of points of the point sequences that the kernels process.
+constexpr size_t MAXIMAL_SIZE_OF_SMALL_CONVEX_HULL = 64;
+
+// Default number of points up to which the algorithms call the kernels. Measured with "BatchHullBenchmark
+// --latency" on uniformly distributed points, the kernels halve the median latency of the algorithms for 8 to 32
+// points and still lower it by about 15% for 64 points.
+constexpr size_t DEFAULT_SMALL_CONVEX_HULL_THRESHOLD = MAXIMAL_SIZE_OF_SMALL_CONVEX_HULL;
+
+// Methods that return and set the number of points up to which the convex hull algorithms call the kernels. The value
+// 0 disables the kernels (e.g., to compare the algorithms with and without them); values above the maximal size are
+// reduced to it.
+size_t getSmallConvexHullThreshold();
+void setSmallConvexHullThreshold(size_t threshold);
+
+//**********************************
+// Kernels of the small convex hulls
+//**********************************
+
+// Method that checks whether the point "p" is lexicographically smaller than the point "q". Unlike the comparison
+// operator of "Point", it is inlined.
+template <typename PointType>
+inline bool isLexicographicallySmaller(const PointType& p, const PointType& q)
+{
+  return p.x < q.x || (p.x == q.x && p.y < q.y);
+}
+
+// Method that sorts the "m" indexes "order" of the points "points" by insertion sort such that "isBefore" holds for no
+// pair of an index and a preceding one.
+template <typename PointType, typename Comparison>
+inline void sortSmallConvexHullCandidates(const PointType* points, unsigned char* order, size_t m, Comparison isBefore)
+{
+  for (size_t i = 1; i < m; ++i)
+  {
+    unsigned char index = order[i];
+    size_t j = i;
+    for (; j > 0 && isBefore(points[index], points[order[j - 1]]); --j)
+      order[j] = order[j - 1];
+    order[j] = index;
+  }
+}
+
+// Method that appends the chain of the candidates "order[0]", ..., "order[m - 1]" and of the point with the index
+// "end" to the hull "hull" of "h" indexes. A candidate that does not make a strict left turn with the last two
+// vertices removes the last vertex, but the first "fixedSize" vertices are never removed.
+template <typename OrientationPolicy>
+inline size_t appendSmallConvexHullChain(const typename OrientationPolicy::PointType* points,
+                                         const unsigned char* order, size_t m, unsigned char end, unsigned char* hull,
+                                         size_t h, size_t fixedSize)
+{
+  for (size_t i = 0; i <= m; ++i)
+  {
+    unsigned char index = (i < m) ? order[i] : end;
+    while (h > fixedSize && OrientationPolicy::orientation(points[hull[h - 2]], points[hull[h - 1]], points[index]) !=
+                            Orientation::COUNTERCLOCKWISE)
+      --h;
+    hull[h++] = index;
+  }
+
+  return h;
+}
+
+// Method that computes the convex hull of the "n" <= "Capacity" points "points" and stores the indexes of its
+// vertices in counterclockwise order, beginning with the lexicographically smallest one, in "hull" (which has room
+// for "Capacity" + 1 indexes). It returns the number of vertices, which is 0 if the points do not fulfill the minimal
+// requirements.
+template <typename OrientationPolicy, size_t Capacity>
+size_t computeSmallConvexHullIndexes(const typename OrientationPolicy::PointType* points, size_t n,
+                                     unsigned char* hull)
+{
+  static_assert(Capacity <= MAXIMAL_SIZE_OF_SMALL_CONVEX_HULL, "The indexes of the points must fit into a byte.");
+  using PointType = typename OrientationPolicy::PointType;
+  RECORD_HULL_SUBPROBLEM(n);
+
+  if (n < 3)
+    return 0;
+
+  // Find the lexicographically smallest and largest point, the lowest and the highest point, and the bounding box.
+  size_t left = 0, right = 0, bottom = 0, top = 0;
+  PointType minCorner = points[0], maxCorner = points[0];
+  for (size_t i = 1; i < n; ++i)
+  {
+    left = isLexicographicallySmaller(points[i], points[left]) ? i : left;
+    right = isLexicographicallySmaller(points[i], points[right]) ? right : i;
+    bottom = (points[i].y < points[bottom].y) ? i : bottom;
+    top = (points[i].y > points[top].y) ? i : top;
+    minCorner.x = std::min(minCorner.x, points[i].x);
+    minCorner.y = std::min(minCorner.y, points[i].y);
+    maxCorner.x = std::max(maxCorner.x, points[i].x);
+    maxCorner.y = std::max(maxCorner.y, points[i].y);
+  }
+  typename OrientationPolicy::BoundingBoxScope boundingBoxScope(minCorner, maxCorner);
+
+  // Collect the candidates below and above the segment from the smallest to the largest point without branches. The
+  // points on the segment and the points strictly inside of the quadrilateral of the four points (Akl and Toussaint)
+  // are no vertices and are dropped.
+  const PointType &leftPoint = points[left], &bottomPoint = points[bottom], &rightPoint = points[right],
+                  &topPoint = points[top];
+  unsigned char lowerOrder[Capacity], upperOrder[Capacity];
+  size_t lowerSize = 0, upperSize = 0;
+  for (size_t i = 0; i < n; ++i)
+  {
+    const PointType& point = points[i];
+    Orientation side = OrientationPolicy::orientation(leftPoint, rightPoint, point);
+    bool isInside = (OrientationPolicy::orientation(leftPoint, bottomPoint, point) == Orientation::COUNTERCLOCKWISE) &
+                    (OrientationPolicy::orientation(bottomPoint, rightPoint, point) == Orientation::COUNTERCLOCKWISE) &
+                    (OrientationPolicy::orientation(rightPoint, topPoint, point) == Orientation::COUNTERCLOCKWISE) &
+                    (OrientationPolicy::orientation(topPoint, leftPoint, point) == Orientation::COUNTERCLOCKWISE);
+    lowerOrder[lowerSize] = upperOrder[upperSize] = static_cast<unsigned char>(i);
+    lowerSize += (side == Orientation::CLOCKWISE) & ! isInside;
+    upperSize += (side == Orientation::COUNTERCLOCKWISE) & ! isInside;
+  }
+
+  // Sort the lower candidates from left to right and the upper ones from right to left. Insertion sort beats
+  // "std::sort" for all sizes of the kernels, since it makes no calls and the comparisons are inlined.
+  sortSmallConvexHullCandidates(points, lowerOrder, lowerSize, isLexicographicallySmaller<PointType>);
+  sortSmallConvexHullCandidates(points, upperOrder, upperSize, [](const PointType& p, const PointType& q)
+  {
+    return isLexicographicallySmaller(q, p);
+  });
+
+  // Compute the lower hull from the smallest to the largest point and the upper hull back to the smallest point,
+  // which ends the hull again. If all points are collinear, only these two points remain.
+  hull[0] = static_cast<unsigned char>(left);
+  size_t h = appendSmallConvexHullChain<OrientationPolicy>(points, lowerOrder, lowerSize,
+                                                           static_cast<unsigned char>(right), hull, 1, 1);
+  h = appendSmallConvexHullChain<OrientationPolicy>(points, upperOrder, upperSize, static_cast<unsigned char>(left),
+                                                    hull, h, h);
+
+  return (h > 3) ? h - 1 : 0;
+}
+
+// Method that calls the kernel of the smallest size class of the "n" <= "MAXIMAL_SIZE_OF_SMALL_CONVEX_HULL" points
+// "points".
+template <typename OrientationPolicy>
+size_t computeSmallConvexHullIndexes(const typename OrientationPolicy::PointType* points, size_t n,
+                                     unsigned char* hull)
+{
+  if (n <= 8)
+    return computeSmallConvexHullIndexes<OrientationPolicy, 8>(points, n, hull);
+  if (n <= 16)
+    return computeSmallConvexHullIndexes<OrientationPolicy, 16>(points, n, hull);
+  if (n <= 32)
+    return computeSmallConvexHullIndexes<OrientationPolicy, 32>(points, n, hull);
+
+  return computeSmallConvexHullIndexes<OrientationPolicy, MAXIMAL_SIZE_OF_SMALL_CONVEX_HULL>(points, n, hull);
+}
+
+// Method that computes the convex hull of the point sequence "pointSeq" with at most
+// "MAXIMAL_SIZE_OF_SMALL_CONVEX_HULL" points and stores it in "convexHull" (see "ConvexHullQuickHull").
+template <typename OrientationPolicy, typename Allocator>
+void computeSmallConvexHull(const std::vector<typename OrientationPolicy::PointType, Allocator>& pointSeq,
+                            std::vector<typename OrientationPolicy::PointType>& convexHull)
+{
+  unsigned char hull[MAXIMAL_SIZE_OF_SMALL_CONVEX_HULL + 1];
+  size_t h = computeSmallConvexHullIndexes<OrientationPolicy>(pointSeq.data(), pointSeq.size(), hull);
+
+  convexHull.clear();
+  convexHull.reserve(h);
+  for (size_t k = 0; k < h; ++k)
+    convexHull.push_back(pointSeq[hull[k]]);
+}
+
+// Method that computes the convex hull of the point sequence "pointSeq" with at most
+// "MAXIMAL_SIZE_OF_SMALL_CONVEX_HULL" points in place (see "ConvexHullInPlaceQuickHull"). The vertices are swapped to
+// the beginning of the point sequence one after another; the positions of the points are tracked in two arrays, so
+// that the point sequence remains a permutation of the points.
+template <typename OrientationPolicy, typename Allocator>
+typename std::vector<typename OrientationPolicy::PointType, Allocator>::iterator computeSmallConvexHullInPlace(
+  std::vector<typename OrientationPolicy::PointType, Allocator>& pointSeq)
+{
+  unsigned char hull[MAXIMAL_SIZE_OF_SMALL_CONVEX_HULL + 1];
+  unsigned char positionOfPoint[MAXIMAL_SIZE_OF_SMALL_CONVEX_HULL], pointAtPosition[MAXIMAL_SIZE_OF_SMALL_CONVEX_HULL];
+  size_t n = pointSeq.size(), h = computeSmallConvexHullIndexes<OrientationPolicy>(pointSeq.data(), n, hull);
+
+  for (size_t i = 0; i < n; ++i)
+    positionOfPoint[i] = pointAtPosition[i] = static_cast<unsigned char>(i);
+  for (size_t k = 0; k < h; ++k)
+  {
+    unsigned char vertex = hull[k], position = positionOfPoint[vertex], displacedPoint = pointAtPosition[k];
+    COUNT_HULL_OPERATION(SWAPS);
+    std::swap(pointSeq[k], pointSeq[position]);
+    pointAtPosition[position] = displacedPoint;
+    positionOfPoint[displacedPoint] = position;
+    pointAtPosition[k] = vertex;
+    positionOfPoint[vertex] = static_cast<unsigned char>(k);
+  }
+
+  return pointSeq.begin() + h;
+}
+
+#endif // SMALLCONVEXHULL_H
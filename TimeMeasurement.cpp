@@ -6,7 +6,8 @@
 #include <cmath>
 #include <fstream>
 #include <list>
-#include <numeric>  // std::accumulate
+#include <limits>
+#include <random>
 #include <sstream>
 #include <string>
 #include <vector>
@@ -16,104 +17,209 @@
 // Data structures
 //++++++++++++++++
 
-// Data structure for keeping Timer objects
-struct Timer::TimerImplementation
+struct TimeDurationSeries::TimeDurationSeriesImplementation
 {
-  std::chrono::steady_clock::time_point startTime;
-  std::chrono::steady_clock::time_point stopTime;
-  bool running;
+  std::vector<std::chrono::nanoseconds> series;
+  // Running statistics (Welford's method): mean and sum of the squared deviations from the mean in nanoseconds.
+  double mean = 0;
+  double sumOfSquaredDeviations = 0;
+  std::chrono::nanoseconds minimum = std::chrono::nanoseconds::max();
+  std::chrono::nanoseconds maximum = std::chrono::nanoseconds::min();
+  // Sorted copy of "series" for the order statistics.
+  bool sortedSeriesIsUpToDate = false;
+  std::vector<std::chrono::nanoseconds> sortedSeries;
 };
 
-struct TimeDuration::TimeDurationImplementation
-{
-  std::chrono::steady_clock::duration elapsedTime;
+// State of the sampling of the runtimes of an algorithm for a number of elements.
+struct SamplingState
+{
+  size_t numberOfWarmupRuns = 0;
+  // Sum of the durations of the warmup runs and the sampled runs.
+  std::chrono::nanoseconds consumedTime = std::chrono::nanoseconds::zero();
+  // Number of sampled runs at which the confidence interval is checked next.
+  size_t numberOfRunsAtNextCheck = 0;
+  StoppingReason stoppingReason = StoppingReason::NOT_STOPPED;
+  // Flag that indicates whether the duration added last belongs to a warmup run.
+  bool lastRunIsWarmupRun = false;
 };
 
-struct TimeDurationSeries::TimeDurationSeriesImplementation
+// Values of a metric of the runs of an algorithm for a number of elements.
+struct MetricSeries
 {
-  std::vector<std::chrono::steady_clock::duration> series;
-  bool meanDurationIsUpToDate = false;
-  std::chrono::steady_clock::duration meanDuration = std::chrono::steady_clock::duration::zero();
-  bool varianceDurationIsUpToDate = false;
-  std::chrono::steady_clock::duration varianceDuration = std::chrono::steady_clock::duration::zero();
-  bool standardDeviationIsUpToDate = false;
-  std::chrono::steady_clock::duration standardDeviationDuration = std::chrono::steady_clock::duration::zero();
+  std::string name;
+  std::vector<double> values;
 };
 
 struct AlgorithmRuntimesForTheSameNumberOfElements
 {
   size_t numberOfElements;
   std::vector<TimeDurationSeries> series;
+  std::vector<SamplingState> samplingStates;
+  std::vector<std::vector<MetricSeries>> metrics;
 };
 
 struct AlgorithmRuntimeManager::AlgorithmRuntimeManagerImplementation
 {
   std::list<AlgorithmRuntimesForTheSameNumberOfElements> runTimes;
+  SamplingParameters samplingParameters;
 };
 
+//++++++++++++++
+// Local methods
+//++++++++++++++
 
-//+++++++++++++++++++
-// Class TimeDuration
-//+++++++++++++++++++
+// Method that returns the number of nanoseconds of the base time unit "unit".
+static int64_t getNanosecondsPerUnit(const BaseTimeUnit& unit)
+{
+  switch(unit)
+  {
+    case BaseTimeUnit::NANOSECONDS  : return 1;
+    case BaseTimeUnit::MICROSECONDS : return 1000;
+    case BaseTimeUnit::MILLISECONDS : return 1000000;
+    case BaseTimeUnit::SECONDS      : return 1000000000;
+  }
+
+  return 1;
+}
+
+// Method that writes a duration of "nanoseconds" nanoseconds with respect to the base time unit "unit" with six
+// decimal places (as "std::fixed" does) into the stream "stream". The digits are computed in integer arithmetic so
+// that no precision is lost for long durations.
+static void writeDuration(std::ostream& stream, int64_t nanoseconds, const BaseTimeUnit& unit)
+{
+  const int64_t DECIMAL_PLACES_MULTIPLIER = 1000000;
+  int64_t nanosecondsPerUnit = getNanosecondsPerUnit(unit);
+  uint64_t absoluteNanoseconds = (nanoseconds < 0) ? 0 - uint64_t(nanoseconds) : uint64_t(nanoseconds);
+  uint64_t integerPart = absoluteNanoseconds / nanosecondsPerUnit;
+  // Round the fractional part to six decimal places; a carry goes to the integer part.
+  uint64_t fractionalPart = ((absoluteNanoseconds % nanosecondsPerUnit) * DECIMAL_PLACES_MULTIPLIER +
+                             nanosecondsPerUnit / 2) / nanosecondsPerUnit;
+  if (fractionalPart == uint64_t(DECIMAL_PLACES_MULTIPLIER))
+  {
+    ++integerPart;
+    fractionalPart = 0;
+  }
 
-// Default constructor that creates and initializes a TimeDuration object.
-TimeDuration::TimeDuration()
+  if (nanoseconds < 0)
+    stream << "-";
+  stream << integerPart << "." << std::setw(6) << std::setfill('0') << fractionalPart << std::setfill(' ');
+}
+
+// Seed of the random number generator that draws the bootstrap resamples.
+static const uint64_t BOOTSTRAP_SEED = 20190601;
+
+// Method that converts the number of nanoseconds "nanoseconds" into a duration. The number is rounded and saturates
+// at the limits of the duration type.
+static std::chrono::nanoseconds roundToNanoseconds(double nanoseconds)
 {
-  timeDurationHandle = new TimeDurationImplementation;
-  timeDurationHandle->elapsedTime = std::chrono::steady_clock::duration::zero();
+  if (!(nanoseconds < double(std::numeric_limits<int64_t>::max())))
+    return std::chrono::nanoseconds::max();
+  if (nanoseconds < double(std::numeric_limits<int64_t>::min()))
+    return std::chrono::nanoseconds::min();
+  return std::chrono::nanoseconds(std::llround(nanoseconds));
 }
 
-//Copy constructor that copies the TimeDuration object "rhs" to the current TimeDuration object.
-TimeDuration::TimeDuration(const TimeDuration& rhs)
+// Method that calculates the percentile "percentage" (between 0 and 100) of the sorted durations "sortedDurations" in
+// nanoseconds. Between the closest ranks, it interpolates linearly. The durations must not be empty.
+static double calculatePercentileOfSortedDurations(const std::vector<std::chrono::nanoseconds>& sortedDurations,
+                                                   double percentage)
 {
-  timeDurationHandle = new TimeDurationImplementation;
-  *timeDurationHandle = *rhs.timeDurationHandle;
+  double rank = std::min(std::max(percentage, 0.0), 100.0) / 100.0 * double(sortedDurations.size() - 1);
+  size_t lowerRank = size_t(rank);
+  size_t upperRank = std::min(lowerRank + 1, sortedDurations.size() - 1);
+  double weight = rank - double(lowerRank);
+
+  return double(sortedDurations[lowerRank].count()) * (1 - weight) +
+         double(sortedDurations[upperRank].count()) * weight;
 }
 
-// Move constructor that moves the TimeDuration object "rhs" to the current TimeDuration object.
-TimeDuration::TimeDuration(TimeDuration&& rhs)
+// Method that calculates the median of the durations "durations" in nanoseconds. The durations are reordered; they
+// must not be empty.
+static double calculateMedianOfDurations(std::vector<std::chrono::nanoseconds>& durations)
 {
-  // Move the value of "rhs" to "this".
-  timeDurationHandle = rhs.timeDurationHandle;
-  // Initialize "rhs" with nullptr.
-  rhs.timeDurationHandle = nullptr;
+  size_t middle = durations.size() / 2;
+
+  std::nth_element(durations.begin(), durations.begin() + middle, durations.end());
+  if (durations.size() % 2 == 1)
+    return double(durations[middle].count());
+
+  // For an even number of durations, the median is the mean of the two middle durations. The lower one is the
+  // largest duration in front of the middle.
+  double lowerMiddle = double(std::max_element(durations.begin(), durations.begin() + middle)->count());
+  return (lowerMiddle + double(durations[middle].count())) / 2;
 }
 
-// The destructor frees the needed memory resources of the current TimeDuration object.
-TimeDuration::~TimeDuration()
+// Method that writes the values "values" of a metric followed by their median into a string object as a comma
+// separated list. Integral values are written without decimal places.
+static std::string writeMetricAsACommaSeparatedList(const std::vector<double>& values)
 {
-  delete timeDurationHandle;
+  std::ostringstream convert;
+  std::vector<double> sortedValues(values);
+
+  std::sort(sortedValues.begin(), sortedValues.end());
+  convert << std::setprecision(15);
+  for (double value : values)
+    convert << value << ",";
+  if (!sortedValues.empty())
+    convert << (sortedValues[(sortedValues.size() - 1) / 2] + sortedValues[sortedValues.size() / 2]) / 2;
+
+  return convert.str();
 }
 
-// Copy assignment operator that copies the TimeDuration object "rhs" to the current TimeDuration object.
-TimeDuration& TimeDuration::operator = (const TimeDuration& rhs)
+// Method that writes the string "str" as a JSON string into the stream "stream".
+static void writeJSONString(std::ostream& stream, const std::string& str)
 {
-  if (this != &rhs) *timeDurationHandle = *rhs.timeDurationHandle;
-  return *this;
+  stream << '"';
+  for (char c : str)
+    if (c == '"' || c == '\\')
+      stream << '\\' << c;
+    else if (static_cast<unsigned char>(c) < 0x20)
+      stream << ' ';
+    else
+      stream << c;
+  stream << '"';
 }
 
-// Move assignment operator that moves the TimeDuration object "rhs" to the current TimeDuration object.
-TimeDuration& TimeDuration::operator = (TimeDuration&& rhs)
+// Method that returns the runtimes of all algorithms for "numberOfElements" elements in the list "runTimes". If they
+// do not exist, the method prints an error message and returns nullptr.
+static AlgorithmRuntimesForTheSameNumberOfElements* findRuntimes(
+  std::list<AlgorithmRuntimesForTheSameNumberOfElements>& runTimes, size_t algorithmNumber, size_t numberOfElements)
 {
-  if (this != &rhs)
+  std::list<AlgorithmRuntimesForTheSameNumberOfElements>::iterator it = runTimes.begin();
+  while(it != runTimes.end() && it->numberOfElements != numberOfElements)
+    ++it;
+  if (it == runTimes.end())
   {
-    // Free the current TimeDuration object "*this".
-    delete timeDurationHandle;
-    // Move the value of "rhs" to "this".
-    timeDurationHandle = rhs.timeDurationHandle;
-    // Initialize "rhs" with nullptr.
-    rhs.timeDurationHandle = nullptr;
+    std::cout << "ERROR: Time duration sequence for algorithm number " << algorithmNumber << " and ";
+    std::cout << numberOfElements << " elements does not exist!" << std::endl;
+    return nullptr;
   }
 
-  return *this;
+  return &*it;
+}
+
+//+++++++++++++++++++
+// Class TimeDuration
+//+++++++++++++++++++
+
+// Default constructor that creates and initializes a TimeDuration object with the duration 0.
+TimeDuration::TimeDuration() : elapsedTime(std::chrono::nanoseconds::zero()) {}
+
+// Constructor that creates a TimeDuration object with the duration "elapsedTime".
+TimeDuration::TimeDuration(std::chrono::nanoseconds elapsedTime) : elapsedTime(elapsedTime) {}
+
+// Method that returns the duration of a TimeDuration object in nanoseconds without converting it into a double.
+std::chrono::nanoseconds TimeDuration::getNanoseconds() const
+{
+  return elapsedTime;
 }
 
 // Method that converts a TimeDurationObject into a double with respect to a given base time unit
-double TimeDuration::convertTo(const BaseTimeUnit& unit)
+double TimeDuration::convertTo(const BaseTimeUnit& unit) const
 {
   double duration;
 
-  duration = std::chrono::duration_cast<std::chrono::nanoseconds>(timeDurationHandle->elapsedTime).count();
+  duration = elapsedTime.count();
 
   switch(unit)
   {
@@ -127,33 +233,22 @@ double TimeDuration::convertTo(const BaseTimeUnit& unit)
 }
 
 // Method that converts a TimeDurationObject into a string with respect to a given base time unit
-std::string TimeDuration::convertToString(const BaseTimeUnit& unit)
+std::string TimeDuration::convertToString(const BaseTimeUnit& unit) const
 {
-  double duration;
   std::ostringstream convert;
 
-  duration = std::chrono::duration_cast<std::chrono::nanoseconds>(timeDurationHandle->elapsedTime).count();
-
-  switch(unit)
-  {
-    case BaseTimeUnit::NANOSECONDS  :                           break;
-    case BaseTimeUnit::MICROSECONDS : duration /= 1000.0;       break;
-    case BaseTimeUnit::MILLISECONDS : duration /= 1000000.0;    break;
-    case BaseTimeUnit::SECONDS      : duration /= 1000000000.0; break;
-  }
-
-  convert << std::fixed << duration;
+  writeDuration(convert, elapsedTime.count(), unit);
   return convert.str();
 }
 
 // Method that converts a TimeDurationObject into a string with respect to a given extended time unit
-std::string TimeDuration::convertToString(const ExtendedTimeUnit& unit)
+std::string TimeDuration::convertToString(const ExtendedTimeUnit& unit) const
 {
   double duration, seconds;
   int64_t minutes;
   std::ostringstream convert;
 
-  duration = std::chrono::duration_cast<std::chrono::nanoseconds>(timeDurationHandle->elapsedTime).count();
+  duration = elapsedTime.count();
 
   switch(unit)
   {
@@ -172,85 +267,26 @@ std::string TimeDuration::convertToString(const ExtendedTimeUnit& unit)
 // Class Timer
 //++++++++++++
 
-// Default constructor that creates and initializes a Timer object.
-Timer::Timer()
-{
-  timerHandle = new TimerImplementation;
-  timerHandle->startTime = timerHandle->stopTime = std::chrono::steady_clock::now();
-  timerHandle->running = false;
-}
-
-//Copy constructor that copies the Timer object "rhs" to the current Timer object.
-Timer::Timer(const Timer& rhs)
-{
-  timerHandle = new TimerImplementation;
-  *timerHandle = *rhs.timerHandle;
-}
-
-// Move constructor that moves the Timer object "rhs" to the current Timer object.
-Timer::Timer(Timer&& rhs)
-{
-  // Move the value of "rhs" to "this".
-  timerHandle = rhs.timerHandle;
-  // Initialize "rhs" with nullptr.
-  rhs.timerHandle = nullptr;
-}
-
-// The destructor frees the needed memory resources of the current Timer object.
-Timer::~Timer()
-{
-  delete timerHandle;
-}
-
-// Copy assignment operator that copies the Timer object "rhs" to the current Timer object.
-Timer& Timer::operator = (const Timer& rhs)
-{
-  if (this != &rhs) *timerHandle = *rhs.timerHandle;
-  return *this;
-}
-
-// Move assignment operator that moves the Timer object "rhs" to the current Timer object.
-Timer& Timer::operator = (Timer&& rhs)
-{
-  if (this != &rhs)
-  {
-    // Free the current Timer object "*this".
-    delete timerHandle;
-    // Move the value of "rhs" to "this".
-    timerHandle = rhs.timerHandle;
-    // Initialize "rhs" with nullptr.
-    rhs.timerHandle = nullptr;
-  }
-
-  return *this;
-}
+// Constructor that creates and initializes a Timer object that reads the clock "clockSource".
+Timer::Timer(ClockSource clockSource) : timer(clockSource) {}
 
 // Method that sets the start time of a Timer object
 void Timer::setStartTime()
 {
-  timerHandle->running = true;
-  timerHandle->startTime = std::chrono::steady_clock::now();
+  timer.start();
 }
 
 // Method that sets the stop time of a Timer object
 void Timer::setStopTime()
 {
-  timerHandle->stopTime = std::chrono::steady_clock::now();
-  timerHandle->running = false;
+  timer.stop();
 }
 
 // Method that returns the time elapsed since the last start of the timer object. The timer object can
-// have stopped or is still running.
+// have stopped or is still running. The timer overhead is subtracted.
 TimeDuration Timer::getElapsedTime()
 {
-  TimeDuration period;
-
-  if (timerHandle->running)
-    period.timeDurationHandle->elapsedTime = std::chrono::steady_clock::now() - timerHandle->startTime;
-  else
-    period.timeDurationHandle->elapsedTime = timerHandle->stopTime - timerHandle->startTime;
-
-  return period;
+  return TimeDuration(timer.getElapsedTime());
 }
 
 //+++++++++++++++++++++++++
@@ -311,112 +347,175 @@ TimeDurationSeries& TimeDurationSeries::operator = (TimeDurationSeries&& rhs)
 // Method that adds a TimeDuration object to a TimeDurationSeries object
 void TimeDurationSeries::addDuration(const TimeDuration& rhs)
 {
-  timeDurationSeriesHandle->series.push_back(rhs.timeDurationHandle->elapsedTime);
-  timeDurationSeriesHandle->meanDurationIsUpToDate = false;
-  timeDurationSeriesHandle->varianceDurationIsUpToDate = false;
-  timeDurationSeriesHandle->standardDeviationIsUpToDate = false;
+  TimeDurationSeriesImplementation& impl = *timeDurationSeriesHandle;
+  double duration = double(rhs.elapsedTime.count());
+
+  impl.series.push_back(rhs.elapsedTime);
+  impl.sortedSeriesIsUpToDate = false;
+
+  // Update the running statistics (Welford's method).
+  double deviation = duration - impl.mean;
+  impl.mean += deviation / double(impl.series.size());
+  impl.sumOfSquaredDeviations += deviation * (duration - impl.mean);
+  impl.minimum = std::min(impl.minimum, rhs.elapsedTime);
+  impl.maximum = std::max(impl.maximum, rhs.elapsedTime);
+}
+
+// Method that returns the number of durations of a TimeDurationSeries object
+size_t TimeDurationSeries::getNumberOfDurations()
+{
+  return timeDurationSeriesHandle->series.size();
 }
 
 // Method that calculates the mean duration of a TimeDurationSeries object
 TimeDuration TimeDurationSeries::calculateMean()
 {
-  TimeDuration mean;
-
-  if (!timeDurationSeriesHandle->meanDurationIsUpToDate)
-  {
-    // Sum up all durations of the series.
-    mean.timeDurationHandle->elapsedTime = std::accumulate(timeDurationSeriesHandle->series.begin(),
-                                                           timeDurationSeriesHandle->series.end(),
-                                                           std::chrono::steady_clock::duration::zero());
-    // Divide the sum by the number of durations.
-    mean.timeDurationHandle->elapsedTime /= timeDurationSeriesHandle->series.size();
-
-    // Mean duration is computed. Set flag "meanDurationIsUpToDate".
-    timeDurationSeriesHandle->meanDurationIsUpToDate = true;
-    // Store mean duration since it will be needed for variance and standard deviation.
-    timeDurationSeriesHandle->meanDuration = mean.timeDurationHandle->elapsedTime;
-  }
-  else
-    mean.timeDurationHandle->elapsedTime = timeDurationSeriesHandle->meanDuration;
-  
-  return mean;
+  return TimeDuration(roundToNanoseconds(timeDurationSeriesHandle->mean));
 }
 
 // Method that calculates the variance of a TimeDurationSeries object
 TimeDuration TimeDurationSeries::calculateVariance()
 {
-  TimeDuration variance;
+  if (timeDurationSeriesHandle->series.empty())
+    return TimeDuration();
 
-  if (!timeDurationSeriesHandle->varianceDurationIsUpToDate)
-  {
-    if (!timeDurationSeriesHandle->meanDurationIsUpToDate)
-    {
-      TimeDuration mean;
+  // Compute variance v = (sum_1^n (X - mean)^2) / n
+  return TimeDuration(roundToNanoseconds(timeDurationSeriesHandle->sumOfSquaredDeviations /
+                                         double(timeDurationSeriesHandle->series.size())));
+}
 
-      mean = this->calculateMean();
-      timeDurationSeriesHandle->meanDurationIsUpToDate = true;
-      timeDurationSeriesHandle->meanDuration = mean.timeDurationHandle->elapsedTime;
-    }
+// Method that calculates the standard deviation of a TimeDurationSeries object.
+TimeDuration TimeDurationSeries::calculateStandardDeviation()
+{
+  if (timeDurationSeriesHandle->series.empty())
+    return TimeDuration();
 
-    // Compute variance v = (sum_1^n (X - mean)^2) / n
-    // Step 1: Initialization of the summation process
-    std::chrono::steady_clock::duration diff;
-    variance.timeDurationHandle->elapsedTime = std::chrono::steady_clock::duration::zero();
-    // Step 2: Compute sum_1^n (X - mean)^2. A problem is that the operator '*' is not defined in the
-    // class "duration". Therefore, a cast of one argument is needed.
-    for (unsigned i = 0; i <= timeDurationSeriesHandle->series.size() - 1; ++i)
-    {
-      // Compute the difference "diff" between a vector element and the mean. This difference must always be positive.
-      if (timeDurationSeriesHandle->series[i] >= timeDurationSeriesHandle->meanDuration)
-        diff = timeDurationSeriesHandle->series[i] - timeDurationSeriesHandle->meanDuration;
-      else
-        diff = timeDurationSeriesHandle->meanDuration - timeDurationSeriesHandle->series[i];
-      // Add the square of "diff"
-      variance.timeDurationHandle->elapsedTime +=
-        diff * std::chrono::duration_cast<std::chrono::nanoseconds>(diff).count();
-    }
-    // Step 3: Divide by n.
-    variance.timeDurationHandle->elapsedTime /= timeDurationSeriesHandle->series.size();
+  // The standard deviation is computed from the unrounded variance.
+  return TimeDuration(roundToNanoseconds(std::sqrt(timeDurationSeriesHandle->sumOfSquaredDeviations /
+                                                   double(timeDurationSeriesHandle->series.size()))));
+}
 
-    // Variance duration is computed. Set flag "varianceDurationIsUpToDate".
-    timeDurationSeriesHandle->varianceDurationIsUpToDate = true;
-    // Store variance duration since it will be needed for standard deviation.
-    timeDurationSeriesHandle->varianceDuration = variance.timeDurationHandle->elapsedTime;
-  }
-  else
-    variance.timeDurationHandle->elapsedTime = timeDurationSeriesHandle->varianceDuration;
-  
-  return variance;
+// Method that returns the minimal duration of a TimeDurationSeries object
+TimeDuration TimeDurationSeries::calculateMinimum()
+{
+  if (timeDurationSeriesHandle->series.empty())
+    return TimeDuration();
+
+  return TimeDuration(timeDurationSeriesHandle->minimum);
 }
 
-// Method that calculates the standard deviation of a TimeDurationSeries object.
-TimeDuration TimeDurationSeries::calculateStandardDeviation()
+// Method that returns the maximal duration of a TimeDurationSeries object
+TimeDuration TimeDurationSeries::calculateMaximum()
+{
+  if (timeDurationSeriesHandle->series.empty())
+    return TimeDuration();
+
+  return TimeDuration(timeDurationSeriesHandle->maximum);
+}
+
+// Method that calculates the median duration of a TimeDurationSeries object
+TimeDuration TimeDurationSeries::calculateMedian()
 {
-  TimeDuration standardDeviation;
+  return calculatePercentile(50);
+}
 
-  if (!timeDurationSeriesHandle->standardDeviationIsUpToDate)
+// Method that calculates the percentile "percentage" (between 0 and 100) of a TimeDurationSeries object
+TimeDuration TimeDurationSeries::calculatePercentile(double percentage)
+{
+  TimeDurationSeriesImplementation& impl = *timeDurationSeriesHandle;
+
+  if (impl.series.empty())
+    return TimeDuration();
+
+  if (!impl.sortedSeriesIsUpToDate)
   {
-    if (!timeDurationSeriesHandle->varianceDurationIsUpToDate)
-    {
-      TimeDuration variance;
+    impl.sortedSeries = impl.series;
+    std::sort(impl.sortedSeries.begin(), impl.sortedSeries.end());
+    impl.sortedSeriesIsUpToDate = true;
+  }
 
-      variance = this->calculateVariance();
-      timeDurationSeriesHandle->varianceDurationIsUpToDate = true;
-      timeDurationSeriesHandle->varianceDuration = variance.timeDurationHandle->elapsedTime;
-    }
+  return TimeDuration(roundToNanoseconds(calculatePercentileOfSortedDurations(impl.sortedSeries, percentage)));
+}
 
-    // Compute standard deviation.
-    std::chrono::nanoseconds one(1);
-    double stdv = std::sqrt(std::chrono::duration_cast<std::chrono::nanoseconds>(timeDurationSeriesHandle->varianceDuration).count());
-    timeDurationSeriesHandle->standardDeviationDuration = one * int64_t(stdv);
+// Method that calculates a confidence interval of the median of a TimeDurationSeries object by the percentile
+// bootstrap: The median is computed for "numberOfResamples" resamples, each of which draws as many durations from the
+// series as it has (with replacement). The bounds of the interval are the percentiles of these medians that cut off
+// (1 - confidenceLevel) / 2 on both sides.
+TimeDurationInterval TimeDurationSeries::calculateConfidenceIntervalOfMedian(double confidenceLevel,
+                                                                             size_t numberOfResamples)
+{
+  const std::vector<std::chrono::nanoseconds>& series = timeDurationSeriesHandle->series;
+  TimeDurationInterval interval;
 
-    // Standard deviation duration is computed. Set flag "standardDeviationDurationIsUpToDate".
-    timeDurationSeriesHandle->standardDeviationIsUpToDate = true;
+  if (series.empty() || numberOfResamples == 0)
+    return interval;
+
+  std::mt19937_64 generator{BOOTSTRAP_SEED};
+  std::uniform_int_distribution<size_t> index(0, series.size() - 1);
+  std::vector<std::chrono::nanoseconds> resample(series.size()), medians(numberOfResamples);
+
+  for (size_t i = 0; i < numberOfResamples; ++i)
+  {
+    for (std::chrono::nanoseconds& duration : resample)
+      duration = series[index(generator)];
+    medians[i] = roundToNanoseconds(calculateMedianOfDurations(resample));
   }
 
-  standardDeviation.timeDurationHandle->elapsedTime = timeDurationSeriesHandle->standardDeviationDuration;
+  std::sort(medians.begin(), medians.end());
+  double tailPercentage = (1 - std::min(std::max(confidenceLevel, 0.0), 1.0)) / 2 * 100;
+  interval.lowerBound.elapsedTime = roundToNanoseconds(calculatePercentileOfSortedDurations(medians, tailPercentage));
+  interval.upperBound.elapsedTime = roundToNanoseconds(calculatePercentileOfSortedDurations(medians,
+                                                                                            100 - tailPercentage));
+  return interval;
+}
+
+// Method that flags the durations of a TimeDurationSeries object whose modified z-score exceeds "threshold" as
+// outliers.
+std::vector<bool> TimeDurationSeries::flagOutliers(double threshold)
+{
+  const std::vector<std::chrono::nanoseconds>& series = timeDurationSeriesHandle->series;
+  std::vector<bool> outlierFlags(series.size(), false);
+
+  if (series.empty())
+    return outlierFlags;
+
+  // Compute the median and the median of the absolute deviations from the median (MAD).
+  double median = double(calculateMedian().elapsedTime.count());
+  std::vector<std::chrono::nanoseconds> absoluteDeviations(series.size());
+  for (size_t i = 0; i < series.size(); ++i)
+    absoluteDeviations[i] = roundToNanoseconds(std::fabs(double(series[i].count()) - median));
+  double medianOfAbsoluteDeviations = calculateMedianOfDurations(absoluteDeviations);
 
-  return standardDeviation;
+  // 0.6745 is the third quartile of the standard normal distribution, so that the modified z-score of normally
+  // distributed durations is comparable to the usual z-score.
+  if (medianOfAbsoluteDeviations > 0)
+    for (size_t i = 0; i < series.size(); ++i)
+      outlierFlags[i] = 0.6745 * std::fabs(double(series[i].count()) - median) / medianOfAbsoluteDeviations > threshold;
+
+  return outlierFlags;
+}
+
+// Method that calculates all statistics of a TimeDurationSeries object with the default parameters.
+TimeDurationStatistics TimeDurationSeries::calculateStatistics()
+{
+  TimeDurationStatistics statistics;
+
+  statistics.numberOfDurations = timeDurationSeriesHandle->series.size();
+  statistics.mean = calculateMean();
+  statistics.standardDeviation = calculateStandardDeviation();
+  statistics.minimum = calculateMinimum();
+  statistics.median = calculateMedian();
+  statistics.percentile90 = calculatePercentile(90);
+  statistics.percentile99 = calculatePercentile(99);
+  statistics.maximum = calculateMaximum();
+  statistics.confidenceIntervalOfMedian = calculateConfidenceIntervalOfMedian();
+
+  std::vector<bool> outlierFlags = flagOutliers();
+  for (size_t i = 0; i < outlierFlags.size(); ++i)
+    if (outlierFlags[i])
+      statistics.outlierIndexes.push_back(i);
+
+  return statistics;
 }
 
 // Method that writes a TimeDurationSeries object into a string object as a comma separated sequence of time
@@ -426,39 +525,105 @@ std::string TimeDurationSeries::writeAsACommaSeparatedList(const BaseTimeUnit& t
   if (timeDurationSeriesHandle->series.empty())
     return std::string();
 
-  double duration;
   std::ostringstream convert;
-  calculateMean();
 
-  for (unsigned i = 0; i <= timeDurationSeriesHandle->series.size(); ++i)
+  for (const std::chrono::nanoseconds& duration : timeDurationSeriesHandle->series)
   {
-    if (i != 0) convert << ",";
+    // Convert the current duration object into a string and add it to "str".
+    writeDuration(convert, duration.count(), timeUnit);
+    convert << ",";
+  }
+  writeDuration(convert, calculateMean().elapsedTime.count(), timeUnit);
 
-    if (i == timeDurationSeriesHandle->series.size())
-    {
-      duration = std::chrono::duration_cast<std::chrono::nanoseconds>(timeDurationSeriesHandle->meanDuration).count();
-    }
-    
-    else 
-    {
-      // Convert the current duration object into a string and add it to "str".
-      duration = std::chrono::duration_cast<std::chrono::nanoseconds>(timeDurationSeriesHandle->series[i]).count();
-    }
-    
+  return convert.str();
+}
 
-    switch(timeUnit)
-    {
-      case BaseTimeUnit::NANOSECONDS  :                           break;
-      case BaseTimeUnit::MICROSECONDS : duration /= 1000.0;       break;
-      case BaseTimeUnit::MILLISECONDS : duration /= 1000000.0;    break;
-      case BaseTimeUnit::SECONDS      : duration /= 1000000000.0; break;
-    }
+// Method that writes a TimeDurationSeries object into a string object as a JSON array of the durations in
+// nanoseconds.
+std::string TimeDurationSeries::writeAsAJSONArray()
+{
+  std::ostringstream convert;
+
+  convert << "[";
+  for (size_t i = 0; i < timeDurationSeriesHandle->series.size(); ++i)
+    convert << ((i > 0) ? "," : "") << timeDurationSeriesHandle->series[i].count();
+  convert << "]";
+
+  return convert.str();
+}
 
-    convert << std::fixed << duration;
+// Method that writes the statistics of a TimeDurationSeries object into a string object as a comma separated list.
+// The outliers are given by their run numbers (starting with 1) separated by blanks.
+std::string TimeDurationSeries::writeStatisticsAsACommaSeparatedList(const BaseTimeUnit& timeUnit)
+{
+  if (timeDurationSeriesHandle->series.empty())
+    return std::string();
+
+  TimeDurationStatistics statistics = calculateStatistics();
+  std::ostringstream convert;
+
+  convert << statistics.numberOfDurations;
+  for (const TimeDuration* duration : {&statistics.mean, &statistics.standardDeviation, &statistics.minimum,
+                                       &statistics.median, &statistics.percentile90, &statistics.percentile99,
+                                       &statistics.maximum, &statistics.confidenceIntervalOfMedian.lowerBound,
+                                       &statistics.confidenceIntervalOfMedian.upperBound})
+  {
+    convert << ",";
+    writeDuration(convert, duration->elapsedTime.count(), timeUnit);
   }
+
+  convert << "," << statistics.outlierIndexes.size() << ",";
+  for (size_t i = 0; i < statistics.outlierIndexes.size(); ++i)
+    convert << ((i == 0) ? "" : " ") << statistics.outlierIndexes[i] + 1;
+
   return convert.str();
 }
 
+// Method that returns the comma separated column names of the list written by "writeStatisticsAsACommaSeparatedList".
+std::string TimeDurationSeries::getStatisticsColumnNames()
+{
+  return "Runs,Mean,Standard deviation,Minimum,Median,90th percentile,99th percentile,Maximum,"
+         "Median CI lower bound (95%),Median CI upper bound (95%),Outliers (MAD),Outlier runs";
+}
+
+//++++++++++++++++++
+// Adaptive sampling
+//++++++++++++++++++
+
+// Method that converts a sampling mode into a string
+std::string convertToString(SamplingMode samplingMode)
+{
+  switch(samplingMode)
+  {
+    case SamplingMode::FIXED    : return "fixed";
+    case SamplingMode::ADAPTIVE : return "adaptive";
+  }
+
+  return std::string();
+}
+
+// Method that returns the maximal number of runs of the sampling.
+size_t getMaximalNumberOfRuns(const SamplingParameters& samplingParameters)
+{
+  return (samplingParameters.samplingMode == SamplingMode::FIXED) ? samplingParameters.numberOfRuns
+                                                                  : samplingParameters.maximalNumberOfRuns;
+}
+
+// Method that converts a stopping reason into a string
+std::string convertToString(StoppingReason stoppingReason)
+{
+  switch(stoppingReason)
+  {
+    case StoppingReason::NOT_STOPPED               : return "not stopped";
+    case StoppingReason::FIXED_NUMBER_OF_RUNS      : return "fixed number of runs";
+    case StoppingReason::MAXIMAL_NUMBER_OF_RUNS    : return "maximal number of runs";
+    case StoppingReason::CONFIDENCE_INTERVAL_WIDTH : return "confidence interval width";
+    case StoppingReason::TIME_BUDGET               : return "time budget";
+  }
+
+  return std::string();
+}
+
 //++++++++++++++++++++++++++++++
 // Class AlgorithmRuntimeManager
 //++++++++++++++++++++++++++++++
@@ -470,20 +635,24 @@ std::string TimeDurationSeries::writeAsACommaSeparatedList(const BaseTimeUnit& t
 // of elements to which an algorithms is applied as well as a vector that later stores a time duration series for each
 // algorithm.
 AlgorithmRuntimeManager::AlgorithmRuntimeManager(size_t numberOfAlgorithms,
-                                                 const std::vector<size_t>& numberOfElementsVector)
+                                                 const std::vector<size_t>& numberOfElementsVector,
+                                                 const SamplingParameters& samplingParameters)
 {
   algorithmRuntimeManagerHandle = new AlgorithmRuntimeManagerImplementation;
+  algorithmRuntimeManagerHandle->samplingParameters = samplingParameters;
 
   AlgorithmRuntimesForTheSameNumberOfElements element;
 
   // Create a list where each list element keeps the number of elements for which the algorithms are tested and
-  // reserves vector space for the time durtion series for each algorithm.
+  // reserves vector space for the time durtion series and the sampling states for each algorithm.
   for(std::vector<size_t>::const_iterator it = numberOfElementsVector.cbegin();
       it != numberOfElementsVector.cend();
       ++it)
   {
     element.numberOfElements = *it;
     element.series.resize(numberOfAlgorithms + 1);
+    element.samplingStates.resize(numberOfAlgorithms + 1);
+    element.metrics.resize(numberOfAlgorithms + 1);
     algorithmRuntimeManagerHandle->runTimes.push_back(element);
   }
 }
@@ -536,24 +705,181 @@ AlgorithmRuntimeManager& AlgorithmRuntimeManager::operator = (AlgorithmRuntimeMa
 }
 
 // Method that adds a TimeDuration object to an AlgorithmRuntimeManager object with respect to the algorithm number
-// "algorithmNumber" and the number of elements "".
+// "algorithmNumber" and the number of elements "numberOfElements".
 void AlgorithmRuntimeManager::addDuration(size_t algorithmNumber, size_t numberOfElements, const TimeDuration& rhs)
 {
-  // Search list element that handles the time duration series of all algorithms for "numberOfElements" elements. 
-  std::list<AlgorithmRuntimesForTheSameNumberOfElements>::iterator it =
-      algorithmRuntimeManagerHandle->runTimes.begin();
-  while(it != algorithmRuntimeManagerHandle->runTimes.end() && it->numberOfElements != numberOfElements)
+  // Search list element that handles the time duration series of all algorithms for "numberOfElements" elements.
+  AlgorithmRuntimesForTheSameNumberOfElements* runtimes =
+    findRuntimes(algorithmRuntimeManagerHandle->runTimes, algorithmNumber, numberOfElements);
+  if (runtimes == nullptr)
+    return;
+
+  // Count the duration against the time budget. Add it to the time duration series of algorithm number
+  // "algorithmNumber" unless it belongs to a warmup run.
+  SamplingState& state = runtimes->samplingStates[algorithmNumber];
+  state.consumedTime += rhs.getNanoseconds();
+  state.lastRunIsWarmupRun =
+    (state.numberOfWarmupRuns < algorithmRuntimeManagerHandle->samplingParameters.numberOfWarmupRuns);
+  if (state.lastRunIsWarmupRun)
+    ++state.numberOfWarmupRuns;
+  else
+    runtimes->series[algorithmNumber].addDuration(rhs);
+}
+
+// Method that adds the value "value" of the metric "metricName" to an AlgorithmRuntimeManager object with respect to
+// the algorithm number "algorithmNumber" and the number of elements "numberOfElements".
+void AlgorithmRuntimeManager::addMetric(size_t algorithmNumber, size_t numberOfElements, const std::string& metricName,
+                                        double value)
+{
+  AlgorithmRuntimesForTheSameNumberOfElements* runtimes =
+    findRuntimes(algorithmRuntimeManagerHandle->runTimes, algorithmNumber, numberOfElements);
+  if (runtimes == nullptr || runtimes->samplingStates[algorithmNumber].lastRunIsWarmupRun)
+    return;
+
+  // Search the values of the metric in the order in which the metrics were added first.
+  std::vector<MetricSeries>& metrics = runtimes->metrics[algorithmNumber];
+  std::vector<MetricSeries>::iterator it = metrics.begin();
+  while (it != metrics.end() && it->name != metricName)
     ++it;
-  if (it == algorithmRuntimeManagerHandle->runTimes.end())
+  if (it == metrics.end())
+    it = metrics.insert(metrics.end(), MetricSeries{metricName, {}});
+
+  it->values.push_back(value);
+}
+
+// Method that returns the names and values of the metrics of the run of the algorithm with the number
+// "algorithmNumber" for "numberOfElements" elements whose duration was added last.
+std::vector<std::pair<std::string, double>> AlgorithmRuntimeManager::getMetricsOfLastRun(size_t algorithmNumber,
+                                                                                         size_t numberOfElements)
+{
+  std::vector<std::pair<std::string, double>> metricsOfLastRun;
+  AlgorithmRuntimesForTheSameNumberOfElements* runtimes =
+    findRuntimes(algorithmRuntimeManagerHandle->runTimes, algorithmNumber, numberOfElements);
+  if (runtimes == nullptr || runtimes->samplingStates[algorithmNumber].lastRunIsWarmupRun)
+    return metricsOfLastRun;
+
+  // Only the metrics with a value for each run have a value for the last run.
+  size_t numberOfRuns = runtimes->series[algorithmNumber].getNumberOfDurations();
+  for (const MetricSeries& metric : runtimes->metrics[algorithmNumber])
+    if (numberOfRuns > 0 && metric.values.size() == numberOfRuns)
+      metricsOfLastRun.emplace_back(metric.name, metric.values.back());
+
+  return metricsOfLastRun;
+}
+
+// Method that returns the number of runs of the algorithm with the number "algorithmNumber" for "numberOfElements"
+// elements.
+size_t AlgorithmRuntimeManager::getNumberOfRuns(size_t algorithmNumber, size_t numberOfElements)
+{
+  AlgorithmRuntimesForTheSameNumberOfElements* runtimes =
+    findRuntimes(algorithmRuntimeManagerHandle->runTimes, algorithmNumber, numberOfElements);
+
+  return (runtimes == nullptr) ? 0 : runtimes->series[algorithmNumber].getNumberOfDurations();
+}
+
+// Method that checks whether the next run of the algorithm with the number "algorithmNumber" for "numberOfElements"
+// elements is a warmup run.
+bool AlgorithmRuntimeManager::nextRunIsWarmupRun(size_t algorithmNumber, size_t numberOfElements)
+{
+  AlgorithmRuntimesForTheSameNumberOfElements* runtimes =
+    findRuntimes(algorithmRuntimeManagerHandle->runTimes, algorithmNumber, numberOfElements);
+
+  return (runtimes != nullptr) && (runtimes->samplingStates[algorithmNumber].numberOfWarmupRuns <
+                                   algorithmRuntimeManagerHandle->samplingParameters.numberOfWarmupRuns);
+}
+
+// Method that calculates the median runtime of the algorithm with the number "algorithmNumber" for "numberOfElements"
+// elements.
+TimeDuration AlgorithmRuntimeManager::calculateMedian(size_t algorithmNumber, size_t numberOfElements)
+{
+  AlgorithmRuntimesForTheSameNumberOfElements* runtimes =
+    findRuntimes(algorithmRuntimeManagerHandle->runTimes, algorithmNumber, numberOfElements);
+  if (runtimes == nullptr || runtimes->series[algorithmNumber].getNumberOfDurations() == 0)
+    return TimeDuration();
+
+  return runtimes->series[algorithmNumber].calculateMedian();
+}
+
+// Method that calculates the median of the values of the metric "metricName" of the algorithm with the number
+// "algorithmNumber" for "numberOfElements" elements.
+double AlgorithmRuntimeManager::calculateMedianOfMetric(size_t algorithmNumber, size_t numberOfElements,
+                                                        const std::string& metricName)
+{
+  AlgorithmRuntimesForTheSameNumberOfElements* runtimes =
+    findRuntimes(algorithmRuntimeManagerHandle->runTimes, algorithmNumber, numberOfElements);
+  if (runtimes == nullptr)
+    return std::numeric_limits<double>::quiet_NaN();
+
+  for (const MetricSeries& metric : runtimes->metrics[algorithmNumber])
+    if (metric.name == metricName && !metric.values.empty())
+    {
+      std::vector<double> sortedValues(metric.values);
+      std::sort(sortedValues.begin(), sortedValues.end());
+      return (sortedValues[(sortedValues.size() - 1) / 2] + sortedValues[sortedValues.size() / 2]) / 2;
+    }
+
+  return std::numeric_limits<double>::quiet_NaN();
+}
+
+// Method that checks whether the algorithm with the number "algorithmNumber" has to be run again for
+// "numberOfElements" elements. The confidence interval of the median is recomputed whenever the number of sampled runs
+// has grown by a tenth since the last check, since a bootstrap takes much longer than a run for small numbers of
+// elements.
+bool AlgorithmRuntimeManager::needsMoreRuns(size_t algorithmNumber, size_t numberOfElements)
+{
+  AlgorithmRuntimesForTheSameNumberOfElements* runtimes =
+    findRuntimes(algorithmRuntimeManagerHandle->runTimes, algorithmNumber, numberOfElements);
+  if (runtimes == nullptr)
+    return false;
+
+  const SamplingParameters& parameters = algorithmRuntimeManagerHandle->samplingParameters;
+  SamplingState& state = runtimes->samplingStates[algorithmNumber];
+  TimeDurationSeries& series = runtimes->series[algorithmNumber];
+  size_t numberOfRuns = series.getNumberOfDurations();
+
+  if (state.stoppingReason != StoppingReason::NOT_STOPPED)
+    return false;
+  if (state.numberOfWarmupRuns < parameters.numberOfWarmupRuns)
+    return true;
+  if (parameters.samplingMode == SamplingMode::FIXED)
   {
-    std::cout << "ERROR: Time duration sequence for algorithm number " << algorithmNumber << " and ";
-    std::cout << numberOfElements << " elements does not exist!" << std::endl;
-    return;
+    if (numberOfRuns < parameters.numberOfRuns)
+      return true;
+    state.stoppingReason = StoppingReason::FIXED_NUMBER_OF_RUNS;
+    return false;
+  }
+  if (numberOfRuns < parameters.minimalNumberOfRuns)
+    return true;
+
+  if (numberOfRuns >= parameters.maximalNumberOfRuns)
+    state.stoppingReason = (parameters.minimalNumberOfRuns == parameters.maximalNumberOfRuns) ?
+                           StoppingReason::FIXED_NUMBER_OF_RUNS : StoppingReason::MAXIMAL_NUMBER_OF_RUNS;
+  else if (numberOfRuns >= state.numberOfRunsAtNextCheck)
+  {
+    state.numberOfRunsAtNextCheck = numberOfRuns + std::max<size_t>(1, numberOfRuns / 10);
+    TimeDurationInterval interval = series.calculateConfidenceIntervalOfMedian();
+    double width = double((interval.upperBound.getNanoseconds() - interval.lowerBound.getNanoseconds()).count());
+    if (width <= parameters.targetRelativeConfidenceIntervalWidth *
+                 double(series.calculateMedian().getNanoseconds().count()))
+      state.stoppingReason = StoppingReason::CONFIDENCE_INTERVAL_WIDTH;
   }
 
-  // "it" points to the right list element. Add the duration object "rhs" to the time duration series of algorithm
-  // number "algorithmNumber".
-  it->series[algorithmNumber].addDuration(rhs);
+  if (state.stoppingReason == StoppingReason::NOT_STOPPED && state.consumedTime >= parameters.timeBudget)
+    state.stoppingReason = StoppingReason::TIME_BUDGET;
+
+  return state.stoppingReason == StoppingReason::NOT_STOPPED;
+}
+
+// Method that returns the recorded stopping reason of the algorithm with the number "algorithmNumber" for
+// "numberOfElements" elements.
+StoppingReason AlgorithmRuntimeManager::getStoppingReason(size_t algorithmNumber, size_t numberOfElements)
+{
+  AlgorithmRuntimesForTheSameNumberOfElements* runtimes =
+    findRuntimes(algorithmRuntimeManagerHandle->runTimes, algorithmNumber, numberOfElements);
+  if (runtimes == nullptr)
+    return StoppingReason::NOT_STOPPED;
+
+  return runtimes->samplingStates[algorithmNumber].stoppingReason;
 }
 
 // Method that writes the contents of an AlgorithmRuntimeManager object into a CSV file with name "filename.csv". The
@@ -561,7 +887,8 @@ void AlgorithmRuntimeManager::addDuration(size_t algorithmNumber, size_t numberO
 void AlgorithmRuntimeManager::writeToCSVFile(const std::string& fileName,
                                              const std::string& header,
                                              const BaseTimeUnit& timeUnit,
-                                             const std::vector<std::string>& ConvexHullAlgorithms)
+                                             const std::vector<std::string>& ConvexHullAlgorithms,
+                                             const std::string& footer)
 {
   const std::string ending(".csv");
   std::string newFileName, str, csvStr;
@@ -595,7 +922,31 @@ void AlgorithmRuntimeManager::writeToCSVFile(const std::string& fileName,
         str += ConvexHullAlgorithms[algorithmNumber] + " (Alg. " +
                std::to_string(algorithmNumber) + ")," + csvStr + "\n";
     }
+    // Add a table with the statistics of each time duration sequence.
+    str += "Statistics," + TimeDurationSeries::getStatisticsColumnNames() + ",Warmup runs,Stopping reason\n";
+    for (unsigned int algorithmNumber = 1; algorithmNumber <= listIt->series.size()-1; ++algorithmNumber)
+    {
+      csvStr = listIt->series[algorithmNumber].writeStatisticsAsACommaSeparatedList(timeUnit);
+      if (!csvStr.empty())
+        str += ConvexHullAlgorithms[algorithmNumber] + " (Alg. " +
+               std::to_string(algorithmNumber) + ")," + csvStr + "," +
+               std::to_string(listIt->samplingStates[algorithmNumber].numberOfWarmupRuns) + "," +
+               convertToString(listIt->samplingStates[algorithmNumber].stoppingReason) + "\n";
+    }
+    // Add a table with the values of the metrics of each algorithm if there are any.
+    bool metricsExist = false;
+    for (const std::vector<MetricSeries>& metrics : listIt->metrics)
+      metricsExist = metricsExist || !metrics.empty();
+    if (metricsExist)
+    {
+      str += "Metrics,Metric,Values of the runs followed by their median\n";
+      for (unsigned int algorithmNumber = 1; algorithmNumber <= listIt->series.size()-1; ++algorithmNumber)
+        for (const MetricSeries& metric : listIt->metrics[algorithmNumber])
+          str += ConvexHullAlgorithms[algorithmNumber] + " (Alg. " + std::to_string(algorithmNumber) + ")," +
+                 metric.name + "," + writeMetricAsACommaSeparatedList(metric.values) + "\n";
+    }
   }
+  str += footer;
   
   std::cout << str; // temp
   
@@ -605,3 +956,53 @@ void AlgorithmRuntimeManager::writeToCSVFile(const std::string& fileName,
   out.close();
 }
 
+// Method that writes the contents of an AlgorithmRuntimeManager object into the file "fileName" in the JSON lines
+// format. The values of the metrics are written with 15 significant digits; non-finite values are written as null.
+bool AlgorithmRuntimeManager::writeToJSONLinesFile(const std::string& fileName, const std::string& commonMembers,
+                                                   const std::vector<std::string>& algorithmNames, bool isAppended)
+{
+  std::ofstream out(fileName, isAppended ? std::ios::app : std::ios::trunc);
+
+  if (!out)
+  {
+    std::cout << "ERROR: File '" << fileName << "' cannot be written!" << std::endl;
+    return false;
+  }
+
+  out << std::setprecision(15);
+  for (AlgorithmRuntimesForTheSameNumberOfElements& runtimes : algorithmRuntimeManagerHandle->runTimes)
+    for (size_t algorithmNumber = 1; algorithmNumber < runtimes.series.size(); ++algorithmNumber)
+    {
+      if (runtimes.series[algorithmNumber].getNumberOfDurations() == 0)
+        continue;
+
+      out << "{" << commonMembers << (commonMembers.empty() ? "" : ",") << "\"algorithm\":";
+      writeJSONString(out, algorithmNames[algorithmNumber]);
+      out << ",\"numberOfElements\":" << runtimes.numberOfElements
+          << ",\"durationsNs\":" << runtimes.series[algorithmNumber].writeAsAJSONArray()
+          << ",\"warmupRuns\":" << runtimes.samplingStates[algorithmNumber].numberOfWarmupRuns
+          << ",\"stoppingReason\":";
+      writeJSONString(out, convertToString(runtimes.samplingStates[algorithmNumber].stoppingReason));
+      out << ",\"metrics\":{";
+      for (size_t i = 0; i < runtimes.metrics[algorithmNumber].size(); ++i)
+      {
+        const MetricSeries& metric = runtimes.metrics[algorithmNumber][i];
+        out << ((i > 0) ? "," : "");
+        writeJSONString(out, metric.name);
+        out << ":[";
+        for (size_t j = 0; j < metric.values.size(); ++j)
+        {
+          out << ((j > 0) ? "," : "");
+          if (std::isfinite(metric.values[j]))
+            out << metric.values[j];
+          else
+            out << "null";
+        }
+        out << "]";
+      }
+      out << "}}\n";
+    }
+
+  out.flush();
+  return bool(out);
+}
@@ -2,12 +2,19 @@
 #define TIMEMEASUREMENT_H
 
 
+#include <chrono>
 #include <string>
+#include <utility>
 #include <vector>
+#include "LowOverheadTimer.h"
 
 enum class BaseTimeUnit {NANOSECONDS, MICROSECONDS, MILLISECONDS, SECONDS};
 enum class ExtendedTimeUnit {MIN_SEC};
 
+// TimeDuration and Timer objects are small values that do not allocate memory. A Timer object is a thin wrapper of a
+// low-overhead timer (see "LowOverheadTimer.h"), which can also be used directly to time single phases of an
+// algorithm.
+
 //+++++++++++++++++++
 // Class TimeDuration
 //+++++++++++++++++++
@@ -18,38 +25,26 @@ class TimeDuration
   friend class TimeDurationSeries;
 
   public:
-    // Default constructor that creates and initializes a TimeDuration object.
+    // Default constructor that creates and initializes a TimeDuration object with the duration 0.
     TimeDuration();
 
-    //Copy constructor that copies the TimeDuration object "rhs" to the current TimeDuration object.
-    TimeDuration(const TimeDuration& rhs);
-
-    // Move constructor that moves the TimeDuration object "rhs" to the current TimeDuration object.
-    TimeDuration(TimeDuration&& rhs);
-
-    // Destructor that frees the needed memory resources of the current TimeDuration object.
-    ~TimeDuration();
+    // Constructor that creates a TimeDuration object with the duration "elapsedTime".
+    explicit TimeDuration(std::chrono::nanoseconds elapsedTime);
 
-    // Copy assignment operator that copies the TimeDuration object "rhs" to the current TimeDuration object.
-    TimeDuration& operator = (const TimeDuration& rhs);
-
-    // Move assignment operator that moves the TimeDuration object "rhs" to the current TimeDuration object.
-    TimeDuration& operator = (TimeDuration&& rhs);
+    // Method that returns the duration of a TimeDuration object in nanoseconds without converting it into a double.
+    std::chrono::nanoseconds getNanoseconds() const;
 
     // Method that converts a TimeDurationObject into a double with respect to a given base time unit
-    double convertTo(const BaseTimeUnit& unit);
+    double convertTo(const BaseTimeUnit& unit) const;
 
     // Method that converts a TimeDurationObject into a string with respect to a given base time unit
-    std::string convertToString(const BaseTimeUnit& unit);
+    std::string convertToString(const BaseTimeUnit& unit) const;
 
     // Method that converts a TimeDurationObject into a string with respect to a given extended time unit
-    std::string convertToString(const ExtendedTimeUnit& unit);
+    std::string convertToString(const ExtendedTimeUnit& unit) const;
 
   private:
-    // Forward declaration of a struct for the hidden implementation of TimeDuration objects.
-    struct TimeDurationImplementation;
-    // Forward declaration of an opaque pointer.
-    TimeDurationImplementation* timeDurationHandle;
+    std::chrono::nanoseconds elapsedTime;
 };
 
 
@@ -60,23 +55,8 @@ class TimeDuration
 class Timer
 {
   public:
-    // Default constructor that creates and initializes a Timer object.
-    Timer();
-
-    //Copy constructor that copies the Timer object "rhs" to the current Timer object.
-    Timer(const Timer& rhs);
-
-    // Move constructor that moves the Timer object "rhs" to the current Timer object.
-    Timer(Timer&& rhs);
-
-    // Destructor that frees the needed memory resources of the current Timer object.
-    ~Timer();
-
-    // Copy assignment operator that copies the Timer object "rhs" to the current Timer object.
-    Timer& operator = (const Timer& rhs);
-
-    // Move assignment operator that moves the Timer object "rhs" to the current Timer object.
-    Timer& operator = (Timer&& rhs);
+    // Constructor that creates and initializes a Timer object that reads the clock "clockSource".
+    explicit Timer(ClockSource clockSource = ClockSource::STEADY_CLOCK);
 
     // Method that sets the start time of a Timer object
     void setStartTime();
@@ -85,23 +65,60 @@ class Timer
     void setStopTime();
 
     // Method that returns the time elapsed since the last start of the timer object. The timer
-    // object can have stopped or is still running.
+    // object can have stopped or is still running. The timer overhead is subtracted.
     TimeDuration getElapsedTime();
 
   private:
-    // Forward declaration of a struct for the hidden implementation of Timer objects.
-    struct TimerImplementation;
-    // Forward declaration of an opaque pointer.
-    TimerImplementation* timerHandle;
+    LowOverheadTimer timer;
 };
 
 //+++++++++++++++++++++++++
 // Class TimeDurationSeries
 //+++++++++++++++++++++++++
 
+// A TimeDurationSeries object keeps the durations of repeated runs of an algorithm. The mean, the variance, the
+// minimum, and the maximum are updated with each added duration (the mean and the variance by Welford's method in
+// floating-point arithmetic, so that they neither overflow nor lose precision for long series). The order statistics
+// (median and percentiles), the bootstrap confidence interval of the median, and the outliers are computed from a
+// sorted copy of the durations that is kept until the next duration is added. Since single runs of a benchmark are
+// often slowed down by interrupts, page faults, or other processes, the median and its confidence interval are more
+// reliable than the mean when two versions of an algorithm are compared.
+
+// Type that keeps a time interval, e.g., a confidence interval.
+struct TimeDurationInterval
+{
+  TimeDuration lowerBound;
+  TimeDuration upperBound;
+};
+
+// Type that keeps the statistics of a TimeDurationSeries object (see "calculateStatistics").
+struct TimeDurationStatistics
+{
+  size_t numberOfDurations = 0;
+  TimeDuration mean;
+  TimeDuration standardDeviation;
+  TimeDuration minimum;
+  TimeDuration median;
+  TimeDuration percentile90;
+  TimeDuration percentile99;
+  TimeDuration maximum;
+  // Bootstrap confidence interval of the median.
+  TimeDurationInterval confidenceIntervalOfMedian;
+  // Indexes of the durations that are flagged as outliers.
+  std::vector<size_t> outlierIndexes;
+};
+
 class TimeDurationSeries
 {
   public:
+    // Confidence level and number of resamples of the bootstrap confidence interval of the median.
+    static constexpr double DEFAULT_CONFIDENCE_LEVEL = 0.95;
+    static constexpr size_t DEFAULT_NUMBER_OF_BOOTSTRAP_RESAMPLES = 2000;
+
+    // Threshold of the modified z-score 0.6745 * |duration - median| / MAD above which a duration is an outlier, where
+    // MAD is the median of the absolute deviations from the median (Iglewicz and Hoaglin).
+    static constexpr double DEFAULT_OUTLIER_THRESHOLD = 3.5;
+
     // Default constructor that creates and initializes a TimeDurationSeries object.
     TimeDurationSeries();
 
@@ -125,19 +142,62 @@ class TimeDurationSeries
     // Method that adds a TimeDuration object to a TimeDurationSeries object
     void addDuration(const TimeDuration& rhs);
 
+    // Method that returns the number of durations of a TimeDurationSeries object
+    size_t getNumberOfDurations();
+
     // Method that calculates the mean duration of a TimeDurationSeries object
     TimeDuration calculateMean();
 
-    // Method that calculates the variance of a TimeDurationSeries object
+    // Method that calculates the (population) variance of a TimeDurationSeries object. The variance is returned in
+    // squared nanoseconds as a number of nanoseconds; it saturates at the largest representable duration.
     TimeDuration calculateVariance();
 
-    // Method that calculates the standard deviation of a TimeDurationSeries object
+    // Method that calculates the (population) standard deviation of a TimeDurationSeries object
     TimeDuration calculateStandardDeviation();
 
+    // Methods that return the minimal and the maximal duration of a TimeDurationSeries object
+    TimeDuration calculateMinimum();
+    TimeDuration calculateMaximum();
+
+    // Method that calculates the median duration of a TimeDurationSeries object
+    TimeDuration calculateMedian();
+
+    // Method that calculates the percentile "percentage" (between 0 and 100) of a TimeDurationSeries object by linear
+    // interpolation between the closest ranks.
+    TimeDuration calculatePercentile(double percentage);
+
+    // Method that calculates a confidence interval of the median of a TimeDurationSeries object with the confidence
+    // level "confidenceLevel" (e.g., 0.95) by the percentile bootstrap with "numberOfResamples" resamples. The
+    // resamples are drawn with a fixed seed so that the interval is reproducible.
+    TimeDurationInterval calculateConfidenceIntervalOfMedian(double confidenceLevel = DEFAULT_CONFIDENCE_LEVEL,
+                                                             size_t numberOfResamples =
+                                                               DEFAULT_NUMBER_OF_BOOTSTRAP_RESAMPLES);
+
+    // Method that flags the durations of a TimeDurationSeries object whose modified z-score exceeds "threshold" as
+    // outliers. The i-th flag belongs to the i-th added duration. If more than half of the durations are equal, MAD is
+    // 0 and no duration is flagged.
+    std::vector<bool> flagOutliers(double threshold = DEFAULT_OUTLIER_THRESHOLD);
+
+    // Method that calculates all statistics of a TimeDurationSeries object with the default parameters.
+    TimeDurationStatistics calculateStatistics();
+
     // Method that writes a TimeDurationSeries object into a string object as a comma separated sequence of time
     // durations for a later use in a CSV file. Each time duration is expressed with respect to the unit "timeUnit".
     std::string writeAsACommaSeparatedList(const BaseTimeUnit& timeUnit);
 
+    // Method that writes a TimeDurationSeries object into a string object as a JSON array of the time durations in
+    // nanoseconds (integers, so that no precision is lost).
+    std::string writeAsAJSONArray();
+
+    // Method that writes the statistics of a TimeDurationSeries object into a string object as a comma separated list
+    // in the order of the column names returned by "getStatisticsColumnNames". Each time duration is expressed with
+    // respect to the unit "timeUnit".
+    std::string writeStatisticsAsACommaSeparatedList(const BaseTimeUnit& timeUnit);
+
+    // Method that returns the comma separated column names of the list written by
+    // "writeStatisticsAsACommaSeparatedList".
+    static std::string getStatisticsColumnNames();
+
   private:
     // Forward declaration of a struct for the hidden implementation of a TimeDurationSeries object.
     struct TimeDurationSeriesImplementation;
@@ -145,6 +205,53 @@ class TimeDurationSeries
     TimeDurationSeriesImplementation* timeDurationSeriesHandle;
 };
 
+//++++++++++++++++++
+// Adaptive sampling
+//++++++++++++++++++
+
+// An algorithm is run repeatedly for each number of elements. The first runs are warmup runs whose durations are not
+// kept (they fill the caches and let the processor reach its clock frequency). By default, there are no warmup runs
+// and each algorithm is run a fixed number of times (20). The adaptive sampling must be selected explicitly; it samples
+// the runs after the warmup runs until one of the following stopping rules applies; they are checked in this order:
+// - The minimal number of runs has not been sampled yet: sampling continues.
+// - The maximal number of runs has been sampled.
+// - The width of the confidence interval of the median (see "TimeDurationSeries") relative to the median does not
+//   exceed the target width.
+// - The durations of the warmup runs and the sampled runs add up to the time budget.
+
+// Type that indicates whether each algorithm is run a fixed number of times or sampled adaptively.
+enum class SamplingMode {FIXED, ADAPTIVE};
+
+// Method that converts a sampling mode into a string
+std::string convertToString(SamplingMode samplingMode);
+
+// Type that keeps the parameters of the sampling of runtimes.
+struct SamplingParameters
+{
+  SamplingMode samplingMode = SamplingMode::FIXED;
+  size_t numberOfWarmupRuns = 0;
+  // Number of runs of the fixed sampling.
+  size_t numberOfRuns = 20;
+  // Parameters of the adaptive sampling.
+  size_t minimalNumberOfRuns = 5;
+  size_t maximalNumberOfRuns = 200;
+  // Target width of the confidence interval of the median relative to the median (e.g., 0.02 for 2%).
+  double targetRelativeConfidenceIntervalWidth = 0.02;
+  // Time budget for the runs of an algorithm for one number of elements.
+  std::chrono::nanoseconds timeBudget = std::chrono::seconds(60);
+};
+
+// Method that returns the maximal number of runs (without warmup runs) of the sampling with the parameters
+// "samplingParameters".
+size_t getMaximalNumberOfRuns(const SamplingParameters& samplingParameters);
+
+// Type that indicates why the sampling of runtimes stopped.
+enum class StoppingReason {NOT_STOPPED, FIXED_NUMBER_OF_RUNS, MAXIMAL_NUMBER_OF_RUNS, CONFIDENCE_INTERVAL_WIDTH,
+                           TIME_BUDGET};
+
+// Method that converts a stopping reason into a string
+std::string convertToString(StoppingReason stoppingReason);
+
 //++++++++++++++++++++++++++++++
 // Class AlgorithmRuntimeManager
 //++++++++++++++++++++++++++++++
@@ -155,8 +262,10 @@ class AlgorithmRuntimeManager
     // Default constructor that creates and initializes an AlgorithmRuntimeManager object. The first parameter
     // indicates the number of algorithms that have to be handled. The second parameter is assumed to provide a sorted
     // list of positive integers that indicate the number of elements for which the algorithms are tested. Correctness
-    // of the input is assumed and not checked.
-    AlgorithmRuntimeManager(size_t numberOfAlgorithms, const std::vector<size_t>& numberOfElementsVector);
+    // of the input is assumed and not checked. The third parameter controls how many runs are sampled (see
+    // "SamplingParameters").
+    AlgorithmRuntimeManager(size_t numberOfAlgorithms, const std::vector<size_t>& numberOfElementsVector,
+                            const SamplingParameters& samplingParameters = SamplingParameters());
 
     // Copy constructor that copies the AlgorithmRuntimeManager object "rhs" to the current AlgorithmRuntimeManager
     // object.
@@ -178,13 +287,66 @@ class AlgorithmRuntimeManager
     AlgorithmRuntimeManager& operator = (AlgorithmRuntimeManager&& rhs);
 
     // Method that adds a TimeDuration object to an AlgorithmRuntimeManager object with respect to the algorithm number
-    // "algorithmNumber" and the number of elements "".
+    // "algorithmNumber" and the number of elements "numberOfElements". As long as the warmup runs are not completed,
+    // the duration only counts against the time budget and is not added to the time duration series.
     void addDuration(size_t algorithmNumber, size_t numberOfElements, const TimeDuration& rhs);
 
+    // Method that adds the value "value" of the metric "metricName" (e.g., a performance counter) to an
+    // AlgorithmRuntimeManager object with respect to the algorithm number "algorithmNumber" and the number of elements
+    // "numberOfElements". The value belongs to the run whose duration was added last; it is dropped if this run was a
+    // warmup run.
+    void addMetric(size_t algorithmNumber, size_t numberOfElements, const std::string& metricName, double value);
+
+    // Method that returns the names and values of the metrics of the run of the algorithm with the number
+    // "algorithmNumber" for "numberOfElements" elements whose duration was added last (e.g., to store the run in a
+    // checkpoint). It returns no metrics if this run was a warmup run.
+    std::vector<std::pair<std::string, double>> getMetricsOfLastRun(size_t algorithmNumber, size_t numberOfElements);
+
+    // Method that returns the number of runs (without warmup runs) of the algorithm with the number "algorithmNumber"
+    // for "numberOfElements" elements.
+    size_t getNumberOfRuns(size_t algorithmNumber, size_t numberOfElements);
+
+    // Method that checks whether the next run of the algorithm with the number "algorithmNumber" for
+    // "numberOfElements" elements is a warmup run.
+    bool nextRunIsWarmupRun(size_t algorithmNumber, size_t numberOfElements);
+
+    // Method that calculates the median runtime of the algorithm with the number "algorithmNumber" for
+    // "numberOfElements" elements. Without runs, it returns a duration of 0.
+    TimeDuration calculateMedian(size_t algorithmNumber, size_t numberOfElements);
+
+    // Method that calculates the median of the values of the metric "metricName" of the algorithm with the number
+    // "algorithmNumber" for "numberOfElements" elements. Without values, it returns NaN.
+    double calculateMedianOfMetric(size_t algorithmNumber, size_t numberOfElements, const std::string& metricName);
+
+    // Method that checks whether the algorithm with the number "algorithmNumber" has to be run again for
+    // "numberOfElements" elements, i.e., whether its warmup runs are not completed or no stopping rule applies. If it
+    // returns "false", the stopping reason is recorded.
+    bool needsMoreRuns(size_t algorithmNumber, size_t numberOfElements);
+
+    // Method that returns the recorded stopping reason of the algorithm with the number "algorithmNumber" for
+    // "numberOfElements" elements.
+    StoppingReason getStoppingReason(size_t algorithmNumber, size_t numberOfElements);
+
     // Method that writes the contents of an AlgorithmRuntimeManager object into a CSV file with name "filename.csv".
-    // The CSV file starts with the lines in "header". Runtimes are expressed in terms of the unit "timeUnit".
+    // The CSV file starts with the lines in "header". For each number of elements, it contains a row with the
+    // runtimes and their mean for each algorithm followed by a table with the statistics of the runtimes (see
+    // "TimeDurationSeries::writeStatisticsAsACommaSeparatedList"), the number of warmup runs, and the stopping reason
+    // of the sampling. If metrics were added, a table follows with a row for each algorithm and metric that contains
+    // the values of the runs and their median. Runtimes are expressed in terms of the unit "timeUnit". The CSV file
+    // ends with the lines in "footer" (e.g., an analysis of the runtimes).
     void writeToCSVFile(const std::string& fileName, const std::string& header, const BaseTimeUnit& timeUnit,
-                        const std::vector<std::string>& ConvexHullAlgorithms);
+                        const std::vector<std::string>& ConvexHullAlgorithms, const std::string& footer = "");
+
+    // Method that writes the contents of an AlgorithmRuntimeManager object into the file "fileName" in the JSON lines
+    // format, i.e., as one JSON object per line, so that the results can be read back (see "BenchmarkResults.h").
+    // There is a line for each algorithm and number of elements with runs. It starts with the JSON members
+    // "commonMembers" (e.g., the environment of the benchmark) followed by the members "algorithm" (the name from
+    // "algorithmNames"), "numberOfElements", "durationsNs" (the runtimes in nanoseconds), "warmupRuns",
+    // "stoppingReason", and "metrics" (an object with the values of the runs for each metric). If "isAppended" is
+    // true, the lines are appended to the file. If the file cannot be written, the method prints an error message and
+    // returns "false".
+    bool writeToJSONLinesFile(const std::string& fileName, const std::string& commonMembers,
+                              const std::vector<std::string>& algorithmNames, bool isAppended);
 
   private:
     // Forward declaration of a struct for the hidden implementation of an AlgorithmRuntimeManager object.
@@ -0,0 +1,229 @@
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+#include "LowOverheadTimer.h"
+#include "ParallelExecution.h"
+#include "TraceRecorder.h"
+
+//++++++++++++++++++++++++
+// Local types and methods
+//++++++++++++++++++++++++
+
+// Type that keeps a recorded span.
+struct TraceEvent
+{
+  const char* name;
+  size_t size;
+  std::uint64_t startTicks;
+  std::uint64_t stopTicks;
+  size_t threadNumber;
+};
+
+// Type that keeps the ring buffer of a thread.
+struct TraceBuffer
+{
+  std::vector<TraceEvent> events;
+  // Number of spans recorded since the initialization; the latest ones are kept.
+  size_t numberOfRecordedEvents = 0;
+  // Number of the thread that records into the buffer.
+  size_t threadNumber = 0;
+};
+
+// All buffers, the buffers that no thread uses, and the mutex that protects them.
+static std::vector<std::unique_ptr<TraceBuffer>> traceBuffers;
+static std::vector<TraceBuffer*> freeTraceBuffers;
+static std::mutex traceBuffersMutex;
+static size_t nextThreadNumber = 0;
+static TraceParameters traceParameters;
+// Start of the trace and minimal span duration in ticks of the clock of the spans.
+static std::uint64_t traceStartTicks = 0;
+static std::uint64_t minimalSpanTicks = 0;
+
+// Buffer of the calling thread (nullptr before it records its first span).
+static thread_local TraceBuffer* threadTraceBuffer = nullptr;
+
+// Type whose thread-local object returns the buffer of a thread when the thread exits.
+struct TraceBufferRelease
+{
+  ~TraceBufferRelease()
+  {
+    std::lock_guard<std::mutex> lock(traceBuffersMutex);
+    freeTraceBuffers.push_back(threadTraceBuffer);
+    threadTraceBuffer = nullptr;
+  }
+};
+
+// Method that allocates a buffer with the capacity of the trace parameters.
+static std::unique_ptr<TraceBuffer> allocateTraceBuffer()
+{
+  std::unique_ptr<TraceBuffer> buffer(new TraceBuffer);
+
+  buffer->events.resize(std::max<size_t>(1, traceParameters.bufferCapacity));
+  return buffer;
+}
+
+// Method that takes a buffer for the calling thread. A buffer is only allocated if all allocated ones are used.
+static TraceBuffer* acquireTraceBuffer()
+{
+  static thread_local TraceBufferRelease release;
+  std::lock_guard<std::mutex> lock(traceBuffersMutex);
+
+  if (freeTraceBuffers.empty())
+  {
+    traceBuffers.push_back(allocateTraceBuffer());
+    freeTraceBuffers.push_back(traceBuffers.back().get());
+  }
+  threadTraceBuffer = freeTraceBuffers.back();
+  freeTraceBuffers.pop_back();
+  threadTraceBuffer->threadNumber = nextThreadNumber++;
+
+  return threadTraceBuffer;
+}
+
+// Method that converts the ticks "ticks" of the clock of the spans into microseconds since the start of the trace.
+static double convertToMicroseconds(std::uint64_t ticks)
+{
+  double nanoseconds = double(std::int64_t(ticks - traceStartTicks));
+
+  if (traceParameters.clockSource == ClockSource::TIME_STAMP_COUNTER)
+    nanoseconds *= getClockCalibration().nanosecondsPerTimeStampCounterTick;
+  return nanoseconds / 1000.0;
+}
+
+// Method that writes the string "str" as a JSON string into the stream "os".
+static void writeJSONString(std::ostream& os, const std::string& str)
+{
+  os << '"';
+  for (char c : str)
+    if (c == '"' || c == '\\')
+      os << '\\' << c;
+    else if (static_cast<unsigned char>(c) < 0x20)
+      os << ' ';
+    else
+      os << c;
+  os << '"';
+}
+
+//+++++++++++++++
+// Trace recorder
+//+++++++++++++++
+
+// Method that initializes the recorder with the parameters "parameters" and discards all recorded spans.
+void TraceRecorder::initialize(const TraceParameters& parameters)
+{
+  std::lock_guard<std::mutex> lock(traceBuffersMutex);
+
+  setEnabled(false);
+  traceParameters = parameters;
+  if (parameters.clockSource == ClockSource::TIME_STAMP_COUNTER && ! getClockCalibration().timeStampCounterIsAvailable)
+    traceParameters.clockSource = ClockSource::STEADY_CLOCK;
+  minimalSpanSize = traceParameters.minimalSpanSize;
+  clockSource = traceParameters.clockSource;
+
+  // Allocate the buffers in advance, so that recording spans does not allocate memory.
+  size_t numberOfBuffers = resolveNumberOfThreads(parameters.numberOfBuffers);
+  for (std::unique_ptr<TraceBuffer>& buffer : traceBuffers)
+  {
+    buffer->events.resize(std::max<size_t>(1, traceParameters.bufferCapacity));
+    buffer->numberOfRecordedEvents = 0;
+  }
+  while (traceBuffers.size() < numberOfBuffers)
+  {
+    traceBuffers.push_back(allocateTraceBuffer());
+    freeTraceBuffers.push_back(traceBuffers.back().get());
+  }
+
+  traceStartTicks = LowOverheadTimer::readStartTicks(clockSource);
+  minimalSpanTicks = std::uint64_t(traceParameters.minimalSpanDuration.count());
+  if (clockSource == ClockSource::TIME_STAMP_COUNTER)
+    minimalSpanTicks = std::uint64_t(std::llround(double(minimalSpanTicks) /
+                                                  getClockCalibration().nanosecondsPerTimeStampCounterTick));
+}
+
+// Method that records a span in the buffer of the calling thread.
+void TraceRecorder::recordSpan(const char* name, size_t size, std::uint64_t startTicks, std::uint64_t stopTicks)
+{
+  if (stopTicks - startTicks < minimalSpanTicks)
+    return;
+
+  TraceBuffer* buffer = (threadTraceBuffer != nullptr) ? threadTraceBuffer : acquireTraceBuffer();
+  TraceEvent& event = buffer->events[buffer->numberOfRecordedEvents % buffer->events.size()];
+  event.name = name;
+  event.size = size;
+  event.startTicks = startTicks;
+  event.stopTicks = stopTicks;
+  event.threadNumber = buffer->threadNumber;
+  ++buffer->numberOfRecordedEvents;
+}
+
+// Method that returns the number of spans that were overwritten because a buffer was full.
+size_t TraceRecorder::getNumberOfOverwrittenSpans()
+{
+  std::lock_guard<std::mutex> lock(traceBuffersMutex);
+  size_t numberOfOverwrittenSpans = 0;
+
+  for (const std::unique_ptr<TraceBuffer>& buffer : traceBuffers)
+    if (buffer->numberOfRecordedEvents > buffer->events.size())
+      numberOfOverwrittenSpans += buffer->numberOfRecordedEvents - buffer->events.size();
+
+  return numberOfOverwrittenSpans;
+}
+
+// Method that writes the recorded spans into the file "fileName" in the Chrome trace event format. Each span is a
+// complete event ("ph": "X") with its start and duration in microseconds; the threads are numbered in the order in
+// which they recorded their first span.
+bool TraceRecorder::writeToJSONFile(const std::string& fileName)
+{
+  size_t numberOfOverwrittenSpans = getNumberOfOverwrittenSpans();
+  std::lock_guard<std::mutex> lock(traceBuffersMutex);
+  std::ofstream outputFile(fileName);
+
+  if (! outputFile)
+  {
+    std::cout << "ERROR: File '" << fileName << "' cannot be written!" << std::endl;
+    return false;
+  }
+
+  std::vector<bool> threadIsNamed(nextThreadNumber, false);
+  bool isFirstEvent = true;
+  outputFile << std::fixed << std::setprecision(3) << "{\"traceEvents\":[";
+  for (const std::unique_ptr<TraceBuffer>& buffer : traceBuffers)
+  {
+    size_t numberOfEvents = std::min(buffer->numberOfRecordedEvents, buffer->events.size());
+    for (size_t i = buffer->numberOfRecordedEvents - numberOfEvents; i < buffer->numberOfRecordedEvents; ++i)
+    {
+      const TraceEvent& event = buffer->events[i % buffer->events.size()];
+      outputFile << (isFirstEvent ? "\n" : ",\n");
+      isFirstEvent = false;
+      if (! threadIsNamed[event.threadNumber])
+      {
+        outputFile << "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":" << event.threadNumber
+                   << ",\"args\":{\"name\":\"thread " << event.threadNumber << "\"}},\n";
+        threadIsNamed[event.threadNumber] = true;
+      }
+      outputFile << "{\"name\":";
+      writeJSONString(outputFile, event.name);
+      outputFile << ",\"ph\":\"X\",\"pid\":1,\"tid\":" << event.threadNumber
+                 << ",\"ts\":" << convertToMicroseconds(event.startTicks)
+                 << ",\"dur\":" << convertToMicroseconds(event.stopTicks) - convertToMicroseconds(event.startTicks);
+      if (event.size > 0)
+        outputFile << ",\"args\":{\"size\":" << event.size << "}";
+      outputFile << "}";
+    }
+  }
+  outputFile << "\n],\n\"displayTimeUnit\":\"ns\",\n\"otherData\":{\"clock\":\""
+             << ((traceParameters.clockSource == ClockSource::TIME_STAMP_COUNTER) ? "tsc" : "steady")
+             << "\",\"minimalSpanSize\":" << traceParameters.minimalSpanSize
+             << ",\"minimalSpanDurationNs\":" << traceParameters.minimalSpanDuration.count()
+             << ",\"overwrittenSpans\":" << numberOfOverwrittenSpans << "}}" << std::endl;
+
+  return true;
+}
@@ -0,0 +1,121 @@
+#ifndef TRACERECORDER_H
+#define TRACERECORDER_H
+
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include "LowOverheadTimer.h"
+
+// A trace recorder records spans, i.e., named intervals of time, of the phases of the convex hull algorithms (scan,
+// partitions, searches of the furthest point, recursive sub-problems, and so on) and of the tasks of "runInParallel"
+// (see "ParallelExecution.h"). The spans can be written into a JSON file in the Chrome trace event format, which can
+// be opened with a trace viewer such as "chrome://tracing" or "https://ui.perfetto.dev" to see where the time of a run
+// goes and how busy the threads are.
+//
+// The algorithms mark spans with the macros below. Spans are only recorded while the recorder is enabled; otherwise a
+// span costs a single load and branch. Spans of sub-problems with fewer points than the minimal span size are not
+// recorded at all, and spans that are shorter than the minimal span duration are dropped, so that tracing runs with
+// 100000000 points only records the phases that matter. If the recorder is compiled with "TRACE_SPANS" defined as 0
+// (e.g., with "make FLAGS=-DTRACE_SPANS=0"), the macros expand to nothing.
+//
+// Each thread records its spans in its own ring buffer, so that recording needs no synchronization. The buffers are
+// allocated when the recorder is initialized; a thread takes one when it records its first span and returns it when
+// it exits (its spans are kept). If a buffer is full, the oldest spans are overwritten.
+
+#ifndef TRACE_SPANS
+#define TRACE_SPANS 1
+#endif
+
+// Type that keeps the parameters of a trace recorder.
+struct TraceParameters
+{
+  // Number of spans that the buffer of each thread keeps.
+  size_t bufferCapacity = 65536;
+  // Number of buffers that are allocated in advance (0 means one per thread of "getDefaultNumberOfThreads").
+  size_t numberOfBuffers = 0;
+  // Spans of sub-problems with fewer points are not recorded.
+  size_t minimalSpanSize = 1000;
+  // Shorter spans are dropped.
+  std::chrono::nanoseconds minimalSpanDuration {0};
+  // Clock that times the spans (see "LowOverheadTimer.h").
+  ClockSource clockSource = ClockSource::TIME_STAMP_COUNTER;
+};
+
+class TraceRecorder
+{
+  public:
+    // Method that initializes the recorder with the parameters "parameters" and discards all recorded spans. The
+    // recorder is disabled. It must not be called while spans are recorded.
+    static void initialize(const TraceParameters& parameters);
+
+    // Method that enables or disables the recording of spans.
+    static void setEnabled(bool isEnabled) { enabled.store(isEnabled, std::memory_order_relaxed); }
+
+    // Method that checks whether spans are recorded.
+    static bool isEnabled() { return enabled.load(std::memory_order_relaxed); }
+
+    // Method that writes the recorded spans into the file "fileName" in the Chrome trace event format. It must not be
+    // called while spans are recorded. If the file cannot be written, the method prints an error message and returns
+    // "false".
+    static bool writeToJSONFile(const std::string& fileName);
+
+    // Method that returns the number of spans that were overwritten because a buffer was full.
+    static size_t getNumberOfOverwrittenSpans();
+
+    // Type whose objects record a span with the name "name" while they exist. The name must exist until the spans are
+    // written (e.g., a string literal). A span with a size "size" (e.g., the number of points of a sub-problem) is
+    // only recorded if the size reaches the minimal span size.
+    class Span
+    {
+      public:
+        explicit Span(const char* name) : name(name), size(0), isRecorded(isEnabled())
+        {
+          if (isRecorded)
+            startTicks = LowOverheadTimer::readStartTicks(clockSource);
+        }
+        Span(const char* name, size_t size) : name(name), size(size),
+                                              isRecorded(isEnabled() && size >= minimalSpanSize)
+        {
+          if (isRecorded)
+            startTicks = LowOverheadTimer::readStartTicks(clockSource);
+        }
+        ~Span()
+        {
+          if (isRecorded)
+            recordSpan(name, size, startTicks, LowOverheadTimer::readStopTicks(clockSource));
+        }
+
+        Span(const Span&) = delete;
+        Span& operator = (const Span&) = delete;
+
+      private:
+        const char* name;
+        size_t size;
+        bool isRecorded;
+        std::uint64_t startTicks = 0;
+    };
+
+  private:
+    // Method that records a span in the buffer of the calling thread.
+    static void recordSpan(const char* name, size_t size, std::uint64_t startTicks, std::uint64_t stopTicks);
+
+    // Settings that are read when spans are recorded.
+    static inline std::atomic<bool> enabled {false};
+    static inline size_t minimalSpanSize = 0;
+    static inline ClockSource clockSource = ClockSource::STEADY_CLOCK;
+};
+
+#define TRACE_SPAN_NAME_OF_LINE(line) traceSpan ## line
+#define TRACE_SPAN_NAME(line) TRACE_SPAN_NAME_OF_LINE(line)
+#if TRACE_SPANS
+#define TRACE_SPAN(name) TraceRecorder::Span TRACE_SPAN_NAME(__LINE__)(name)
+#define TRACE_SIZED_SPAN(name, size) TraceRecorder::Span TRACE_SPAN_NAME(__LINE__)(name, size)
+#else
+#define TRACE_SPAN(name) ((void) 0)
+#define TRACE_SIZED_SPAN(name, size) ((void) 0)
+#endif
+
+#endif // TRACERECORDER_H